@@ -121,9 +121,16 @@ namespace kagome::api {
 
   const std::string kRpcEventUpdateExtrinsic = "author_extrinsicUpdate";
 
+  /// Max number of undelivered events of session subscription
+  constexpr size_t kMaxSessionQueuedEvents = 1024;
+
+  constexpr auto kDroppedEventsMetricName =
+      "kagome_rpc_subscription_dropped_events";
+
   ApiServiceImpl::ApiServiceImpl(
       application::AppStateManager &app_state_manager,
       std::shared_ptr<api::RpcThreadPool> thread_pool,
+      std::shared_ptr<api::RpcRequestScheduler> scheduler,
       std::vector<std::shared_ptr<Listener>> listeners,
       std::shared_ptr<JRpcServer> server,
       std::vector<std::shared_ptr<JRpcProcessor>> processors,
@@ -136,6 +143,7 @@ namespace kagome::api {
       std::shared_ptr<storage::trie::TrieStorage> trie_storage,
       std::shared_ptr<runtime::Core> core)
       : thread_pool_(std::move(thread_pool)),
+        scheduler_(std::move(scheduler)),
         listeners_(std::move(listeners)),
         server_(std::move(server)),
         logger_{log::createLogger("ApiService", "api")},
@@ -147,6 +155,7 @@ namespace kagome::api {
                               .ext = std::move(ext_sub_engine)},
         extrinsic_event_key_repo_{std::move(extrinsic_event_key_repo)} {
     BOOST_ASSERT(thread_pool_);
+    BOOST_ASSERT(scheduler_);
     BOOST_ASSERT(block_tree_);
     BOOST_ASSERT(trie_storage_);
     BOOST_ASSERT(core_);
@@ -166,6 +175,13 @@ namespace kagome::api {
     BOOST_ASSERT(subscription_engines_.storage);
     BOOST_ASSERT(subscription_engines_.ext);
     BOOST_ASSERT(extrinsic_event_key_repo_);
+
+    // Register metrics
+    metrics_registry_->registerCounterFamily(
+        kDroppedEventsMetricName,
+        "Number of subscription events dropped because of slow RPC sessions");
+    metric_dropped_events_ =
+        metrics_registry_->registerCounterMetric(kDroppedEventsMetricName);
   }
 
   jsonrpc::Value ApiServiceImpl::createStateStorageEvent(
@@ -208,23 +224,51 @@ namespace kagome::api {
     if (auto self = wp.lock()) {   \
       self->callback(params...);   \
     }                              \
+  }
+#define UNWRAP_WEAK_PTR_DEFERRED(callback)                  \
+  [wp](auto &&...params) mutable -> std::function<void()> { \
+    if (auto self = wp.lock()) {                            \
+      return self->callback(params...);                     \
+    }                                                       \
+    return nullptr;                                         \
   }
 
             if (SessionType::kWs == session->type()) {
               auto session_context =
                   self->storeSessionWithId(session->id(), session);
               BOOST_ASSERT(session_context);
-              session_context->storage_sub->setCallback(
-                  UNWRAP_WEAK_PTR(onStorageEvent));
-              session_context->chain_sub->setCallback(
-                  UNWRAP_WEAK_PTR(onChainEvent));
-              session_context->ext_sub->setCallback(
-                  UNWRAP_WEAK_PTR(onExtrinsicEvent));
+              auto executor = [weak_session{std::weak_ptr{session}}](
+                                  std::function<void()> cb) {
+                if (auto session = weak_session.lock()) {
+                  session->post(std::move(cb));
+                }
+              };
+              auto on_drop = [wp] {
+                if (auto self = wp.lock()) {
+                  self->metric_dropped_events_->inc();
+                }
+              };
+              session_context->storage_sub->setAsyncCallback(
+                  UNWRAP_WEAK_PTR_DEFERRED(onStorageEvent),
+                  executor,
+                  kMaxSessionQueuedEvents,
+                  on_drop);
+              session_context->chain_sub->setAsyncCallback(
+                  UNWRAP_WEAK_PTR_DEFERRED(onChainEvent),
+                  executor,
+                  kMaxSessionQueuedEvents,
+                  on_drop);
+              session_context->ext_sub->setAsyncCallback(
+                  UNWRAP_WEAK_PTR_DEFERRED(onExtrinsicEvent),
+                  executor,
+                  kMaxSessionQueuedEvents,
+                  on_drop);
             }
 
             session->connectOnRequest(UNWRAP_WEAK_PTR(onSessionRequest));
             session->connectOnCloseHandler(UNWRAP_WEAK_PTR(onSessionClose));
           };
+#undef UNWRAP_WEAK_PTR_DEFERRED
 #undef UNWRAP_WEAK_PTR
 
       listener->setHandlerForNewSession(std::move(on_new_session));
@@ -233,6 +277,7 @@ namespace kagome::api {
   }  // namespace kagome::api
 
   bool ApiServiceImpl::start() {
+    scheduler_->start();
     thread_pool_->start();
     SL_DEBUG(logger_, "API Service started");
     return true;
@@ -240,6 +285,7 @@ namespace kagome::api {
 
   void ApiServiceImpl::stop() {
     thread_pool_->stop();
+    scheduler_->stop();
     SL_DEBUG(logger_, "API Service stopped");
   }
 
@@ -284,8 +330,14 @@ namespace kagome::api {
                 const auto &header =
                     block_tree_->getBlockHeader(best_block_hash);
                 BOOST_ASSERT(header.has_value());
-                auto batch_res = trie_storage_->getEphemeralBatchAt(
-                    header.value().state_root);
+                using BatchResult =
+                    outcome::result<std::unique_ptr<storage::trie::TrieBatch>>;
+                auto batch_res = [&]() -> BatchResult {
+                  OUTCOME_TRY(snapshot,
+                              trie_storage_->getSnapshotAt(
+                                  header.value().state_root));
+                  return snapshot->batch();
+                }();
                 if (!batch_res.has_value()) {
                   SL_ERROR(logger_,
                            "Failed to get storage state for block {}, required "
@@ -489,6 +541,19 @@ namespace kagome::api {
 
   void ApiServiceImpl::onSessionRequest(std::string_view request,
                                         std::shared_ptr<Session> session) {
+    scheduler_->schedule(
+        session->id(),
+        request,
+        [wp = weak_from_this(), request{std::string{request}}, session] {
+          if (auto self = wp.lock()) {
+            self->processSessionRequest(request, session);
+          }
+        },
+        [session](std::string_view response) { session->respond(response); });
+  }
+
+  void ApiServiceImpl::processSessionRequest(
+      std::string_view request, const std::shared_ptr<Session> &session) {
     auto thread_session_auto_release = [](void *) {
       threaded_info.releaseSessionId();
     };
@@ -537,20 +602,19 @@ namespace kagome::api {
     removeSessionById(id);
   }
 
-  void ApiServiceImpl::onStorageEvent(SubscriptionSetId set_id,
-                                      SessionPtr &session,
-                                      const Buffer &key,
-                                      const std::optional<Buffer> &data,
-                                      const common::Hash256 &block) {
-    sendEvent(server_,
-              session,
-              logger_,
-              set_id,
-              kRpcEventSubscribeStorage,
-              createStateStorageEvent({{key, data}}, block));
+  std::function<void()> ApiServiceImpl::onStorageEvent(
+      SubscriptionSetId set_id,
+      SessionPtr &session,
+      const Buffer &key,
+      const std::optional<Buffer> &data,
+      const common::Hash256 &block) {
+    return deferEvent(session,
+                      set_id,
+                      kRpcEventSubscribeStorage,
+                      createStateStorageEvent({{key, data}}, block));
   }
 
-  void ApiServiceImpl::onChainEvent(
+  std::function<void()> ApiServiceImpl::onChainEvent(
       SubscriptionSetId set_id,
       SessionPtr &session,
       primitives::events::ChainEventType event_type,
@@ -567,28 +631,39 @@ namespace kagome::api {
         name = kRpcEventRuntimeVersion;
       } break;
       case primitives::events::ChainEventType::kNewRuntime:
-        return;
+        return nullptr;
       default:
         BOOST_ASSERT(!"Unknown chain event");
-        return;
+        return nullptr;
     }
 
     BOOST_ASSERT(!name.empty());
-    sendEvent(
-        server_, session, logger_, set_id, name, api::makeValue(event_params));
+    return deferEvent(session, set_id, name, api::makeValue(event_params));
   }
 
-  void ApiServiceImpl::onExtrinsicEvent(
+  std::function<void()> ApiServiceImpl::onExtrinsicEvent(
       SubscriptionSetId set_id,
       SessionPtr &session,
       primitives::events::SubscribedExtrinsicId ext_id,
       const primitives::events::ExtrinsicLifecycleEvent &params) {
-    sendEvent(server_,
-              session,
-              logger_,
-              set_id,
-              kRpcEventUpdateExtrinsic,
-              api::makeValue(params));
+    return deferEvent(
+        session, set_id, kRpcEventUpdateExtrinsic, api::makeValue(params));
+  }
+
+  std::function<void()> ApiServiceImpl::deferEvent(SessionPtr &session,
+                                                   SubscriptionSetId set_id,
+                                                   std::string_view name,
+                                                   jsonrpc::Value &&value) {
+    // event params may refer to notifier's data, so they are converted to
+    // json value here and formatted later on session's thread
+    return [server{server_},
+            session,
+            logger{logger_},
+            set_id,
+            name,
+            value{std::move(value)}]() mutable {
+      sendEvent(server, session, logger, set_id, name, std::move(value));
+    };
   }
 
 }  // namespace kagome::api
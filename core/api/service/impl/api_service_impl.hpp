@@ -15,11 +15,13 @@
 
 #include <jsonrpc-lean/fault.h>
 
+#include "api/transport/rpc_request_scheduler.hpp"
 #include "api/transport/rpc_thread_pool.hpp"
 #include "api/transport/session.hpp"
 #include "common/buffer.hpp"
 #include "containers/objects_cache.hpp"
 #include "log/logger.hpp"
+#include "metrics/metrics.hpp"
 #include "primitives/block_id.hpp"
 #include "primitives/event_types.hpp"
 #include "subscription/subscription_engine.hpp"
@@ -113,6 +115,7 @@ namespace kagome::api {
    public:
     ApiServiceImpl(application::AppStateManager &app_state_manager,
                    std::shared_ptr<api::RpcThreadPool> thread_pool,
+                   std::shared_ptr<api::RpcRequestScheduler> scheduler,
                    std::vector<std::shared_ptr<Listener>> listeners,
                    std::shared_ptr<JRpcServer> server,
                    std::vector<std::shared_ptr<JRpcProcessor>> processors,
@@ -182,21 +185,28 @@ namespace kagome::api {
 
     void onSessionRequest(std::string_view request,
                           std::shared_ptr<Session> session);
+    void processSessionRequest(std::string_view request,
+                               const std::shared_ptr<Session> &session);
     void onSessionClose(Session::SessionId id, SessionType);
-    void onStorageEvent(SubscriptionSetId set_id,
-                        SessionPtr &session,
-                        const Buffer &key,
-                        const std::optional<Buffer> &data,
-                        const common::Hash256 &block);
-    void onChainEvent(SubscriptionSetId set_id,
-                      SessionPtr &session,
-                      primitives::events::ChainEventType event_type,
-                      const primitives::events::ChainEventParams &params);
-    void onExtrinsicEvent(
+    std::function<void()> onStorageEvent(SubscriptionSetId set_id,
+                                         SessionPtr &session,
+                                         const Buffer &key,
+                                         const std::optional<Buffer> &data,
+                                         const common::Hash256 &block);
+    std::function<void()> onChainEvent(
+        SubscriptionSetId set_id,
+        SessionPtr &session,
+        primitives::events::ChainEventType event_type,
+        const primitives::events::ChainEventParams &params);
+    std::function<void()> onExtrinsicEvent(
         SubscriptionSetId set_id,
         SessionPtr &session,
         primitives::events::SubscribedExtrinsicId id,
         const primitives::events::ExtrinsicLifecycleEvent &params);
+    std::function<void()> deferEvent(SessionPtr &session,
+                                     SubscriptionSetId set_id,
+                                     std::string_view name,
+                                     jsonrpc::Value &&value);
 
     template <typename Func>
     auto withSession(kagome::api::Session::SessionId id, Func &&f) {
@@ -225,6 +235,7 @@ namespace kagome::api {
     }
 
     std::shared_ptr<api::RpcThreadPool> thread_pool_;
+    std::shared_ptr<api::RpcRequestScheduler> scheduler_;
     std::vector<std::shared_ptr<Listener>> listeners_;
     std::shared_ptr<JRpcServer> server_;
     log::Logger logger_;
@@ -244,6 +255,9 @@ namespace kagome::api {
     } subscription_engines_;
     std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
         extrinsic_event_key_repo_;
+
+    metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
+    metrics::Counter *metric_dropped_events_;
   };
 }  // namespace kagome::api
 
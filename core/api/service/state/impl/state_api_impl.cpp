@@ -79,8 +79,9 @@ namespace kagome::api {
         block_hash_opt.value_or(block_tree_->getLastFinalized().hash);
 
     OUTCOME_TRY(header, header_repo_->getBlockHeader(block_hash));
-    OUTCOME_TRY(initial_trie_reader,
-                storage_->getEphemeralBatchAt(header.state_root));
+    // snapshot is not affected by blocks imported while keys are iterated
+    OUTCOME_TRY(snapshot, storage_->getSnapshotAt(header.state_root));
+    OUTCOME_TRY(initial_trie_reader, snapshot->batch());
     auto cursor = initial_trie_reader->trieCursor();
 
     // if prev_key is bigger than prefix, then set cursor to the next key after
@@ -119,7 +120,8 @@ namespace kagome::api {
   outcome::result<std::optional<common::Buffer>> StateApiImpl::getStorageAt(
       const common::BufferView &key, const primitives::BlockHash &at) const {
     OUTCOME_TRY(header, header_repo_->getBlockHeader(at));
-    OUTCOME_TRY(trie_reader, storage_->getEphemeralBatchAt(header.state_root));
+    OUTCOME_TRY(snapshot, storage_->getSnapshotAt(header.state_root));
+    OUTCOME_TRY(trie_reader, snapshot->batch());
     auto res = trie_reader->tryGet(key);
     return common::map_result_optional(
         std::move(res), [](common::BufferOrView &&r) { return r.into(); });
@@ -158,7 +160,8 @@ namespace kagome::api {
     OUTCOME_TRY(range, block_tree_->getChainByBlocks(from, to));
     for (auto &block : range) {
       OUTCOME_TRY(header, header_repo_->getBlockHeader(block));
-      OUTCOME_TRY(batch, storage_->getEphemeralBatchAt(header.state_root));
+      OUTCOME_TRY(snapshot, storage_->getSnapshotAt(header.state_root));
+      OUTCOME_TRY(batch, snapshot->batch());
       StorageChangeSet change{block, {}};
       for (auto &key : keys) {
         OUTCOME_TRY(opt_get, batch->tryGet(key));
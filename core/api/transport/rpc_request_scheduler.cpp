@@ -0,0 +1,369 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/transport/rpc_request_scheduler.hpp"
+
+#include <unordered_set>
+
+#include <boost/asio/post.hpp>
+#include <fmt/format.h>
+#include <jsonrpc-lean/server.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+#include <soralog/util.hpp>
+
+namespace {
+  constexpr auto kQueueTimeMetricName = "kagome_rpc_queue_time";
+  constexpr auto kRejectedMetricName = "kagome_rpc_rejected_requests";
+
+  /// Implementation defined server error of json-rpc
+  constexpr int kServerBusyErrorCode = -32000;
+
+  constexpr std::array<std::string_view, kagome::api::kRpcLaneCount>
+      kLaneNames{"cheap", "subscription", "runtime"};
+
+  /**
+   * Finds "method" and "id" of request without building document.
+   * Requests are objects on level 1 for single request and on level 2 for
+   * batch.
+   */
+  struct RequestInfoParser {
+    using RpcLane = kagome::api::RpcLane;
+
+    enum class Field { kNone, kMethod, kId };
+
+    size_t level = 0;
+    bool batch = false;
+    Field field = Field::kNone;
+    std::optional<RpcLane> lane;
+    std::string id;
+
+    bool requestLevel() const {
+      return level == (batch ? 2 : 1);
+    }
+
+    void setMethod(std::string_view method) {
+      auto method_lane = kagome::api::RpcRequestScheduler::laneOf(method);
+      if (not lane or *lane < method_lane) {
+        lane = method_lane;
+      }
+    }
+
+    bool scalar(std::string_view raw, bool is_string) {
+      if (requestLevel()) {
+        if (field == Field::kMethod and is_string) {
+          setMethod(raw);
+        } else if (field == Field::kId and not batch) {
+          if (is_string) {
+            rapidjson::StringBuffer buffer;
+            rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+            writer.String(raw.data(), raw.size());
+            id.assign(buffer.GetString(), buffer.GetSize());
+          } else {
+            id.assign(raw);
+          }
+        }
+      }
+      field = Field::kNone;
+      return true;
+    }
+
+    bool Null() {
+      return scalar("null", false);
+    }
+    bool Bool(bool value) {
+      return scalar(value ? "true" : "false", false);
+    }
+    bool Int(int) {
+      return scalar({}, false);
+    }
+    bool Uint(unsigned) {
+      return scalar({}, false);
+    }
+    bool Int64(int64_t) {
+      return scalar({}, false);
+    }
+    bool Uint64(uint64_t) {
+      return scalar({}, false);
+    }
+    bool Double(double) {
+      return scalar({}, false);
+    }
+    bool RawNumber(const char *str, size_t length, bool) {
+      return scalar({str, length}, false);
+    }
+    bool String(const char *str, size_t length, bool) {
+      return scalar({str, length}, true);
+    }
+    bool Key(const char *str, size_t length, bool) {
+      field = Field::kNone;
+      if (requestLevel()) {
+        std::string_view key{str, length};
+        if (key == "method") {
+          field = Field::kMethod;
+        } else if (key == "id") {
+          field = Field::kId;
+        }
+      }
+      return true;
+    }
+    bool StartArray() {
+      if (level == 0) {
+        batch = true;
+      }
+      field = Field::kNone;
+      ++level;
+      return true;
+    }
+    bool EndArray(size_t) {
+      --level;
+      return true;
+    }
+    bool StartObject() {
+      field = Field::kNone;
+      ++level;
+      return true;
+    }
+    bool EndObject(size_t) {
+      --level;
+      return true;
+    }
+  };
+}  // namespace
+
+namespace kagome::api {
+
+  RpcRequestScheduler::RpcRequestScheduler(const Configuration &configuration)
+      : config_(configuration) {
+    lanes_[static_cast<size_t>(RpcLane::kCheap)].deadline =
+        config_.cheap_deadline;
+    lanes_[static_cast<size_t>(RpcLane::kCheap)].thread_number =
+        config_.cheap_threads;
+    lanes_[static_cast<size_t>(RpcLane::kSubscription)].deadline =
+        config_.subscription_deadline;
+    lanes_[static_cast<size_t>(RpcLane::kSubscription)].thread_number =
+        config_.subscription_threads;
+    lanes_[static_cast<size_t>(RpcLane::kRuntime)].deadline =
+        config_.runtime_deadline;
+    lanes_[static_cast<size_t>(RpcLane::kRuntime)].thread_number =
+        config_.runtime_threads;
+
+    // Register metrics
+    metrics_registry_->registerHistogramFamily(
+        kQueueTimeMetricName,
+        "Time RPC requests spent in queue before execution");
+    for (size_t i = 0; i < kRpcLaneCount; ++i) {
+      lanes_[i].metric_queue_time = metrics_registry_->registerHistogramMetric(
+          kQueueTimeMetricName,
+          {0.0001, 0.0005, 0.001, 0.005, 0.01, 0.05, 0.1, 0.5, 1, 5, 10},
+          {{"lane", std::string{kLaneNames[i]}}});
+    }
+    metrics_registry_->registerCounterFamily(
+        kRejectedMetricName, "Number of RPC requests rejected by scheduler");
+    metric_session_limit_rejected_ = metrics_registry_->registerCounterMetric(
+        kRejectedMetricName, {{"reason", "session_limit"}});
+    metric_deadline_rejected_ = metrics_registry_->registerCounterMetric(
+        kRejectedMetricName, {{"reason", "deadline"}});
+    metric_shutdown_dropped_ = metrics_registry_->registerCounterMetric(
+        kRejectedMetricName, {{"reason", "shutdown"}});
+  }
+
+  RpcRequestScheduler::~RpcRequestScheduler() {
+    stop();
+  }
+
+  void RpcRequestScheduler::start() {
+    if (started_) {
+      return;
+    }
+    started_ = true;
+    for (size_t i = 0; i < kRpcLaneCount; ++i) {
+      auto &lane = lanes_[i];
+      BOOST_ASSERT(lane.thread_number > 0);
+      lane.io_context.restart();
+      lane.work_guard.emplace(lane.io_context.get_executor());
+      lane.threads.reserve(lane.thread_number);
+      for (size_t n = 0; n < lane.thread_number; ++n) {
+        lane.threads.emplace_back([&io_context = lane.io_context,
+                                   name = fmt::format(
+                                       "rpc.{}.{}", kLaneNames[i], n + 1)] {
+          soralog::util::setThreadName(name);
+          io_context.run();
+        });
+      }
+    }
+    SL_DEBUG(logger_, "Request scheduler started");
+  }
+
+  void RpcRequestScheduler::stop() {
+    if (not started_) {
+      return;
+    }
+    started_ = false;
+    for (auto &lane : lanes_) {
+      lane.work_guard.reset();
+      lane.io_context.stop();
+    }
+    for (auto &lane : lanes_) {
+      for (auto &thread : lane.threads) {
+        thread.join();
+      }
+      lane.threads.clear();
+      // drain requests left in queue, they see scheduler stopped and are
+      // dropped releasing their sessions
+      lane.io_context.restart();
+      lane.io_context.poll();
+    }
+    SL_DEBUG(logger_, "Request scheduler stopped");
+  }
+
+  bool RpcRequestScheduler::isStarted() const {
+    return started_;
+  }
+
+  RpcLane RpcRequestScheduler::laneOf(std::string_view method) {
+    static const std::unordered_set<std::string_view> kRuntimeMethods{
+        "author_hasSessionKeys",
+        "author_rotateKeys",
+        "author_submitExtrinsic",
+        "chain_getRuntimeVersion",
+        "childstate_getKeys",
+        "childstate_getKeysPaged",
+        "payment_queryInfo",
+        "state_call",
+        "state_callAt",
+        "state_getKeysPaged",
+        "state_getMetadata",
+        "state_getReadProof",
+        "state_getRuntimeVersion",
+        "state_queryStorage",
+        "state_queryStorageAt",
+        "system_accountNextIndex",
+    };
+    static const std::unordered_set<std::string_view> kSubscriptionMethods{
+        "author_submitAndWatchExtrinsic",
+        "author_unwatchExtrinsic",
+    };
+    if (kRuntimeMethods.count(method) != 0) {
+      return RpcLane::kRuntime;
+    }
+    if (kSubscriptionMethods.count(method) != 0
+        or method.find("ubscribe") != std::string_view::npos) {
+      return RpcLane::kSubscription;
+    }
+    return RpcLane::kCheap;
+  }
+
+  RpcRequestScheduler::RequestInfo RpcRequestScheduler::classify(
+      std::string_view request) {
+    RequestInfoParser parser;
+    rapidjson::MemoryStream stream{request.data(), request.size()};
+    rapidjson::Reader reader;
+    // malformed request is reported by json-rpc server itself
+    reader.Parse<rapidjson::kParseNumbersAsStringsFlag>(stream, parser);
+    return RequestInfo{.lane = parser.lane.value_or(RpcLane::kCheap),
+                       .id = std::move(parser.id)};
+  }
+
+  void RpcRequestScheduler::schedule(Session::SessionId session_id,
+                                     std::string_view request,
+                                     Task task,
+                                     OnReject reject) {
+    if (not started_) {
+      task();
+      return;
+    }
+
+    auto info = classify(request);
+    if (not acquireSession(session_id)) {
+      metric_session_limit_rejected_->inc();
+      SL_DEBUG(logger_,
+               "Session {} exceeded limit of {} concurrent requests",
+               session_id,
+               config_.max_session_requests);
+      reject(makeError(info.id, "Too many concurrent requests"));
+      return;
+    }
+
+    auto &lane = lanes_[static_cast<size_t>(info.lane)];
+    boost::asio::post(
+        lane.io_context,
+        [this,
+         &lane,
+         slot = SessionSlot{*this, session_id},
+         id{std::move(info.id)},
+         task{std::move(task)},
+         reject{std::move(reject)},
+         enqueued = std::chrono::steady_clock::now()] {
+          if (not started_) {
+            metric_shutdown_dropped_->inc();
+            return;
+          }
+          const auto queue_time = std::chrono::steady_clock::now() - enqueued;
+          lane.metric_queue_time->observe(
+              std::chrono::duration<double>(queue_time).count());
+          if (queue_time > lane.deadline) {
+            metric_deadline_rejected_->inc();
+            reject(makeError(id, "Request deadline exceeded"));
+          } else {
+            task();
+          }
+        });
+  }
+
+  size_t RpcRequestScheduler::sessionRequests(
+      Session::SessionId session_id) const {
+    std::lock_guard lock{sessions_mutex_};
+    auto it = session_requests_.find(session_id);
+    return it == session_requests_.end() ? 0 : it->second;
+  }
+
+  bool RpcRequestScheduler::acquireSession(Session::SessionId session_id) {
+    std::lock_guard lock{sessions_mutex_};
+    auto &requests = session_requests_[session_id];
+    if (requests >= config_.max_session_requests) {
+      if (requests == 0) {
+        session_requests_.erase(session_id);
+      }
+      return false;
+    }
+    ++requests;
+    return true;
+  }
+
+  void RpcRequestScheduler::releaseSession(Session::SessionId session_id) {
+    std::lock_guard lock{sessions_mutex_};
+    auto it = session_requests_.find(session_id);
+    BOOST_ASSERT(it != session_requests_.end());
+    if (--it->second == 0) {
+      session_requests_.erase(it);
+    }
+  }
+
+  std::string RpcRequestScheduler::makeError(const std::string &id,
+                                             std::string_view message) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("jsonrpc");
+    writer.String("2.0");
+    writer.Key("id");
+    if (id.empty()) {
+      writer.Null();
+    } else {
+      writer.RawValue(id.data(), id.size(), rapidjson::kNumberType);
+    }
+    writer.Key("error");
+    writer.StartObject();
+    writer.Key("code");
+    writer.Int(kServerBusyErrorCode);
+    writer.Key("message");
+    writer.String(message.data(), message.size());
+    writer.EndObject();
+    writer.EndObject();
+    return {buffer.GetString(), buffer.GetSize()};
+  }
+
+}  // namespace kagome::api
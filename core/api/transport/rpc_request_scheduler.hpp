@@ -0,0 +1,193 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_API_RPC_REQUEST_SCHEDULER_HPP
+#define KAGOME_CORE_API_RPC_REQUEST_SCHEDULER_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+
+#include "api/transport/session.hpp"
+#include "log/logger.hpp"
+#include "metrics/metrics.hpp"
+
+namespace kagome::api {
+
+  /**
+   * Execution lane of incoming RPC request.
+   * Lanes are served by separate threads, so slow requests of one lane do not
+   * delay requests of another one.
+   */
+  enum class RpcLane : uint8_t {
+    /// reads served by block tree and storage
+    kCheap = 0,
+    /// (un)subscriptions, served in order of arrival
+    kSubscription,
+    /// runtime calls and heavy storage iteration
+    kRuntime,
+  };
+
+  constexpr size_t kRpcLaneCount = 3;
+
+  /**
+   * @brief classifies RPC requests and executes them on prioritized lanes
+   * with per-session concurrency limit and queue deadlines
+   */
+  class RpcRequestScheduler final {
+   public:
+    struct Configuration {
+      size_t cheap_threads = 4;
+      size_t runtime_threads = 2;
+      /// single thread keeps (un)subscriptions of session ordered
+      size_t subscription_threads = 1;
+      /// max number of queued and running requests of one session
+      size_t max_session_requests = 16;
+      /// requests waiting in queue longer than deadline are rejected
+      std::chrono::milliseconds cheap_deadline{std::chrono::seconds{5}};
+      std::chrono::milliseconds runtime_deadline{std::chrono::seconds{30}};
+      std::chrono::milliseconds subscription_deadline{std::chrono::seconds{10}};
+    };
+
+    /**
+     * Routing info of request
+     */
+    struct RequestInfo {
+      RpcLane lane = RpcLane::kCheap;
+      /// raw json of request id, empty if absent or batch request
+      std::string id;
+    };
+
+    using Task = std::function<void()>;
+    using OnReject = std::function<void(std::string_view response)>;
+
+    explicit RpcRequestScheduler(const Configuration &configuration);
+
+    ~RpcRequestScheduler();
+
+    /**
+     * @brief starts lane threads
+     */
+    void start();
+
+    /**
+     * @brief stops lane threads, queued requests are dropped and released
+     * from their session limits
+     */
+    void stop();
+
+    /**
+     * @return true after start and until stop begins
+     */
+    bool isStarted() const;
+
+    /**
+     * @return lane to execute method on
+     */
+    static RpcLane laneOf(std::string_view method);
+
+    /**
+     * Extracts method and id of single request, batch is routed to the
+     * heaviest lane of its requests.
+     */
+    static RequestInfo classify(std::string_view request);
+
+    /**
+     * Schedules `task` of the request on its lane.
+     * `reject` is called with json-rpc error response instead of `task`, if
+     * session exceeded its concurrency limit or request waited longer than
+     * lane deadline.
+     * Executes `task` inline if scheduler is not started.
+     * Requests of one session may run on different lanes, so their responses
+     * may arrive in other order than requests were sent. Clients match
+     * responses by id, as json-rpc allows. Requests of the same lane
+     * with single thread (subscriptions by default) keep their order.
+     */
+    void schedule(Session::SessionId session_id,
+                  std::string_view request,
+                  Task task,
+                  OnReject reject);
+
+    /**
+     * @return number of queued and running requests of session
+     */
+    size_t sessionRequests(Session::SessionId session_id) const;
+
+   private:
+    struct Lane {
+      std::chrono::milliseconds deadline;
+      size_t thread_number;
+      boost::asio::io_context io_context;
+      std::optional<boost::asio::executor_work_guard<
+          boost::asio::io_context::executor_type>>
+          work_guard;
+      std::vector<std::thread> threads;
+      metrics::Histogram *metric_queue_time = nullptr;
+    };
+
+    /**
+     * Holds request in session limit until destroyed, so request is released
+     * both after execution and when dropped from queue
+     */
+    class SessionSlot {
+     public:
+      SessionSlot(RpcRequestScheduler &scheduler,
+                  Session::SessionId session_id)
+          : scheduler_{&scheduler}, session_id_{session_id} {}
+      SessionSlot(SessionSlot &&other) noexcept
+          : scheduler_{std::exchange(other.scheduler_, nullptr)},
+            session_id_{other.session_id_} {}
+      SessionSlot(const SessionSlot &) = delete;
+      SessionSlot &operator=(const SessionSlot &) = delete;
+      SessionSlot &operator=(SessionSlot &&) = delete;
+      ~SessionSlot() {
+        if (scheduler_ != nullptr) {
+          scheduler_->releaseSession(session_id_);
+        }
+      }
+
+     private:
+      RpcRequestScheduler *scheduler_;
+      Session::SessionId session_id_;
+    };
+
+    bool acquireSession(Session::SessionId session_id);
+    void releaseSession(Session::SessionId session_id);
+
+    static std::string makeError(const std::string &id,
+                                 std::string_view message);
+
+    const Configuration config_;
+
+    // declared before lanes, so requests left in queues are released while
+    // counters are alive
+    mutable std::mutex sessions_mutex_;
+    std::unordered_map<Session::SessionId, size_t> session_requests_;
+
+    std::array<Lane, kRpcLaneCount> lanes_;
+    std::atomic_bool started_ = false;
+
+    metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
+    metrics::Counter *metric_session_limit_rejected_;
+    metrics::Counter *metric_deadline_rejected_;
+    metrics::Counter *metric_shutdown_dropped_;
+
+    log::Logger logger_ =
+        log::createLogger("RpcRequestScheduler", "rpc_transport");
+  };
+
+}  // namespace kagome::api
+
+#endif  // KAGOME_CORE_API_RPC_REQUEST_SCHEDULER_HPP
@@ -19,6 +19,7 @@
 #include "network/peering_config.hpp"
 #include "network/types/roles.hpp"
 #include "primitives/block_id.hpp"
+#include "storage/rocksdb/rocksdb_profile.hpp"
 #include "telemetry/endpoint.hpp"
 
 namespace kagome::application {
@@ -29,9 +30,19 @@ namespace kagome::application {
     primitives::BlockNumber from;
     primitives::BlockNumber to;
     uint16_t times;
+    /// directory to write chrome://tracing JSON of each block to, if any
+    std::optional<std::string> trace_dir;
   };
 
-  using BenchmarkConfigSection = std::variant<BlockBenchmarkConfig>;
+  struct ComponentBenchmarkConfig {
+    /// regex of benchmarks to run, all of them by default
+    std::optional<std::string> filter;
+    /// file to write JSON report to, the report is printed if not set
+    std::optional<std::string> out;
+  };
+
+  using BenchmarkConfigSection =
+      std::variant<BlockBenchmarkConfig, ComponentBenchmarkConfig>;
 
   /**
    * Parse and store application config.
@@ -233,6 +244,13 @@ namespace kagome::application {
      */
     virtual bool purgeWavmCache() const = 0;
 
+    /**
+     * Host API profiling settings
+     * @return std::nullopt if profiling is disabled, otherwise directory to
+     * dump per block profiles into (empty if only metrics are collected)
+     */
+    virtual std::optional<filesystem::path> hostApiProfilePath() const = 0;
+
     enum class OffchainWorkerMode { WhenValidating, Always, Never };
     /**
      * @return enum constant of the mode of run offchain workers
@@ -257,6 +275,11 @@ namespace kagome::application {
      */
     virtual uint32_t dbCacheSize() const = 0;
 
+    /**
+     * @return RocksDB tuning profile of each storage space
+     */
+    virtual const storage::RocksDbProfiles &dbProfiles() const = 0;
+
     /**
      * Optional phrase to use dev account (e.g. Alice and Bob)
      */
@@ -5,6 +5,7 @@
 
 #include "application/impl/app_configuration_impl.hpp"
 
+#include <array>
 #include <fstream>
 #include <limits>
 #include <regex>
@@ -100,6 +101,7 @@ namespace {
   const auto def_full_sync = "Full";
   const auto def_wasm_execution = "Interpreted";
   const uint32_t def_db_cache_size = 1024;
+  const auto def_db_profile = "legacy";
 
   /**
    * Generate once at run random node name if form of UUID
@@ -139,6 +141,49 @@ namespace {
     return std::nullopt;
   }
 
+  std::optional<kagome::storage::RocksDbProfiles> str_to_db_profiles(
+      std::string_view str) {
+    if (str == "legacy") {
+      return kagome::storage::legacyRocksDbProfiles();
+    }
+    if (str == "tuned") {
+      return kagome::storage::tunedRocksDbProfiles();
+    }
+    return std::nullopt;
+  }
+
+  /// Applies profile override in form of SPACE=PROFILE
+  bool parse_db_space_profile(std::string_view str,
+                              kagome::storage::RocksDbProfiles &profiles) {
+    using kagome::storage::Space;
+    static const std::array<std::pair<std::string_view, Space>, Space::kTotal>
+        spaces{{
+            {"default", Space::kDefault},
+            {"lookup_key", Space::kLookupKey},
+            {"header", Space::kHeader},
+            {"block_body", Space::kBlockBody},
+            {"justification", Space::kJustification},
+            {"trie_node", Space::kTrieNode},
+        }};
+    auto eq = str.find('=');
+    if (eq == std::string_view::npos) {
+      return false;
+    }
+    auto profile =
+        kagome::storage::rocksDbProfileFromString(str.substr(eq + 1));
+    if (not profile) {
+      return false;
+    }
+    auto space = str.substr(0, eq);
+    for (auto &[name, id] : spaces) {
+      if (name == space) {
+        profiles[id] = *profile;
+        return true;
+      }
+    }
+    return false;
+  }
+
   std::optional<AppConfiguration::AllowUnsafeRpc> parseAllowUnsafeRpc(
       std::string_view str) {
     if (str == "unsafe") {
@@ -248,7 +293,8 @@ namespace kagome::application {
         offchain_worker_mode_{def_offchain_worker_mode},
         enable_offchain_indexing_{def_enable_offchain_indexing},
         recovery_state_{def_block_to_recover},
-        db_cache_size_{def_db_cache_size} {
+        db_cache_size_{def_db_cache_size},
+        db_profiles_{*str_to_db_profiles(def_db_profile)} {
     SL_INFO(logger_, "Soramitsu Kagome started. Version: {} ", buildVersion());
   }
 
@@ -431,6 +477,18 @@ namespace kagome::application {
       }
     }
     load_u32(val, "db-cache", db_cache_size_);
+    std::string db_profile_str;
+    if (load_str(val, "db-profile", db_profile_str)) {
+      if (auto profiles = str_to_db_profiles(db_profile_str)) {
+        db_profiles_ = *profiles;
+      } else {
+        SL_ERROR(logger_,
+                 "Unsupported database profile was specified {}, "
+                 "available options are [legacy, tuned]",
+                 db_profile_str);
+        exit(EXIT_FAILURE);
+      }
+    }
   }
 
   void AppConfigurationImpl::parse_network_segment(
@@ -749,9 +807,12 @@ namespace kagome::application {
 
       if (argc > 1 && argv[1] == "block"sv) {
         subcommand = "block";
+      } else if (argc > 1 && argv[1] == "components"sv) {
+        subcommand = "components";
       } else {
         SL_ERROR(logger_, "Usage: kagome benchmark BENCHMARK_TYPE");
-        SL_ERROR(logger_, "The only supported BENCHMARK_TYPE is 'block'");
+        SL_ERROR(logger_,
+                 "Supported BENCHMARK_TYPEs are 'block' and 'components'");
         return false;
       }
     }
@@ -788,6 +849,8 @@ namespace kagome::application {
         ("tmp", "Use temporary storage path")
         ("database", po::value<std::string>()->default_value("rocksdb"), "Database backend to use [rocksdb]")
         ("db-cache", po::value<uint32_t>()->default_value(def_db_cache_size), "Limit the memory the database cache can use <MiB>")
+        ("db-profile", po::value<std::string>()->default_value(def_db_profile), "RocksDB tuning of storage spaces [legacy, tuned]")
+        ("db-space-profile", po::value<std::vector<std::string>>()->multitoken(), "Override RocksDB tuning of a storage space, SPACE=PROFILE. SPACE is one of default, lookup_key, header, block_body, justification, trie_node. PROFILE is one of legacy, point-lookup, sequential, large-values")
         ("enable-offchain-indexing", po::value<bool>(), "enable Offchain Indexing API, which allow block import to write to offchain DB)")
         ("recovery", po::value<std::string>(), "recovers block storage to state after provided block presented by number or hash, and stop after that")
         ;
@@ -835,12 +898,17 @@ namespace kagome::application {
           "choose the desired wasm execution method (Compiled, Interpreted)")
         ("unsafe-cached-wavm-runtime", "use WAVM runtime cache")
         ("purge-wavm-cache", "purge WAVM runtime cache")
+        ("profile-host-api", po::value<std::string>()->implicit_value(""),
+          "collect Host API call statistics as metrics and, if directory is given, dump them for each executed block")
         ;
     po::options_description benchmark_desc("Benchmark options");
     benchmark_desc.add_options()
       ("from", po::value<uint32_t>(), "set the initial block for block execution benchmark")
       ("to", po::value<uint32_t>(), "set the final block for block execution benchmark")
       ("repeat", po::value<uint16_t>(), "set the repetition number for block execution benchmark")
+      ("trace-dir", po::value<std::string>(), "directory to write chrome://tracing JSON of each executed block to")
+      ("filter", po::value<std::string>(), "regex of component benchmarks to run")
+      ("out", po::value<std::string>(), "file to write JSON report of component benchmarks to")
       ;
 
     po::options_description db_editor_desc("kagome db-editor - to view help message for db editor");
@@ -1051,6 +1119,30 @@ namespace kagome::application {
     find_argument<uint32_t>(
         vm, "db-cache", [&](uint32_t val) { db_cache_size_ = val; });
 
+    bool db_profile_value_error = false;
+    find_argument<std::string>(vm, "db-profile", [&](const std::string &val) {
+      if (auto profiles = str_to_db_profiles(val)) {
+        db_profiles_ = *profiles;
+      } else {
+        db_profile_value_error = true;
+        SL_ERROR(logger_, "Invalid database profile specified: '{}'", val);
+      }
+    });
+    find_argument<std::vector<std::string>>(
+        vm, "db-space-profile", [&](const std::vector<std::string> &val) {
+          for (auto &str : val) {
+            if (not parse_db_space_profile(str, db_profiles_)) {
+              db_profile_value_error = true;
+              SL_ERROR(logger_,
+                       "Invalid database space profile specified: '{}'",
+                       str);
+            }
+          }
+        });
+    if (db_profile_value_error) {
+      return false;
+    }
+
     std::vector<std::string> boot_nodes;
     find_argument<std::vector<std::string>>(
         vm, "bootnodes", [&](const std::vector<std::string> &val) {
@@ -1384,6 +1476,11 @@ namespace kagome::application {
       }
     }
 
+    find_argument<std::string>(
+        vm, "profile-host-api", [&](const std::string &val) {
+          host_api_profile_path_ = val;
+        });
+
     bool offchain_worker_value_error = false;
     find_argument<std::string>(
         vm,
@@ -1422,7 +1519,7 @@ namespace kagome::application {
         return false;
       }
       auto repeat_opt = find_argument<uint16_t>(vm, "repeat");
-      if (!to_opt) {
+      if (!repeat_opt) {
         SL_ERROR(logger_, "Required argument --repeat is not provided");
         return false;
       }
@@ -1430,6 +1527,13 @@ namespace kagome::application {
           .from = *from_opt,
           .to = *to_opt,
           .times = *repeat_opt,
+          .trace_dir = find_argument<std::string>(vm, "trace-dir"),
+      };
+    }
+    if (command == "benchmark" && subcommand == "components") {
+      benchmark_config_ = ComponentBenchmarkConfig{
+          .filter = find_argument<std::string>(vm, "filter"),
+          .out = find_argument<std::string>(vm, "out"),
       };
     }
 
@@ -166,6 +166,9 @@ namespace kagome::application {
     bool purgeWavmCache() const override {
       return purge_wavm_cache_;
     }
+    std::optional<filesystem::path> hostApiProfilePath() const override {
+      return host_api_profile_path_;
+    }
     OffchainWorkerMode offchainWorkerMode() const override {
       return offchain_worker_mode_;
     }
@@ -184,6 +187,9 @@ namespace kagome::application {
     uint32_t dbCacheSize() const override {
       return db_cache_size_;
     }
+    const storage::RocksDbProfiles &dbProfiles() const override {
+      return db_profiles_;
+    }
     std::optional<std::string_view> devMnemonicPhrase() const override {
       if (dev_mnemonic_phrase_) {
         return *dev_mnemonic_phrase_;
@@ -331,12 +337,14 @@ namespace kagome::application {
     RuntimeExecutionMethod runtime_exec_method_;
     bool use_wavm_cache_;
     bool purge_wavm_cache_;
+    std::optional<filesystem::path> host_api_profile_path_;
     OffchainWorkerMode offchain_worker_mode_;
     bool enable_offchain_indexing_;
     std::optional<Subcommand> subcommand_;
     std::optional<primitives::BlockId> recovery_state_;
     StorageBackend storage_backend_ = StorageBackend::RocksDB;
     uint32_t db_cache_size_;
+    storage::RocksDbProfiles db_profiles_;
     std::optional<std::string> dev_mnemonic_phrase_;
     std::string node_wss_pem_;
     std::optional<BenchmarkConfigSection> benchmark_config_;
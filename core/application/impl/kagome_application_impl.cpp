@@ -11,6 +11,7 @@
 #include "application/impl/util.hpp"
 #include "application/modes/print_chain_info_mode.hpp"
 #include "application/modes/recovery_mode.hpp"
+#include "host_api/host_api_profiler.hpp"
 #include "metrics/metrics.hpp"
 #include "telemetry/service.hpp"
 
@@ -49,7 +50,12 @@ namespace kagome::application {
 
     kagome::telemetry::setTelemetryService(injector_->injectTelemetryService());
 
+    if (auto path = app_config_->hostApiProfilePath()) {
+      host_api::HostApiProfiler::enable(*path);
+    }
+
     injector_->injectAddressPublisher();
+    injector_->injectRuntimePrecompiler();
 
     logger_->info("Start as node version '{}' named as '{}' with PID {}",
                   app_config_->nodeVersion(),
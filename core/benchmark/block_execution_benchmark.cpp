@@ -6,11 +6,22 @@
 #include "benchmark/block_execution_benchmark.hpp"
 
 #include <algorithm>
+#include <array>
+#include <fstream>
 #include <numeric>
 
+#include <boost/algorithm/string/predicate.hpp>
+
 #include "blockchain/block_tree.hpp"
+#include "filesystem/common.hpp"
+#include "host_api/host_api_profiler.hpp"
 #include "primitives/runtime_dispatch_info.hpp"
-#include "runtime/runtime_api/core.hpp"
+#include "runtime/common/executor.hpp"
+#include "runtime/instance_environment.hpp"
+#include "runtime/module_instance.hpp"
+#include "runtime/module_repository.hpp"
+#include "runtime/runtime_environment_factory.hpp"
+#include "runtime/trie_storage_provider.hpp"
 #include "storage/trie/trie_storage.hpp"
 
 OUTCOME_CPP_DEFINE_CATEGORY(kagome::benchmark,
@@ -65,19 +76,19 @@ namespace kagome::benchmark {
   using common::literals::operator""_hex2buf;
 
   BlockExecutionBenchmark::BlockExecutionBenchmark(
-      std::shared_ptr<runtime::Core> core_api,
+      std::shared_ptr<runtime::Executor> executor,
       std::shared_ptr<const blockchain::BlockTree> block_tree,
       std::shared_ptr<runtime::ModuleRepository> module_repo,
       std::shared_ptr<const runtime::RuntimeCodeProvider> code_provider,
       std::shared_ptr<const storage::trie::TrieStorage> trie_storage)
       : logger_{log::createLogger("BlockExecutionBenchmark", "benchmark")},
-        core_api_{core_api},
+        executor_{executor},
         block_tree_{block_tree},
         module_repo_{module_repo},
         code_provider_{code_provider},
         trie_storage_{trie_storage} {
     BOOST_ASSERT(block_tree_ != nullptr);
-    BOOST_ASSERT(core_api_ != nullptr);
+    BOOST_ASSERT(executor_ != nullptr);
     BOOST_ASSERT(module_repo_ != nullptr);
     BOOST_ASSERT(code_provider_ != nullptr);
     BOOST_ASSERT(trie_storage_ != nullptr);
@@ -216,7 +227,236 @@ namespace kagome::benchmark {
         / static_cast<double>(WEIGHT_REF_TIME_PER_NANOS)))};
   }
 
+  namespace {
+    /// Phases of block execution
+    enum class Phase : size_t {
+      // runtime environment is made in these phases one after another
+      kInstanceAcquire,
+      kStorageSetup,
+      kMemoryReset,
+      // call of Core_execute_block, consists of the phases below
+      kExecute,
+      kWasm,
+      kHostStorage,
+      kHostChildStorage,
+      kHostCrypto,
+      kHostHashing,
+      kHostTrieCommit,
+      kHostAllocator,
+      kHostOther,
+    };
+
+    constexpr size_t kPhases = static_cast<size_t>(Phase::kHostOther) + 1;
+
+    constexpr std::array<std::string_view, kPhases> kPhaseNames{
+        "instance_acquire",
+        "storage_setup",
+        "memory_reset",
+        "execute",
+        "wasm",
+        "host/storage",
+        "host/child_storage",
+        "host/crypto",
+        "host/hashing",
+        "host/trie_commit",
+        "host/allocator",
+        "host/other",
+    };
+
+    bool isHostCallPhase(Phase phase) {
+      return phase > Phase::kWasm;
+    }
+
+    Phase hostCallPhase(std::string_view function) {
+      using boost::starts_with;
+      // storage root is calculated while changes are committed into the trie
+      if (starts_with(function, "ext_storage_root_")
+          or starts_with(function, "ext_default_child_storage_root_")) {
+        return Phase::kHostTrieCommit;
+      }
+      if (starts_with(function, "ext_storage_")) {
+        return Phase::kHostStorage;
+      }
+      if (starts_with(function, "ext_default_child_storage_")) {
+        return Phase::kHostChildStorage;
+      }
+      if (starts_with(function, "ext_crypto_")) {
+        return Phase::kHostCrypto;
+      }
+      if (starts_with(function, "ext_hashing_")
+          or starts_with(function, "ext_trie_")) {
+        return Phase::kHostHashing;
+      }
+      if (starts_with(function, "ext_allocator_")) {
+        return Phase::kHostAllocator;
+      }
+      return Phase::kHostOther;
+    }
+  }  // namespace
+
+  struct BlockExecutionBenchmark::Run {
+    std::chrono::nanoseconds &time(Phase phase) {
+      return times[static_cast<size_t>(phase)];
+    }
+
+    std::chrono::nanoseconds time(Phase phase) const {
+      return times[static_cast<size_t>(phase)];
+    }
+
+    uint64_t &calls(Phase phase) {
+      return host_calls[static_cast<size_t>(phase)];
+    }
+
+    uint64_t calls(Phase phase) const {
+      return host_calls[static_cast<size_t>(phase)];
+    }
+
+    std::chrono::nanoseconds total() const {
+      return time(Phase::kInstanceAcquire) + time(Phase::kStorageSetup)
+           + time(Phase::kMemoryReset) + time(Phase::kExecute);
+    }
+
+    std::array<std::chrono::nanoseconds, kPhases> times{};
+    std::array<uint64_t, kPhases> host_calls{};
+  };
+
+  namespace {
+    using Run = BlockExecutionBenchmark::Run;
+
+    double toMicroseconds(std::chrono::nanoseconds time) {
+      return static_cast<double>(time.count()) / 1000.0;
+    }
+
+    /**
+     * Writes runs of block in chrome://tracing format, each run is a separate
+     * thread. Host API calls are aggregated by category, so their slices show
+     * total time of category inside of execution, not actual order of calls.
+     */
+    bool writeTrace(const filesystem::path &path,
+                    const primitives::BlockInfo &block,
+                    const std::vector<Run> &runs) {
+      std::ofstream out{path};
+      if (not out) {
+        return false;
+      }
+      bool first = true;
+      auto event = [&](std::string_view name,
+                       size_t tid,
+                       double ts,
+                       std::chrono::nanoseconds duration,
+                       std::optional<uint64_t> calls) {
+        out << fmt::format(
+            R"({}{{"name":"{}","cat":"block_{}","ph":"X","pid":1,"tid":{},)"
+            R"("ts":{:.3f},"dur":{:.3f},"args":{{{}}}}})",
+            first ? "" : ",",
+            name,
+            block.number,
+            tid,
+            ts,
+            toMicroseconds(duration),
+            calls ? fmt::format(R"("calls":{})", *calls) : "");
+        first = false;
+      };
+
+      out << R"({"traceEvents":[)";
+      for (size_t tid = 0; tid < runs.size(); ++tid) {
+        out << fmt::format(
+            R"({}{{"name":"thread_name","ph":"M","pid":1,"tid":{},)"
+            R"("args":{{"name":"{}"}}}})",
+            first ? "" : ",",
+            tid,
+            tid == 0 ? std::string{"cold run"}
+                     : fmt::format("warm run {}", tid));
+        first = false;
+
+        auto &run = runs[tid];
+        double ts = 0;
+        for (auto phase : {Phase::kInstanceAcquire,
+                           Phase::kStorageSetup,
+                           Phase::kMemoryReset,
+                           Phase::kExecute}) {
+          event(kPhaseNames[static_cast<size_t>(phase)],
+                tid,
+                ts,
+                run.time(phase),
+                std::nullopt);
+          if (phase != Phase::kExecute) {
+            ts += toMicroseconds(run.time(phase));
+          }
+        }
+        for (auto i = static_cast<size_t>(Phase::kWasm); i < kPhases; ++i) {
+          auto phase = static_cast<Phase>(i);
+          if (run.time(phase).count() == 0) {
+            continue;
+          }
+          event(kPhaseNames[i],
+                tid,
+                ts,
+                run.time(phase),
+                isHostCallPhase(phase) ? std::optional{run.calls(phase)}
+                                       : std::nullopt);
+          ts += toMicroseconds(run.time(phase));
+        }
+      }
+      out << "]}\n";
+      return static_cast<bool>(out);
+    }
+  }  // namespace
+
+  outcome::result<BlockExecutionBenchmark::Run>
+  BlockExecutionBenchmark::execute(const primitives::Block &block,
+                                   const primitives::BlockHeader &parent) {
+    using Clock = std::chrono::steady_clock;
+    Run run;
+    auto start = Clock::now();
+    // stores time since the previous phase and starts the next one
+    auto measure = [&](Phase phase) {
+      auto now = Clock::now();
+      run.time(phase) =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(now - start);
+      start = now;
+    };
+
+    // same steps as RuntimeEnvironmentTemplate::make() does
+    const primitives::BlockInfo parent_info{block.header.number - 1,
+                                            block.header.parent_hash};
+    OUTCOME_TRY(
+        instance,
+        module_repo_->getInstanceAt(code_provider_, parent_info, parent));
+    measure(Phase::kInstanceAcquire);
+
+    const auto &env = instance->getEnvironment();
+    OUTCOME_TRY(env.storage_provider->setToPersistentAt(parent.state_root,
+                                                        std::nullopt));
+    measure(Phase::kStorageSetup);
+
+    OUTCOME_TRY(runtime::resetMemory(*instance));
+    measure(Phase::kMemoryReset);
+
+    runtime::RuntimeEnvironment runtime_env{
+        instance, env.memory_provider, env.storage_provider, parent_info};
+    host_api::HostApiProfiler::BlockScope host_calls{parent_info, false};
+    OUTCOME_TRY(
+        executor_->call<void>(runtime_env, "Core_execute_block", block));
+    measure(Phase::kExecute);
+
+    std::chrono::nanoseconds host_time{0};
+    for (auto &call : host_calls.stats()) {
+      auto phase = hostCallPhase(call.function);
+      run.time(phase) += std::chrono::nanoseconds{call.nanoseconds};
+      run.calls(phase) += call.calls;
+      host_time += std::chrono::nanoseconds{call.nanoseconds};
+    }
+    auto execute_time = run.time(Phase::kExecute);
+    run.time(Phase::kWasm) = execute_time - std::min(host_time, execute_time);
+    return run;
+  }
+
   outcome::result<void> BlockExecutionBenchmark::run(const Config config) {
+    if (config.times == 0) {
+      SL_WARN(logger_, "Number of repetitions is zero, nothing to execute");
+      return outcome::success();
+    }
     OUTCOME_TRY_MSG(current_hash,
                     block_tree_->getBlockHash(config.start),
                     "retrieving hash of block {}",
@@ -225,6 +465,7 @@ namespace kagome::benchmark {
     primitives::BlockInfo current_block_info = {config.start, current_hash};
     std::vector<primitives::BlockHash> block_hashes;
     std::vector<primitives::Block> blocks;
+    std::vector<primitives::BlockHeader> parents;
     while (current_block_info.number <= config.end) {
       OUTCOME_TRY_MSG(current_block_header,
                       block_tree_->getBlockHeader(current_block_info.hash),
@@ -234,11 +475,18 @@ namespace kagome::benchmark {
                       block_tree_->getBlockBody(current_block_info.hash),
                       "block {}",
                       current_block_info);
+      OUTCOME_TRY_MSG(parent_header,
+                      block_tree_->getBlockHeader(
+                          current_block_header.parent_hash),
+                      "parent of block {}",
+                      current_block_info);
       primitives::Block current_block{std::move(current_block_header),
                                       std::move(current_block_body)};
       current_block.header.digest.pop_back();
+      current_block.header.hash_opt.reset();
       block_hashes.emplace_back(current_block_info.hash);
       blocks.emplace_back(std::move(current_block));
+      parents.emplace_back(std::move(parent_header));
       OUTCOME_TRY_MSG(next_hash,
                       block_tree_->getBlockHash(current_block_info.number + 1),
                       "retrieving hash of block {}",
@@ -247,60 +495,110 @@ namespace kagome::benchmark {
       current_block_info.hash = next_hash;
     }
 
-    std::chrono::steady_clock clock;
+    std::optional<filesystem::path> trace_dir;
+    if (config.trace_dir) {
+      trace_dir = *config.trace_dir;
+      std::error_code ec;
+      filesystem::create_directories(*trace_dir, ec);
+      if (ec) {
+        SL_ERROR(logger_,
+                 "Can't create directory {} for traces: {}",
+                 *config.trace_dir,
+                 ec.message());
+        return ec;
+      }
+    }
 
-    std::vector<Stats<std::chrono::nanoseconds>> duration_stats;
-    for (size_t i = 0; i < blocks.size(); i++) {
-      duration_stats.emplace_back(Stats<std::chrono::nanoseconds>{
-          primitives::BlockInfo{block_hashes[i], blocks[i].header.number}});
+    // time of Host API calls is collected by profiler
+    if (not host_api::HostApiProfiler::enabled()) {
+      host_api::HostApiProfiler::enable({});
     }
-    auto duration_stat_it = duration_stats.begin();
+
     for (size_t block_i = 0; block_i < blocks.size(); block_i++) {
-      OUTCOME_TRY(module_repo_->getInstanceAt(
-          code_provider_,
-          primitives::BlockInfo{block_hashes[block_i],
-                                blocks[block_i].header.number},
-          blocks[block_i].header));
+      const primitives::BlockInfo block_info{blocks[block_i].header.number,
+                                             block_hashes[block_i]};
+      // the first run is cold: runtime instance may be instantiated and state
+      // of the block is read from disk, following ones are warm
+      std::vector<Run> runs;
       for (uint16_t i = 0; i < config.times; i++) {
-        auto start = clock.now();
-        OUTCOME_TRY_MSG_VOID(
-            core_api_->execute_block(blocks[block_i], std::nullopt),
-            "execution of block {}",
-            block_hashes[i]);
-        auto end = clock.now();
-        auto duration_ns =
-            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
-        duration_stat_it->add(duration_ns);
+        OUTCOME_TRY_MSG(run,
+                        execute(blocks[block_i], parents[block_i]),
+                        "execution of block {}",
+                        block_info);
         SL_VERBOSE(logger_,
                    "Block #{}, {} ns",
-                   blocks[block_i].header.number,
-                   duration_ns.count());
+                   block_info.number,
+                   run.total().count());
+        runs.emplace_back(run);
       }
-      duration_stat_it++;
-    }
-    for (auto &stat : duration_stats) {
-      fmt::print("Block #{}, min {} ns, avg {} ns, median {} ns, max {} ns\n",
-                 stat.getBlock().number,
-                 stat.min().count(),
-                 stat.avg().count(),
-                 stat.median().count(),
-                 stat.max().count());
-      OUTCOME_TRY(
-          block_weight_ns,
-          getBlockWeightAsNanoseconds(
-              *trie_storage_,
-              blocks[stat.getBlock().number - config.start].header.state_root));
+
+      auto warm_begin =
+          runs.size() > 1 ? std::next(runs.begin()) : runs.begin();
+      Stats<std::chrono::nanoseconds> stat{block_info};
+      for (auto it = warm_begin; it != runs.end(); ++it) {
+        stat.add(it->total());
+      }
+      auto warm_avg = [&](Phase phase) {
+        std::chrono::nanoseconds sum{0};
+        for (auto it = warm_begin; it != runs.end(); ++it) {
+          sum += it->time(phase);
+        }
+        return sum / std::distance(warm_begin, runs.end());
+      };
+
+      fmt::print(
+          "Block #{}, cold {} ns, warm min {} ns, avg {} ns, median {} ns, "
+          "max {} ns\n",
+          block_info.number,
+          runs.front().total().count(),
+          stat.min().count(),
+          stat.avg().count(),
+          stat.median().count(),
+          stat.max().count());
+      fmt::print("  {:<20} {:>14} {:>14} {:>10}\n",
+                 "phase",
+                 "cold, ns",
+                 "warm avg, ns",
+                 "calls");
+      for (size_t i = 0; i < kPhases; ++i) {
+        auto phase = static_cast<Phase>(i);
+        auto &cold = runs.front();
+        if (isHostCallPhase(phase) and cold.calls(phase) == 0) {
+          continue;
+        }
+        fmt::print("  {:<20} {:>14} {:>14} {:>10}\n",
+                   kPhaseNames[i],
+                   cold.time(phase).count(),
+                   warm_avg(phase).count(),
+                   isHostCallPhase(phase) ? std::to_string(cold.calls(phase))
+                                          : "");
+      }
+
+      OUTCOME_TRY(block_weight_ns,
+                  getBlockWeightAsNanoseconds(
+                      *trie_storage_, blocks[block_i].header.state_root));
       fmt::print(
           "Block #{}: consumed {} ns out of declared {} ns on average. ({} %)\n",
-          stat.getBlock().number,
+          block_info.number,
           stat.avg().count(),
           block_weight_ns.count(),
           (static_cast<double>(stat.avg().count())
            / static_cast<double>(block_weight_ns.count()))
               * 100.0);
+
+      if (trace_dir) {
+        auto path =
+            *trace_dir / fmt::format("block_{}.json", block_info.number);
+        if (not writeTrace(path, block_info, runs)) {
+          SL_ERROR(logger_,
+                   "Can't write trace of block {} into {}",
+                   block_info,
+                   path.native());
+        }
+      }
     }
 
     return outcome::success();
   }
 
-}  // namespace kagome::benchmark
\ No newline at end of file
+}  // namespace kagome::benchmark
@@ -7,6 +7,8 @@
 #define KAGOME_BLOCK_EXECUTION_BENCHMARK_HPP
 
 #include <memory>
+#include <optional>
+#include <string>
 
 #include "log/logger.hpp"
 #include "outcome/outcome.hpp"
@@ -16,8 +18,13 @@ namespace kagome::blockchain {
   class BlockTree;
 }
 
+namespace kagome::primitives {
+  struct Block;
+  struct BlockHeader;
+}  // namespace kagome::primitives
+
 namespace kagome::runtime {
-  class Core;
+  class Executor;
   class ModuleRepository;
   class RuntimeCodeProvider;
 }  // namespace kagome::runtime
@@ -28,6 +35,13 @@ namespace kagome::storage::trie {
 
 namespace kagome::benchmark {
 
+  /**
+   * Executes range of stored blocks several times and reports time of
+   * execution against declared weight of each block. Time of the first
+   * (cold) run is reported separately from following (warm) ones and is
+   * broken down into phases: acquiring of runtime instance, setting up its
+   * storage and memory, wasm code itself and Host API calls by category.
+   */
   class BlockExecutionBenchmark {
    public:
     enum class Error {
@@ -38,20 +52,28 @@ namespace kagome::benchmark {
       primitives::BlockNumber start;
       primitives::BlockNumber end;
       uint16_t times;
+      /// directory to write chrome://tracing JSON of each block to, if any
+      std::optional<std::string> trace_dir;
     };
 
     BlockExecutionBenchmark(
-        std::shared_ptr<runtime::Core> core_api,
+        std::shared_ptr<runtime::Executor> executor,
         std::shared_ptr<const blockchain::BlockTree> block_tree,
         std::shared_ptr<runtime::ModuleRepository> module_repo,
         std::shared_ptr<const runtime::RuntimeCodeProvider> code_provider,
         std::shared_ptr<const storage::trie::TrieStorage> trie_storage);
 
+    /// timings of single execution of block
+    struct Run;
+
     outcome::result<void> run(Config config);
 
    private:
+    outcome::result<Run> execute(const primitives::Block &block,
+                                 const primitives::BlockHeader &parent);
+
     log::Logger logger_;
-    std::shared_ptr<runtime::Core> core_api_;
+    std::shared_ptr<runtime::Executor> executor_;
     std::shared_ptr<const blockchain::BlockTree> block_tree_;
     std::shared_ptr<runtime::ModuleRepository> module_repo_;
     std::shared_ptr<const runtime::RuntimeCodeProvider> code_provider_;
@@ -0,0 +1,466 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "benchmark/component_benchmark.hpp"
+
+#include <array>
+#include <cstring>
+#include <limits>
+#include <random>
+
+#include <benchmark/benchmark.h>
+#include <binaryen/wasm.h>
+
+#include "blockchain/block_storage.hpp"
+#include "blockchain/block_tree.hpp"
+#include "crypto/hasher.hpp"
+#include "filesystem/common.hpp"
+#include "host_api/host_api.hpp"
+#include "runtime/binaryen/instance_environment_factory.hpp"
+#include "runtime/binaryen/runtime_external_interface.hpp"
+#include "runtime/common/memory_allocator.hpp"
+#include "runtime/memory.hpp"
+#include "runtime/memory_provider.hpp"
+#include "scale/scale.hpp"
+#include "storage/in_memory/in_memory_storage.hpp"
+#include "storage/rocksdb/rocksdb.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+
+namespace kagome::benchmark {
+
+  namespace {
+    using common::Buffer;
+    using storage::trie::PolkadotCodec;
+    using storage::trie::PolkadotTrie;
+    using storage::trie::PolkadotTrieImpl;
+    using storage::trie::StateVersion;
+
+    /// entries of synthetic states
+    constexpr size_t kTrieEntries = 100'000;
+    /// entries of tries built in each iteration
+    constexpr size_t kSmallTrieEntries = 10'000;
+    /// entries of trie encoded by codec benchmarks
+    constexpr size_t kCodecTrieEntries = 1'000;
+    /// puts in RocksDB batch
+    constexpr size_t kRocksDbBatchSize = 1'000;
+    /// stored blocks decoded by block decoding benchmarks
+    constexpr size_t kDecodedBlocks = 256;
+
+    Buffer randomBuffer(std::mt19937_64 &rng, size_t size) {
+      Buffer buffer(size, 0);
+      for (auto &byte : buffer) {
+        byte = static_cast<uint8_t>(rng());
+      }
+      return buffer;
+    }
+
+    /// keys and values are shaped like storage entries, hashed keys
+    /// (32 bytes) with small values
+    struct Entries {
+      std::vector<Buffer> keys;
+      std::vector<Buffer> values;
+
+      Entries(size_t size, uint64_t seed) {
+        std::mt19937_64 rng{seed};
+        keys.reserve(size);
+        values.reserve(size);
+        for (size_t i = 0; i < size; ++i) {
+          keys.emplace_back(randomBuffer(rng, 32));
+          values.emplace_back(randomBuffer(rng, 64));
+        }
+      }
+    };
+
+    std::unique_ptr<PolkadotTrie> makeTrie(const Entries &entries,
+                                           size_t size) {
+      auto trie = std::make_unique<PolkadotTrieImpl>();
+      for (size_t i = 0; i < size; ++i) {
+        trie->put(entries.keys[i], Buffer{entries.values[i]}).value();
+      }
+      return trie;
+    }
+
+    /// database in a unique temporary directory, removed with the dataset
+    /// when benchmarks are unregistered
+    struct RocksDbDataset {
+      filesystem::path path;
+      std::shared_ptr<storage::RocksDb> db;
+      std::shared_ptr<storage::BufferStorage> space;
+      Entries entries{kTrieEntries, 1};
+
+      ~RocksDbDataset() {
+        // close database before its files are removed
+        space.reset();
+        db.reset();
+        std::error_code ec;
+        filesystem::remove_all(path, ec);
+      }
+    };
+  }  // namespace
+
+  ComponentBenchmark::ComponentBenchmark(
+      std::shared_ptr<crypto::Hasher> hasher,
+      std::shared_ptr<const blockchain::BlockTree> block_tree,
+      std::shared_ptr<const blockchain::BlockStorage> block_storage,
+      std::shared_ptr<runtime::binaryen::InstanceEnvironmentFactory>
+          binaryen_env_factory)
+      : logger_{log::createLogger("ComponentBenchmark", "benchmark")},
+        hasher_{std::move(hasher)},
+        block_tree_{std::move(block_tree)},
+        block_storage_{std::move(block_storage)},
+        binaryen_env_factory_{std::move(binaryen_env_factory)} {
+    BOOST_ASSERT(hasher_ != nullptr);
+    BOOST_ASSERT(block_tree_ != nullptr);
+    BOOST_ASSERT(block_storage_ != nullptr);
+    BOOST_ASSERT(binaryen_env_factory_ != nullptr);
+  }
+
+  outcome::result<void> ComponentBenchmark::run(const Config &config) {
+    registerTrieBenchmarks();
+    registerCodecBenchmarks();
+    registerHasherBenchmarks();
+    registerAllocatorBenchmarks();
+    registerHostApiBenchmarks();
+    OUTCOME_TRY(registerBlockDecodingBenchmarks());
+    registerRocksDbBenchmarks();
+
+    // report is produced by google benchmark, configured by its flags
+    std::vector<std::string> args{"kagome-benchmark"};
+    if (config.filter) {
+      args.emplace_back("--benchmark_filter=" + *config.filter);
+    }
+    if (config.out) {
+      args.emplace_back("--benchmark_out=" + *config.out);
+      args.emplace_back("--benchmark_out_format=json");
+    } else {
+      args.emplace_back("--benchmark_format=json");
+    }
+    std::vector<char *> argv;
+    for (auto &arg : args) {
+      argv.emplace_back(arg.data());
+    }
+    int argc = static_cast<int>(argv.size());
+    ::benchmark::Initialize(&argc, argv.data());
+    auto count = ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::ClearRegisteredBenchmarks();
+    SL_INFO(logger_, "{} component benchmarks are run", count);
+    return outcome::success();
+  }
+
+  void ComponentBenchmark::registerTrieBenchmarks() {
+    auto entries = std::make_shared<Entries>(kTrieEntries, 0);
+    std::shared_ptr<PolkadotTrie> trie = makeTrie(*entries, kTrieEntries);
+
+    ::benchmark::RegisterBenchmark(
+        "trie/insert", [entries](::benchmark::State &state) {
+          for (auto _ : state) {
+            state.PauseTiming();
+            auto trie = std::make_unique<PolkadotTrieImpl>();
+            state.ResumeTiming();
+            for (size_t i = 0; i < kSmallTrieEntries; ++i) {
+              trie->put(entries->keys[i], Buffer{entries->values[i]}).value();
+            }
+          }
+          state.SetItemsProcessed(state.iterations() * kSmallTrieEntries);
+        });
+
+    ::benchmark::RegisterBenchmark(
+        "trie/get", [entries, trie](::benchmark::State &state) {
+          size_t i = 0;
+          for (auto _ : state) {
+            auto value = trie->get(entries->keys[i++ % kTrieEntries]).value();
+            ::benchmark::DoNotOptimize(value.view().data());
+          }
+          state.SetItemsProcessed(state.iterations());
+        });
+
+    ::benchmark::RegisterBenchmark(
+        "trie/cursor", [trie](::benchmark::State &state) {
+          int64_t count = 0;
+          for (auto _ : state) {
+            auto cursor = trie->trieCursor();
+            cursor->seekFirst().value();
+            for (; cursor->isValid(); cursor->next().value()) {
+              ::benchmark::DoNotOptimize(cursor->value());
+              ++count;
+            }
+          }
+          state.SetItemsProcessed(count);
+        });
+
+    ::benchmark::RegisterBenchmark(
+        "trie/root", [entries](::benchmark::State &state) {
+          auto factory =
+              std::make_shared<storage::trie::PolkadotTrieFactoryImpl>();
+          auto codec = std::make_shared<PolkadotCodec>();
+          for (auto _ : state) {
+            state.PauseTiming();
+            auto trie = makeTrie(*entries, kSmallTrieEntries);
+            storage::trie::TrieSerializerImpl serializer{
+                factory,
+                codec,
+                std::make_shared<storage::trie::TrieStorageBackendImpl>(
+                    std::make_shared<storage::InMemoryStorage>())};
+            state.ResumeTiming();
+            ::benchmark::DoNotOptimize(
+                serializer.storeTrie(*trie, StateVersion::V1).value());
+          }
+          state.SetItemsProcessed(state.iterations() * kSmallTrieEntries);
+        });
+  }
+
+  void ComponentBenchmark::registerCodecBenchmarks() {
+    Entries entries{kCodecTrieEntries, 2};
+    std::shared_ptr<PolkadotTrie> trie = makeTrie(entries, kCodecTrieEntries);
+    auto codec = std::make_shared<PolkadotCodec>();
+    auto encoded = std::make_shared<Buffer>(
+        codec->encodeNode(*trie->getRoot(), StateVersion::V1, {}).value());
+
+    ::benchmark::RegisterBenchmark(
+        "codec/encode", [trie, codec](::benchmark::State &state) {
+          for (auto _ : state) {
+            ::benchmark::DoNotOptimize(
+                codec->encodeNode(*trie->getRoot(), StateVersion::V1, {})
+                    .value());
+          }
+          state.SetItemsProcessed(state.iterations() * kCodecTrieEntries);
+        });
+
+    ::benchmark::RegisterBenchmark(
+        "codec/decode", [encoded, codec](::benchmark::State &state) {
+          for (auto _ : state) {
+            ::benchmark::DoNotOptimize(codec->decodeNode(*encoded).value());
+          }
+          state.SetBytesProcessed(state.iterations() * encoded->size());
+        });
+  }
+
+  void ComponentBenchmark::registerHasherBenchmarks() {
+    using Hash = void (*)(const crypto::Hasher &, const Buffer &);
+    const std::vector<std::pair<std::string, Hash>> hashes{
+        {"blake2b_256",
+         [](auto &hasher, auto &data) {
+           ::benchmark::DoNotOptimize(hasher.blake2b_256(data));
+         }},
+        {"twox_128",
+         [](auto &hasher, auto &data) {
+           ::benchmark::DoNotOptimize(hasher.twox_128(data));
+         }},
+        {"keccak_256",
+         [](auto &hasher, auto &data) {
+           ::benchmark::DoNotOptimize(hasher.keccak_256(data));
+         }},
+        {"sha2_256",
+         [](auto &hasher, auto &data) {
+           ::benchmark::DoNotOptimize(hasher.sha2_256(data));
+         }},
+    };
+    for (auto &[name, hash] : hashes) {
+      ::benchmark::RegisterBenchmark(
+          ("hasher/" + name).c_str(),
+          [hasher = hasher_, hash = hash](::benchmark::State &state) {
+            std::mt19937_64 rng{3};
+            auto data = randomBuffer(rng, state.range(0));
+            for (auto _ : state) {
+              hash(*hasher, data);
+            }
+            state.SetBytesProcessed(state.iterations() * data.size());
+          })
+          // storage keys and extrinsics
+          ->Arg(32)
+          ->Arg(1024);
+    }
+  }
+
+  void ComponentBenchmark::registerAllocatorBenchmarks() {
+    ::benchmark::RegisterBenchmark(
+        "allocator/allocate_deallocate", [](::benchmark::State &state) {
+          std::vector<uint8_t> memory(runtime::kInitialMemorySize);
+          runtime::MemoryAllocator allocator{
+              runtime::MemoryAllocator::MemoryHandle{
+                  [&](size_t size) { memory.resize(size); },
+                  [&] { return memory.size(); },
+                  [&](runtime::WasmPointer ptr, uint32_t value) {
+                    std::memcpy(&memory[ptr], &value, sizeof(value));
+                  },
+                  [&](runtime::WasmPointer ptr) {
+                    uint32_t value;
+                    std::memcpy(&value, &memory[ptr], sizeof(value));
+                    return value;
+                  }},
+              runtime::kDefaultHeapBase};
+          // sizes of typical runtime allocations
+          constexpr std::array<runtime::WasmSize, 8> kSizes{
+              8, 16, 32, 33, 64, 128, 1024, 16384};
+          std::array<runtime::WasmPointer, kSizes.size()> ptrs{};
+          for (auto _ : state) {
+            for (size_t i = 0; i < kSizes.size(); ++i) {
+              ptrs[i] = allocator.allocate(kSizes[i]);
+            }
+            for (auto ptr : ptrs) {
+              allocator.deallocate(ptr);
+            }
+          }
+          state.SetItemsProcessed(state.iterations() * kSizes.size());
+        });
+  }
+
+  void ComponentBenchmark::registerHostApiBenchmarks() {
+    // shared environment, as benchmarks are run one by one
+    auto env =
+        std::make_shared<runtime::binaryen::BinaryenInstanceEnvironment>(
+            binaryen_env_factory_->make());
+    env->env.memory_provider->resetMemory(runtime::kDefaultHeapBase).value();
+    auto &memory = env->env.memory_provider->getCurrentMemory()->get();
+    std::mt19937_64 rng{4};
+    auto data = memory.storeBuffer(randomBuffer(rng, 32));
+
+    // the same functions are called directly and through binaryen imports
+    ::benchmark::RegisterBenchmark(
+        "host_api/direct/ext_logging_max_level_version_1",
+        [env](::benchmark::State &state) {
+          for (auto _ : state) {
+            ::benchmark::DoNotOptimize(
+                env->env.host_api->ext_logging_max_level_version_1());
+          }
+          state.SetItemsProcessed(state.iterations());
+        });
+    ::benchmark::RegisterBenchmark(
+        "host_api/direct/ext_hashing_twox_128_version_1",
+        [env, data](::benchmark::State &state) {
+          auto &host_api = *env->env.host_api;
+          for (auto _ : state) {
+            host_api.ext_allocator_free_version_1(
+                host_api.ext_hashing_twox_128_version_1(data));
+          }
+          state.SetItemsProcessed(state.iterations());
+        });
+
+    ::benchmark::RegisterBenchmark(
+        "host_api/binaryen/ext_logging_max_level_version_1",
+        [env](::benchmark::State &state) {
+          wasm::Function import;
+          import.module = "env";
+          import.base = "ext_logging_max_level_version_1";
+          wasm::LiteralList args;
+          for (auto _ : state) {
+            ::benchmark::DoNotOptimize(env->rei->callImport(&import, args));
+          }
+          state.SetItemsProcessed(state.iterations());
+        });
+    ::benchmark::RegisterBenchmark(
+        "host_api/binaryen/ext_hashing_twox_128_version_1",
+        [env, data](::benchmark::State &state) {
+          wasm::Function hash;
+          hash.module = "env";
+          hash.base = "ext_hashing_twox_128_version_1";
+          wasm::Function free;
+          free.module = "env";
+          free.base = "ext_allocator_free_version_1";
+          for (auto _ : state) {
+            wasm::LiteralList hash_args{
+                wasm::Literal{static_cast<int64_t>(data)}};
+            wasm::LiteralList free_args{
+                env->rei->callImport(&hash, hash_args)};
+            env->rei->callImport(&free, free_args);
+          }
+          state.SetItemsProcessed(state.iterations());
+        });
+  }
+
+  outcome::result<void> ComponentBenchmark::registerBlockDecodingBenchmarks() {
+    OUTCOME_TRY(hashes,
+                block_tree_->getDescendingChainToBlock(
+                    block_tree_->getLastFinalized().hash, kDecodedBlocks));
+    OUTCOME_TRY(blocks,
+                block_storage_->getEncodedBlocks(
+                    hashes,
+                    true,
+                    true,
+                    false,
+                    std::numeric_limits<size_t>::max()));
+    SL_INFO(logger_, "{} stored blocks are decoded", blocks.size());
+    auto encoded = std::make_shared<decltype(blocks)>(std::move(blocks));
+
+    ::benchmark::RegisterBenchmark(
+        "scale/decode_header", [encoded](::benchmark::State &state) {
+          int64_t bytes = 0;
+          for (auto _ : state) {
+            for (auto &block : *encoded) {
+              ::benchmark::DoNotOptimize(
+                  scale::decode<primitives::BlockHeader>(*block.header)
+                      .value());
+              bytes += block.header->size();
+            }
+          }
+          state.SetBytesProcessed(bytes);
+        });
+    ::benchmark::RegisterBenchmark(
+        "scale/decode_body", [encoded](::benchmark::State &state) {
+          int64_t bytes = 0;
+          for (auto _ : state) {
+            for (auto &block : *encoded) {
+              ::benchmark::DoNotOptimize(
+                  scale::decode<primitives::BlockBody>(*block.body).value());
+              bytes += block.body->size();
+            }
+          }
+          state.SetBytesProcessed(bytes);
+        });
+    return outcome::success();
+  }
+
+  void ComponentBenchmark::registerRocksDbBenchmarks() {
+    rocksdb::Options options;
+    options.create_if_missing = true;
+    auto data = std::make_shared<RocksDbDataset>();
+    data->path = filesystem::temp_directory_path()
+               / filesystem::unique_path("kagome_component_benchmark_%%%%%%%%");
+    data->db = storage::RocksDb::create(data->path, options).value();
+    data->space = data->db->getSpace(storage::Space::kTrieNode);
+    auto batch = data->space->batch();
+    for (size_t i = 0; i < kTrieEntries; ++i) {
+      batch->put(data->entries.keys[i], Buffer{data->entries.values[i]})
+          .value();
+    }
+    batch->commit().value();
+
+    ::benchmark::RegisterBenchmark(
+        "rocksdb/get", [data](::benchmark::State &state) {
+          size_t i = 0;
+          for (auto _ : state) {
+            auto value =
+                data->space->get(data->entries.keys[i++ % kTrieEntries])
+                    .value();
+            ::benchmark::DoNotOptimize(value.view().data());
+          }
+          state.SetItemsProcessed(state.iterations());
+        });
+
+    ::benchmark::RegisterBenchmark(
+        "rocksdb/batch", [data](::benchmark::State &state) {
+          std::mt19937_64 rng{5};
+          for (auto _ : state) {
+            state.PauseTiming();
+            std::vector<Buffer> keys;
+            for (size_t i = 0; i < kRocksDbBatchSize; ++i) {
+              keys.emplace_back(randomBuffer(rng, 32));
+            }
+            state.ResumeTiming();
+            auto batch = data->space->batch();
+            for (auto &key : keys) {
+              batch->put(key, Buffer{data->entries.values[0]}).value();
+            }
+            batch->commit().value();
+          }
+          state.SetItemsProcessed(state.iterations() * kRocksDbBatchSize);
+        });
+  }
+
+}  // namespace kagome::benchmark
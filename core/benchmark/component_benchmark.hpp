@@ -0,0 +1,74 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_COMPONENT_BENCHMARK_HPP
+#define KAGOME_COMPONENT_BENCHMARK_HPP
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "log/logger.hpp"
+#include "outcome/outcome.hpp"
+
+namespace kagome::blockchain {
+  class BlockStorage;
+  class BlockTree;
+}  // namespace kagome::blockchain
+
+namespace kagome::crypto {
+  class Hasher;
+}
+
+namespace kagome::runtime::binaryen {
+  class InstanceEnvironmentFactory;
+}
+
+namespace kagome::benchmark {
+
+  /**
+   * Micro-benchmarks of hot primitives and subsystems in isolation: trie,
+   * trie node codec, hashers, wasm allocator, Host API dispatch, decoding of
+   * stored blocks and RocksDB. Report is in JSON format of google benchmark,
+   * so reports of different commits may be compared by its compare.py
+   */
+  class ComponentBenchmark {
+   public:
+    struct Config {
+      /// regex of benchmarks to run, all of them by default
+      std::optional<std::string> filter;
+      /// file to write report to, the report is printed if not set
+      std::optional<std::string> out;
+    };
+
+    ComponentBenchmark(
+        std::shared_ptr<crypto::Hasher> hasher,
+        std::shared_ptr<const blockchain::BlockTree> block_tree,
+        std::shared_ptr<const blockchain::BlockStorage> block_storage,
+        std::shared_ptr<runtime::binaryen::InstanceEnvironmentFactory>
+            binaryen_env_factory);
+
+    outcome::result<void> run(const Config &config);
+
+   private:
+    void registerTrieBenchmarks();
+    void registerCodecBenchmarks();
+    void registerHasherBenchmarks();
+    void registerAllocatorBenchmarks();
+    void registerHostApiBenchmarks();
+    outcome::result<void> registerBlockDecodingBenchmarks();
+    void registerRocksDbBenchmarks();
+
+    log::Logger logger_;
+    std::shared_ptr<crypto::Hasher> hasher_;
+    std::shared_ptr<const blockchain::BlockTree> block_tree_;
+    std::shared_ptr<const blockchain::BlockStorage> block_storage_;
+    std::shared_ptr<runtime::binaryen::InstanceEnvironmentFactory>
+        binaryen_env_factory_;
+  };
+
+}  // namespace kagome::benchmark
+
+#endif  // KAGOME_COMPONENT_BENCHMARK_HPP
@@ -163,6 +163,20 @@ namespace kagome::blockchain {
     virtual outcome::result<std::optional<primitives::BlockData>> getBlockData(
         const primitives::BlockHash &block_hash) const = 0;
 
+    /**
+     * Reads requested parts of blocks {@param hashes} as they are stored,
+     * without decoding. Blocks are returned in the same order, up to the
+     * first block missing requested header or body, and while their total
+     * size fits {@param bytes_limit} (the first block is always returned)
+     * @returns encoded blocks or error
+     */
+    virtual outcome::result<std::vector<primitives::EncodedBlockData>>
+    getEncodedBlocks(const std::vector<primitives::BlockHash> &hashes,
+                     bool header,
+                     bool body,
+                     bool justification,
+                     size_t bytes_limit) const = 0;
+
     /**
      * Removes all data of block with hash {@param block_hash} from block
      * storage
@@ -5,6 +5,8 @@
 
 #include "blockchain/impl/block_storage_impl.hpp"
 
+#include <algorithm>
+
 #include "blockchain/block_storage_error.hpp"
 #include "blockchain/impl/storage_util.hpp"
 #include "common/visitor.hpp"
@@ -194,7 +196,9 @@ namespace kagome::blockchain {
   outcome::result<primitives::BlockHash> BlockStorageImpl::putBlockHeader(
       const primitives::BlockHeader &header) {
     OUTCOME_TRY(encoded_header, scale::encode(header));
-    auto block_hash = hasher_->blake2b_256(encoded_header);
+    auto block_hash = header.hash_opt.has_value()
+                        ? header.hash(*hasher_)
+                        : hasher_->blake2b_256(encoded_header);
     OUTCOME_TRY(putToSpace(
         *storage_, Space::kHeader, block_hash, std::move(encoded_header)));
     return block_hash;
@@ -209,6 +213,8 @@ namespace kagome::blockchain {
       OUTCOME_TRY(
           header,
           scale::decode<primitives::BlockHeader>(encoded_header_opt.value()));
+      // header is stored by its hash
+      header.hash_opt = block_hash;
       return std::move(header);
     }
     return std::nullopt;
@@ -281,15 +287,6 @@ namespace kagome::blockchain {
     // insert provided block's parts into the database
     OUTCOME_TRY(block_hash, putBlockHeader(block.header));
 
-    primitives::BlockData block_data;
-    block_data.hash = block_hash;
-    block_data.header = block.header;
-    block_data.body = block.body;
-
-    OUTCOME_TRY(encoded_header, scale::encode(block.header));
-    OUTCOME_TRY(putToSpace(
-        *storage_, Space::kHeader, block_hash, std::move(encoded_header)));
-
     OUTCOME_TRY(encoded_body, scale::encode(block.body));
     OUTCOME_TRY(putToSpace(
         *storage_, Space::kBlockBody, block_hash, std::move(encoded_body)));
@@ -301,6 +298,63 @@ namespace kagome::blockchain {
     return std::move(block_hash);
   }
 
+  outcome::result<std::vector<primitives::EncodedBlockData>>
+  BlockStorageImpl::getEncodedBlocks(
+      const std::vector<primitives::BlockHash> &hashes,
+      bool header,
+      bool body,
+      bool justification,
+      size_t bytes_limit) const {
+    using Values = std::vector<std::optional<common::BufferOrView>>;
+    std::vector<primitives::EncodedBlockData> blocks;
+    blocks.reserve(hashes.size());
+    size_t bytes = 0;
+    for (size_t offset = 0; offset < hashes.size();
+         offset += kReadAheadBlocks) {
+      auto count = std::min(kReadAheadBlocks, hashes.size() - offset);
+      std::vector<common::BufferView> keys;
+      keys.reserve(count);
+      for (size_t i = 0; i < count; ++i) {
+        keys.emplace_back(hashes[offset + i]);
+      }
+      auto read = [&](bool needed, Space space) -> outcome::result<Values> {
+        if (not needed) {
+          return Values(count);
+        }
+        return storage_->getSpace(space)->multiGet(keys);
+      };
+      OUTCOME_TRY(headers, read(header, Space::kHeader));
+      OUTCOME_TRY(bodies, read(body, Space::kBlockBody));
+      OUTCOME_TRY(justifications, read(justification, Space::kJustification));
+
+      for (size_t i = 0; i < count; ++i) {
+        if ((header and not headers[i]) or (body and not bodies[i])) {
+          return blocks;
+        }
+        size_t block_bytes = 0;
+        for (auto *value : {&headers[i], &bodies[i], &justifications[i]}) {
+          block_bytes += *value ? (*value)->size() : 0;
+        }
+        if (not blocks.empty() and bytes + block_bytes > bytes_limit) {
+          return blocks;
+        }
+        bytes += block_bytes;
+        auto &block = blocks.emplace_back(
+            primitives::EncodedBlockData{hashes[offset + i]});
+        if (headers[i]) {
+          block.header = headers[i]->into();
+        }
+        if (bodies[i]) {
+          block.body = bodies[i]->into();
+        }
+        if (justifications[i]) {
+          block.justification = justifications[i]->into();
+        }
+      }
+    }
+    return blocks;
+  }
+
   outcome::result<std::optional<primitives::BlockData>>
   BlockStorageImpl::getBlockData(
       const primitives::BlockHash &block_hash) const {
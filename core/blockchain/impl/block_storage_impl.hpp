@@ -95,10 +95,20 @@ namespace kagome::blockchain {
     outcome::result<std::optional<primitives::BlockData>> getBlockData(
         const primitives::BlockHash &block_hash) const override;
 
+    outcome::result<std::vector<primitives::EncodedBlockData>>
+    getEncodedBlocks(const std::vector<primitives::BlockHash> &hashes,
+                     bool header,
+                     bool body,
+                     bool justification,
+                     size_t bytes_limit) const override;
+
     outcome::result<void> removeBlock(
         const primitives::BlockHash &block_hash) override;
 
    private:
+    /// blocks read with one multi-get per space
+    static constexpr size_t kReadAheadBlocks = 16;
+
     BlockStorageImpl(std::shared_ptr<storage::SpacedStorage> storage,
                      std::shared_ptr<crypto::Hasher> hasher);
 
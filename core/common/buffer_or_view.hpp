@@ -8,12 +8,13 @@
 
 #include <boost/variant/get.hpp>
 #include <boost/variant/variant.hpp>
+#include <memory>
 #include <type_traits>
 
 #include "common/buffer.hpp"
 
 namespace kagome::common {
-  /// Moved owned buffer or readonly view.
+  /// Moved owned buffer or readonly view, optionally pinning viewed memory.
   class BufferOrView {
     using Span = gsl::span<const uint8_t>;
     template <typename T>
@@ -21,11 +22,22 @@ namespace kagome::common {
 
     struct Moved {};
 
+    /// View of memory kept alive by owner.
+    struct Pinned {
+      BufferView view;
+      std::shared_ptr<const void> owner;
+    };
+
    public:
     BufferOrView() = default;
 
     BufferOrView(const BufferView &view) : variant{view} {}
 
+    /// View of memory kept alive by `owner` (e.g. pinned database value), no
+    /// copy is made until `mut` or `into` is called.
+    BufferOrView(const BufferView &view, std::shared_ptr<const void> owner)
+        : variant{Pinned{view, std::move(owner)}} {}
+
     template <size_t N>
     BufferOrView(const std::array<uint8_t, N> &array)
         : variant{gsl::make_span(array)} {}
@@ -42,18 +54,21 @@ namespace kagome::common {
 
     /// Is buffer owned.
     bool owned() const {
-      if (variant.which() == 2) {
+      if (boost::get<Moved>(&variant) != nullptr) {
         throw std::logic_error{"Tried to use moved BufferOrView"};
       }
-      return variant.which() == 1;
+      return boost::get<Buffer>(&variant) != nullptr;
     }
 
     /// Get view.
     BufferView view() const {
-      if (!owned()) {
-        return boost::get<BufferView>(variant);
+      if (owned()) {
+        return BufferView{boost::get<Buffer>(variant)};
+      }
+      if (auto pinned = boost::get<Pinned>(&variant)) {
+        return pinned->view;
       }
-      return BufferView{boost::get<Buffer>(variant)};
+      return boost::get<BufferView>(variant);
     }
 
     /// Get view.
@@ -69,8 +84,7 @@ namespace kagome::common {
     /// Get mutable buffer reference. Copy once if view.
     Buffer &mut() {
       if (!owned()) {
-        auto view = boost::get<BufferView>(variant);
-        variant = Buffer{view};
+        variant = Buffer{view()};
       }
       return boost::get<Buffer>(variant);
     }
@@ -83,7 +97,7 @@ namespace kagome::common {
     }
 
    private:
-    boost::variant<BufferView, Buffer, Moved> variant;
+    boost::variant<BufferView, Buffer, Moved, Pinned> variant;
 
     template <typename T, typename = AsSpan<T>>
     friend bool operator==(const BufferOrView &l, const T &r) {
@@ -0,0 +1,62 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_COMMON_LRUSET
+#define KAGOME_COMMON_LRUSET
+
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+
+#include <boost/assert.hpp>
+
+namespace kagome::common {
+
+  /**
+   * Set of at most `capacity` values, which evicts the least recently added
+   * one when full
+   */
+  template <typename T, typename Hash = std::hash<T>>
+  class LruSet {
+   public:
+    explicit LruSet(size_t capacity) : capacity_{capacity} {
+      BOOST_ASSERT(capacity_ > 0);
+    }
+
+    /**
+     * Adds {@param value} or marks it as the most recent one
+     * @returns true if value was not in the set
+     */
+    bool add(const T &value) {
+      if (auto it = index_.find(value); it != index_.end()) {
+        order_.splice(order_.end(), order_, it->second);
+        return false;
+      }
+      if (index_.size() >= capacity_) {
+        index_.erase(order_.front());
+        order_.pop_front();
+      }
+      index_.emplace(value, order_.insert(order_.end(), value));
+      return true;
+    }
+
+    bool contains(const T &value) const {
+      return index_.count(value) != 0;
+    }
+
+    size_t size() const {
+      return index_.size();
+    }
+
+   private:
+    size_t capacity_;
+    /// values from the least to the most recent
+    std::list<T> order_;
+    std::unordered_map<T, typename std::list<T>::iterator, Hash> index_;
+  };
+
+}  // namespace kagome::common
+
+#endif  // KAGOME_COMMON_LRUSET
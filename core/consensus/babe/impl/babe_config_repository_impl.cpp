@@ -5,6 +5,7 @@
 
 #include "babe_config_repository_impl.hpp"
 
+
 #include "application/app_configuration.hpp"
 #include "application/app_state_manager.hpp"
 #include "babe_digests_util.hpp"
@@ -41,6 +42,8 @@ namespace kagome::consensus::babe {
         babe_api_(std::move(babe_api)),
         hasher_(std::move(hasher)),
         trie_storage_(std::move(trie_storage)),
+        digest_index_{storage::kBabeConfigRepoDigestIndexPrefix,
+                      persistent_storage_},
         chain_sub_([&] {
           BOOST_ASSERT(chain_events_engine != nullptr);
           return std::make_shared<primitives::events::ChainEventSubscriber>(
@@ -55,6 +58,7 @@ namespace kagome::consensus::babe {
     BOOST_ASSERT(hasher_ != nullptr);
 
     app_state_manager.atPrepare([this] { return prepare(); });
+    app_state_manager.atShutdown([this] { stop(); });
   }
 
   bool BabeConfigRepositoryImpl::prepare() {
@@ -83,15 +87,9 @@ namespace kagome::consensus::babe {
             if (auto self = wp.lock()) {
               const auto &header =
                   boost::get<primitives::events::HeadsEventParams>(event).get();
-              auto hash =
-                  self->hasher_->blake2b_256(scale::encode(header).value());
-
-              auto save_res = self->save();
-              if (save_res.has_error()) {
-                SL_WARN(self->logger_,
-                        "Can not save state at finalization: {}",
-                        save_res.error());
-              }
+              auto hash = header.hash(*self->hasher_);
+
+              self->digest_index_.writeInBackground(self->stateToSave());
               self->prune({header.number, hash});
             }
           }
@@ -215,9 +213,16 @@ namespace kagome::consensus::babe {
     const_cast<EpochLength &>(epoch_length_) = epoch_length;
 
     // 4. Apply digests before last finalized
+    OUTCOME_TRY(digest_index_.init(block_tree_->bestLeaf().number));
+    // Blocks imported before index was started are read one by one
+    const auto indexed_since =
+        digest_index_.indexedSince().value_or(finalized_block.number + 1);
+    const auto first_block_number = root_->block.number + 1;
+    const auto last_scanned_block_number =
+        std::min(finalized_block.number, indexed_since - 1);
     bool need_to_save = false;
-    for (auto block_number = root_->block.number + 1;
-         block_number <= finalized_block.number;
+    for (auto block_number = first_block_number;
+         block_number <= last_scanned_block_number;
          ++block_number) {
       auto block_hash_res = block_tree_->getBlockHash(block_number);
       if (block_hash_res.has_error()) {
@@ -227,55 +232,13 @@ namespace kagome::consensus::babe {
                 block_hash_res.error());
         return block_hash_res.as_failure();
       }
-      const auto &block_hash = block_hash_res.value();
+      const primitives::BlockInfo block{block_number, block_hash_res.value()};
 
-      auto block_header_res = block_tree_->getBlockHeader(block_hash);
-      if (block_header_res.has_error()) {
-        SL_WARN(logger_,
-                "Can't get header of an already finalized block #{}: {}",
-                block_number,
-                block_header_res.error());
-        return block_header_res.as_failure();
-      }
-      const auto &block_header = block_header_res.value();
-
-      primitives::BlockContext context{
-          .block_info = {block_number, block_hash}};
-
-      for (auto &item : block_header.digest) {
-        auto res = visit_in_place(
-            item,
-            [&](const primitives::PreRuntime &msg) -> outcome::result<void> {
-              if (msg.consensus_engine_id == primitives::kBabeEngineId) {
-                OUTCOME_TRY(digest_item,
-                            scale::decode<BabeBlockHeader>(msg.data));
-
-                return onDigest(context, digest_item);
-              }
-              return outcome::success();
-            },
-            [&](const primitives::Consensus &msg) -> outcome::result<void> {
-              if (msg.consensus_engine_id == primitives::kBabeEngineId) {
-                OUTCOME_TRY(digest_item,
-                            scale::decode<primitives::BabeDigest>(msg.data));
-
-                return onDigest(context, digest_item);
-              }
-              return outcome::success();
-            },
-            [](const auto &) { return outcome::success(); });
-        if (res.has_error()) {
-          SL_WARN(logger_,
-                  "Can't apply babe digest of finalized block {}: {}",
-                  context.block_info,
-                  res.error());
-          return res.as_failure();
-        }
-      }
+      OUTCOME_TRY(applyFinalizedDigests(block));
 
-      prune(context.block_info);
+      prune(block);
 
-      if (context.block_info.number % (kSavepointBlockInterval / 10) == 0) {
+      if (block.number % (kSavepointBlockInterval / 10) == 0) {
         // Make savepoint
         auto save_res = save();
         if (save_res.has_error()) {
@@ -288,6 +251,29 @@ namespace kagome::consensus::babe {
       }
     }
 
+    // Only blocks carrying babe consensus digests are read since index was
+    // started. Epoch is changed only by such blocks, as the first block of
+    // each epoch announces the next one.
+    if (indexed_since <= finalized_block.number
+        and first_block_number <= finalized_block.number) {
+      OUTCOME_TRY(indexed_blocks,
+                  digest_index_.get(std::max(first_block_number, indexed_since),
+                                    finalized_block.number));
+      SL_DEBUG(logger_,
+               "Applying digests of {} indexed finalized blocks",
+               indexed_blocks.size());
+      for (auto &block : indexed_blocks) {
+        OUTCOME_TRY(block_hash, block_tree_->getBlockHash(block.number));
+        // Block of discarded fork
+        if (block.hash != block_hash) {
+          continue;
+        }
+        OUTCOME_TRY(applyFinalizedDigests(block));
+        prune(block);
+      }
+      need_to_save = true;
+    }
+
     // Save state on finalized part of blockchain
     if (need_to_save) {
       if (auto save_res = save(); save_res.has_error()) {
@@ -393,7 +379,66 @@ namespace kagome::consensus::babe {
     return outcome::success();
   }
 
+  outcome::result<void> BabeConfigRepositoryImpl::applyFinalizedDigests(
+      const primitives::BlockInfo &block) {
+    auto block_header_res = block_tree_->getBlockHeader(block.hash);
+    if (block_header_res.has_error()) {
+      SL_WARN(logger_,
+              "Can't get header of an already finalized block {}: {}",
+              block,
+              block_header_res.error());
+      return block_header_res.as_failure();
+    }
+    const auto &block_header = block_header_res.value();
+
+    primitives::BlockContext context{.block_info = block};
+
+    for (auto &item : block_header.digest) {
+      auto res = visit_in_place(
+          item,
+          [&](const primitives::PreRuntime &msg) -> outcome::result<void> {
+            if (msg.consensus_engine_id == primitives::kBabeEngineId) {
+              OUTCOME_TRY(digest_item,
+                          scale::decode<BabeBlockHeader>(msg.data));
+
+              return onDigest(context, digest_item);
+            }
+            return outcome::success();
+          },
+          [&](const primitives::Consensus &msg) -> outcome::result<void> {
+            if (msg.consensus_engine_id == primitives::kBabeEngineId) {
+              OUTCOME_TRY(digest_item,
+                          scale::decode<primitives::BabeDigest>(msg.data));
+
+              return onDigest(context, digest_item);
+            }
+            return outcome::success();
+          },
+          [](const auto &) { return outcome::success(); });
+      if (res.has_error()) {
+        SL_WARN(logger_,
+                "Can't apply babe digest of finalized block {}: {}",
+                context.block_info,
+                res.error());
+        return res.as_failure();
+      }
+    }
+    return outcome::success();
+  }
+
   outcome::result<void> BabeConfigRepositoryImpl::save() {
+    for (auto &[key, value] : stateToSave()) {
+      OUTCOME_TRY(persistent_storage_->put(key, std::move(value)));
+    }
+    return outcome::success();
+  }
+
+  void BabeConfigRepositoryImpl::stop() {
+    // Wait for state saved in background
+    digest_index_.stop();
+  }
+
+  DigestIndex::StateEntries BabeConfigRepositoryImpl::stateToSave() {
     const auto finalized_block = block_tree_->getLastFinalized();
 
     BOOST_ASSERT(last_saved_state_block_ <= finalized_block.number);
@@ -401,67 +446,31 @@ namespace kagome::consensus::babe {
     auto saving_state_node = getNode({.block_info = finalized_block});
     BOOST_ASSERT_MSG(saving_state_node != nullptr,
                      "Finalized block must have associated node");
-    const auto saving_state_block = saving_state_node->block;
-
-    // Does not need to save
-    if (last_saved_state_block_ >= saving_state_block.number) {
-      return outcome::success();
-    }
-
-    const auto last_savepoint =
-        (last_saved_state_block_ / kSavepointBlockInterval)
-        * kSavepointBlockInterval;
-
-    const auto new_savepoint =
-        (saving_state_block.number / kSavepointBlockInterval)
-        * kSavepointBlockInterval;
-
-    // It's time to make savepoint
-    if (new_savepoint > last_savepoint) {
-      auto hash_res = header_repo_->getHashByNumber(new_savepoint);
-      if (hash_res.has_value()) {
-        primitives::BlockInfo savepoint_block(new_savepoint, hash_res.value());
-
-        auto ancestor_node = getNode({.block_info = savepoint_block});
-        if (ancestor_node != nullptr) {
-          auto node = ancestor_node->block == savepoint_block
-                        ? ancestor_node
-                        : ancestor_node->makeDescendant(savepoint_block);
-          auto res = persistent_storage_->put(
-              storage::kBabeConfigRepoStateLookupKey(new_savepoint),
-              storage::Buffer(scale::encode(node).value()));
-          if (res.has_error()) {
+
+    return digest_index_.stateToSave(
+        last_saved_state_block_,
+        saving_state_node,
+        [&](primitives::BlockNumber savepoint)
+            -> std::shared_ptr<BabeConfigNode> {
+          auto hash_res = header_repo_->getHashByNumber(savepoint);
+          if (hash_res.has_error()) {
             SL_WARN(logger_,
-                    "Can't make savepoint on block {}: {}",
-                    savepoint_block,
+                    "Can't take hash of savepoint block {}: {}",
+                    savepoint,
                     hash_res.error());
-            return res.as_failure();
+            return nullptr;
           }
-          SL_DEBUG(logger_, "Savepoint has made on block {}", savepoint_block);
-        }
-      } else {
-        SL_WARN(logger_,
-                "Can't take hash of savepoint block {}: {}",
-                new_savepoint,
-                hash_res.error());
-      }
-    }
-
-    auto res = persistent_storage_->put(
-        storage::kBabeConfigRepoStateLookupKey("last"),
-        storage::Buffer(scale::encode(saving_state_node).value()));
-    if (res.has_error()) {
-      SL_WARN(logger_,
-              "Can't save last state on block {}: {}",
-              saving_state_block,
-              res.error());
-      return res.as_failure();
-    }
-    SL_DEBUG(logger_, "Last state has saved on block {}", saving_state_block);
-
-    last_saved_state_block_ = saving_state_block.number;
-
-    return outcome::success();
+          primitives::BlockInfo savepoint_block(savepoint, hash_res.value());
+          auto ancestor_node = getNode({.block_info = savepoint_block});
+          if (ancestor_node == nullptr
+              or ancestor_node->block == savepoint_block) {
+            return ancestor_node;
+          }
+          return ancestor_node->makeDescendant(savepoint_block);
+        },
+        [](const auto &tag) {
+          return storage::kBabeConfigRepoStateLookupKey(tag);
+        });
   }
 
   std::optional<std::reference_wrapper<const primitives::BabeConfiguration>>
@@ -523,6 +532,7 @@ namespace kagome::consensus::babe {
   outcome::result<void> BabeConfigRepositoryImpl::onDigest(
       const primitives::BlockContext &context,
       const primitives::BabeDigest &digest) {
+    digest_index_.add(context.block_info);
     return visit_in_place(
         digest,
         [&](const primitives::NextEpochData &msg) -> outcome::result<void> {
@@ -876,9 +886,10 @@ namespace kagome::consensus::babe {
       config->randomness = next_epoch->randomness;
       root_->next_config = config;
     }
-    OUTCOME_TRY(
-        persistent_storage_->put(storage::kBabeConfigRepoStateLookupKey("last"),
-                                 scale::encode(root_).value()));
+    DigestIndex::StateEntries entries;
+    entries.emplace_back(storage::kBabeConfigRepoStateLookupKey("last"),
+                         storage::Buffer(scale::encode(root_).value()));
+    digest_index_.writeInBackground(std::move(entries));
     SL_INFO(logger_, "Read state at {}", block);
     return outcome::success();
   }
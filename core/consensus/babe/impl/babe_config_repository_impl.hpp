@@ -11,6 +11,7 @@
 #include "consensus/babe/babe_util.hpp"
 
 #include "consensus/babe/impl/babe_config_node.hpp"
+#include "consensus/digest_index.hpp"
 #include "log/logger.hpp"
 #include "primitives/block_data.hpp"
 #include "primitives/event_types.hpp"
@@ -41,7 +42,8 @@ namespace kagome::consensus::babe {
         public BabeDigestObserver,
         public BabeUtil,
         public std::enable_shared_from_this<BabeConfigRepositoryImpl> {
-    static const primitives::BlockNumber kSavepointBlockInterval = 100000;
+    static const primitives::BlockNumber kSavepointBlockInterval =
+        DigestIndex::kSavepointBlockInterval;
 
    public:
     BabeConfigRepositoryImpl(
@@ -58,6 +60,8 @@ namespace kagome::consensus::babe {
 
     bool prepare();
 
+    void stop();
+
     // BabeDigestObserver
 
     outcome::result<void> onDigest(const primitives::BlockContext &context,
@@ -98,6 +102,13 @@ namespace kagome::consensus::babe {
 
    private:
     outcome::result<void> load();
+
+    outcome::result<void> applyFinalizedDigests(
+        const primitives::BlockInfo &block);
+
+    /// Encodes state of finalized block and savepoint, if they are not saved
+    DigestIndex::StateEntries stateToSave();
+
     outcome::result<void> save();
 
     void prune(const primitives::BlockInfo &block);
@@ -139,6 +150,7 @@ namespace kagome::consensus::babe {
     std::shared_ptr<runtime::BabeApi> babe_api_;
     std::shared_ptr<crypto::Hasher> hasher_;
     std::shared_ptr<storage::trie::TrieStorage> trie_storage_;
+    DigestIndex digest_index_;
     std::shared_ptr<primitives::events::ChainEventSubscriber> chain_sub_;
 
     const BabeDuration slot_duration_{};
@@ -296,8 +296,7 @@ namespace kagome::consensus::babe {
               and self->current_state_ != Babe::State::STATE_LOADING) {
             const auto &header =
                 boost::get<primitives::events::HeadsEventParams>(event).get();
-            auto hash =
-                self->hasher_->blake2b_256(scale::encode(header).value());
+            auto hash = header.hash(*self->hasher_);
 
             auto version_res = self->runtime_core_->version(hash);
             if (version_res.has_value()) {
@@ -543,8 +542,7 @@ namespace kagome::consensus::babe {
     if (current_state_ == Babe::State::SYNCHRONIZED
         or current_state_ == Babe::State::HEADERS_LOADED) {
       if (announce.header.number > current_best_block.number + 1) {
-        auto block_hash =
-            hasher_->blake2b_256(scale::encode(announce.header).value());
+        auto block_hash = announce.header.hash(*hasher_);
         const primitives::BlockInfo announced_block(announce.header.number,
                                                     block_hash);
         startCatchUp(peer_id, announced_block);
@@ -1228,6 +1226,7 @@ namespace kagome::consensus::babe {
 
     // add seal digest item
     block.header.digest.emplace_back(seal_res.value());
+    const auto block_hash = block.header.updateHash(*hasher_);
 
     if (babe_util_->remainToFinishOfSlot(current_slot_ + kMaxBlockSlotsOvertime)
             .count()
@@ -1241,8 +1240,6 @@ namespace kagome::consensus::babe {
       return;
     }
 
-    const auto block_hash =
-        hasher_->blake2b_256(scale::encode(block.header).value());
     const primitives::BlockInfo block_info(block.header.number, block_hash);
 
     auto last_finalized_block = block_tree_->getLastFinalized();
@@ -51,7 +51,7 @@ namespace kagome::consensus::babe {
 
   primitives::BlockContext BlockAppenderBase::makeBlockContext(
       const primitives::BlockHeader &header) const {
-    auto block_hash = hasher_->blake2b_256(scale::encode(header).value());
+    auto block_hash = header.hash(*hasher_);
     return primitives::BlockContext{
         .block_info = {header.number, block_hash},
         .header = header,
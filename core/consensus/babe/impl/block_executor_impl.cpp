@@ -16,6 +16,7 @@
 #include "consensus/babe/impl/threshold_util.hpp"
 #include "consensus/grandpa/voting_round_error.hpp"
 #include "consensus/validation/block_validator.hpp"
+#include "host_api/host_api_profiler.hpp"
 #include "runtime/runtime_api/core.hpp"
 #include "runtime/runtime_api/offchain_worker_api.hpp"
 #include "storage/changes_trie/impl/storage_changes_tracker_impl.hpp"
@@ -141,23 +142,27 @@ namespace kagome::consensus::babe {
       auto changes_tracker =
           std::make_shared<storage::changes_trie::StorageChangesTrackerImpl>();
 
-      if (auto res = core_->execute_block_ref(
-              primitives::BlockReflection{
-                  .header =
-                      primitives::BlockHeaderReflection{
-                          .parent_hash = block.header.parent_hash,
-                          .number = block.header.number,
-                          .state_root = block.header.state_root,
-                          .extrinsics_root = block.header.extrinsics_root,
-                          .digest = gsl::span<const primitives::DigestItem>(
-                              block.header.digest.data(),
-                              block.header.digest.size() - 1ull),
-                      },
-                  .body = block.body,
-              },
-              changes_tracker);
-          res.has_error()) {
-        callback(res.as_failure());
+      outcome::result<void> execute_res = outcome::success();
+      {
+        host_api::HostApiProfiler::BlockScope host_api_profile{block_info};
+        execute_res = core_->execute_block_ref(
+            primitives::BlockReflection{
+                .header =
+                    primitives::BlockHeaderReflection{
+                        .parent_hash = block.header.parent_hash,
+                        .number = block.header.number,
+                        .state_root = block.header.state_root,
+                        .extrinsics_root = block.header.extrinsics_root,
+                        .digest = gsl::span<const primitives::DigestItem>(
+                            block.header.digest.data(),
+                            block.header.digest.size() - 1ull),
+                    },
+                .body = block.body,
+            },
+            changes_tracker);
+      }
+      if (execute_res.has_error()) {
+        callback(execute_res.as_failure());
         return;
       }
 
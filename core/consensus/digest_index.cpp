@@ -0,0 +1,121 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/digest_index.hpp"
+
+#include <future>
+
+#include <boost/endian/conversion.hpp>
+
+namespace kagome::consensus {
+
+  namespace {
+    // Entry keys are big-endian block number followed by block hash, so
+    // entries are ordered by block number. Empty key keeps the first indexed
+    // block number.
+    constexpr size_t kNumberSize = sizeof(primitives::BlockNumber);
+
+    common::Buffer numberKey(primitives::BlockNumber number) {
+      common::Buffer key(kNumberSize, 0);
+      boost::endian::store_big_u32(key.data(), number);
+      return key;
+    }
+
+    common::Buffer entryKey(const primitives::BlockInfo &block) {
+      auto key = numberKey(block.number);
+      key.put(block.hash);
+      return key;
+    }
+  }  // namespace
+
+  DigestIndex::DigestIndex(common::BufferView prefix,
+                           std::shared_ptr<storage::BufferStorage> storage)
+      : map_{prefix, std::move(storage)},
+        logger_{log::createLogger("DigestIndex", "consensus")},
+        write_thread_{std::make_shared<ThreadPool>(1ull)} {}
+
+  outcome::result<void> DigestIndex::init(primitives::BlockNumber best_block) {
+    if (map_.map->cursor() == nullptr) {
+      return outcome::success();
+    }
+    OUTCOME_TRY(since, map_.tryGet({}));
+    if (since.has_value() and since->size() == kNumberSize) {
+      since_ = boost::endian::load_big_u32(since->view().data());
+    } else {
+      since_ = best_block + 1;
+    }
+    // Entries are written in background and may be lost on crash, so the
+    // first indexed block is kept only while index is stopped gracefully.
+    // After crash index is started anew.
+    return map_.remove({});
+  }
+
+  std::optional<primitives::BlockNumber> DigestIndex::indexedSince() const {
+    return since_;
+  }
+
+  void DigestIndex::add(const primitives::BlockInfo &block) {
+    if (not since_.has_value()) {
+      return;
+    }
+    StateEntries entries;
+    entries.emplace_back(map_._key(entryKey(block)), common::Buffer{});
+    writeInBackground(std::move(entries));
+  }
+
+  outcome::result<std::vector<primitives::BlockInfo>> DigestIndex::get(
+      primitives::BlockNumber from, primitives::BlockNumber to) const {
+    std::vector<primitives::BlockInfo> blocks;
+    if (not since_.has_value() or from > to) {
+      return blocks;
+    }
+    auto cursor = map_.cursor();
+    OUTCOME_TRY(cursor->seek(numberKey(from)));
+    while (cursor->isValid()) {
+      auto key = *cursor->key();
+      if (key.size() == kNumberSize + primitives::BlockHash::size()) {
+        auto number = boost::endian::load_big_u32(key.data());
+        if (number > to) {
+          break;
+        }
+        OUTCOME_TRY(hash,
+                    primitives::BlockHash::fromSpan(key.view(kNumberSize)));
+        blocks.emplace_back(number, hash);
+      }
+      OUTCOME_TRY(cursor->next());
+    }
+    return blocks;
+  }
+
+  void DigestIndex::writeInBackground(StateEntries entries) {
+    if (entries.empty()) {
+      return;
+    }
+    write_thread_->io_context()->post([storage = map_.map,
+                                       entries = std::move(entries),
+                                       logger = logger_]() mutable {
+      for (auto &[key, value] : entries) {
+        auto res = storage->put(key, std::move(value));
+        if (res.has_error()) {
+          SL_WARN(logger, "Can't save state: {}", res.error());
+          return;
+        }
+      }
+    });
+  }
+
+  void DigestIndex::stop() {
+    std::promise<void> written;
+    write_thread_->io_context()->post([&written] { written.set_value(); });
+    written.get_future().wait();
+    if (since_.has_value()) {
+      auto res = map_.put({}, numberKey(*since_));
+      if (res.has_error()) {
+        SL_WARN(logger_, "Can't save digest index: {}", res.error());
+      }
+    }
+  }
+
+}  // namespace kagome::consensus
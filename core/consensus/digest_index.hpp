@@ -0,0 +1,125 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CONSENSUS_DIGEST_INDEX_HPP
+#define KAGOME_CONSENSUS_DIGEST_INDEX_HPP
+
+#include <optional>
+#include <vector>
+
+#include "log/logger.hpp"
+#include "primitives/common.hpp"
+#include "scale/scale.hpp"
+#include "storage/map_prefix/prefix.hpp"
+#include "utils/thread_pool.hpp"
+
+namespace kagome::consensus {
+
+  /**
+   * Persisted index of blocks carrying digests, which change state of some
+   * consensus component (epoch changes, authority set changes).
+   * It lets the component replay after restart only indexed blocks, instead
+   * of header of every block finalized since the last saved state.
+   * Index is complete only for blocks imported after it was started, see
+   * `indexedSince`, and only if it was stopped before process exit.
+   * Entries of blocks of discarded forks are not removed, so caller must
+   * check that returned block is in the chain.
+   * Index entries and savepoints of component state are written to storage
+   * by a dedicated thread in order of calls, so import thread does not wait
+   * for the database.
+   */
+  class DigestIndex {
+   public:
+    /// Blocks number between savepoints of component state
+    static constexpr primitives::BlockNumber kSavepointBlockInterval = 100000;
+
+    /// Keys and encoded states to be saved
+    using StateEntries = std::vector<std::pair<common::Buffer, common::Buffer>>;
+
+    DigestIndex(common::BufferView prefix,
+                std::shared_ptr<storage::BufferStorage> storage);
+
+    /**
+     * Loads index or starts a new one, if it did not exist.
+     * Blocks above \param best_block are not imported yet, so will be indexed.
+     * Does nothing for storage without cursors, the index stays disabled.
+     */
+    outcome::result<void> init(primitives::BlockNumber best_block);
+
+    /// Number of the first block since which every block is indexed
+    std::optional<primitives::BlockNumber> indexedSince() const;
+
+    /// Marks \param block as carrying digests, entry is written in background
+    void add(const primitives::BlockInfo &block);
+
+    /// Indexed blocks with numbers in [from, to] in ascending order
+    outcome::result<std::vector<primitives::BlockInfo>> get(
+        primitives::BlockNumber from, primitives::BlockNumber to) const;
+
+    /**
+     * Encodes state of the last finalized block and savepoint, if they are not
+     * saved yet
+     * @param last_saved_block number of block, which state was saved last,
+     * updated to the block of returned state
+     * @param finalized_node node of state of the last finalized block
+     * @param savepoint_node makes node of state of savepoint block by its
+     * number, nullptr if there is none
+     * @param key makes storage key of state by savepoint number or "last"
+     */
+    template <typename NodePtr, typename SavepointNode, typename Key>
+    StateEntries stateToSave(primitives::BlockNumber &last_saved_block,
+                             const NodePtr &finalized_node,
+                             const SavepointNode &savepoint_node,
+                             const Key &key) const {
+      StateEntries entries;
+      const auto saving_state_block = finalized_node->block;
+
+      // Does not need to save
+      if (last_saved_block >= saving_state_block.number) {
+        return entries;
+      }
+
+      const auto last_savepoint = (last_saved_block / kSavepointBlockInterval)
+                                * kSavepointBlockInterval;
+
+      const auto new_savepoint =
+          (saving_state_block.number / kSavepointBlockInterval)
+          * kSavepointBlockInterval;
+
+      // It's time to make savepoint
+      if (new_savepoint > last_savepoint) {
+        if (auto node = savepoint_node(new_savepoint)) {
+          entries.emplace_back(key(new_savepoint),
+                               common::Buffer(scale::encode(node).value()));
+          SL_DEBUG(logger_, "Savepoint is made on block {}", node->block);
+        }
+      }
+
+      entries.emplace_back(
+          key("last"), common::Buffer(scale::encode(finalized_node).value()));
+      SL_DEBUG(logger_, "Last state is made on block {}", saving_state_block);
+
+      last_saved_block = saving_state_block.number;
+
+      return entries;
+    }
+
+    /// Writes \param entries in background, in order of calls
+    void writeInBackground(StateEntries entries);
+
+    /// Waits for entries written in background and marks index complete
+    void stop();
+
+   private:
+    mutable storage::MapPrefix map_;
+    std::optional<primitives::BlockNumber> since_;
+    log::Logger logger_;
+    // the last member, so thread is joined before others are destroyed
+    std::shared_ptr<ThreadPool> write_thread_;
+  };
+
+}  // namespace kagome::consensus
+
+#endif  // KAGOME_CONSENSUS_DIGEST_INDEX_HPP
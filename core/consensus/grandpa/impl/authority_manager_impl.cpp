@@ -46,6 +46,8 @@ namespace kagome::consensus::grandpa {
         persistent_storage_{
             persistent_storage->getSpace(storage::Space::kDefault)},
         header_repo_{std::move(header_repo)},
+        digest_index_{storage::kAuthorityManagerDigestIndexPrefix,
+                      persistent_storage_},
         chain_sub_([&] {
           BOOST_ASSERT(chain_events_engine != nullptr);
           return std::make_shared<primitives::events::ChainEventSubscriber>(
@@ -83,15 +85,9 @@ namespace kagome::consensus::grandpa {
             if (auto self = wp.lock()) {
               const auto &header =
                   boost::get<primitives::events::HeadsEventParams>(event).get();
-              auto hash =
-                  self->hasher_->blake2b_256(scale::encode(header).value());
-
-              auto save_res = self->save();
-              if (save_res.has_error()) {
-                SL_WARN(self->logger_,
-                        "Can not save state at finalization: {}",
-                        save_res.error());
-              }
+              auto hash = header.hash(*self->hasher_);
+
+              self->digest_index_.writeInBackground(self->stateToSave());
               self->prune({header.number, hash});
             }
           }
@@ -196,12 +192,19 @@ namespace kagome::consensus::grandpa {
     fixKusamaHardFork(block_tree_->getGenesisBlockHash(), *root_);
 
     // 4. Apply digests before last finalized
+    OUTCOME_TRY(digest_index_.init(block_tree_->bestLeaf().number));
+    // Blocks imported before index was started are read one by one
+    const auto indexed_since =
+        digest_index_.indexedSince().value_or(finalized_block.number + 1);
+    const auto first_block_number = root_->block.number + 1;
     bool need_to_save = false;
     if (auto n = finalized_block.number - root_->block.number; n > 0) {
       SL_DEBUG(logger_, "Applying digests of {} finalized blocks", n);
     }
-    for (auto block_number = root_->block.number + 1;
-         block_number <= finalized_block.number;
+    const auto last_scanned_block_number =
+        std::min(finalized_block.number, indexed_since - 1);
+    for (auto block_number = first_block_number;
+         block_number <= last_scanned_block_number;
          ++block_number) {
       auto block_hash_res = block_tree_->getBlockHash(block_number);
       if (block_hash_res.has_error()) {
@@ -211,58 +214,13 @@ namespace kagome::consensus::grandpa {
                 block_hash_res.error());
         return block_hash_res.as_failure();
       }
-      const auto &block_hash = block_hash_res.value();
-
-      auto block_header_res = block_tree_->getBlockHeader(block_hash);
-      if (block_header_res.has_error()) {
-        SL_WARN(logger_,
-                "Can't get header of an already finalized block #{}: {}",
-                block_number,
-                block_header_res.error());
-        return block_header_res.as_failure();
-      }
-      const auto &block_header = block_header_res.value();
-
-      primitives::BlockContext context{
-          .block_info = {block_number, block_hash},
-          .header = block_header,
-      };
+      const primitives::BlockInfo block{block_number, block_hash_res.value()};
 
-      for (auto &item : block_header.digest) {
-        auto res = visit_in_place(
-            item,
-            [&](const primitives::PreRuntime &msg) -> outcome::result<void> {
-              if (msg.consensus_engine_id == primitives::kBabeEngineId) {
-                OUTCOME_TRY(
-                    digest_item,
-                    scale::decode<consensus::babe::BabeBlockHeader>(msg.data));
-
-                return onDigest(context, digest_item);
-              }
-              return outcome::success();
-            },
-            [&](const primitives::Consensus &msg) -> outcome::result<void> {
-              if (msg.consensus_engine_id == primitives::kGrandpaEngineId) {
-                OUTCOME_TRY(digest_item,
-                            scale::decode<primitives::GrandpaDigest>(msg.data));
-
-                return onDigest(context, digest_item);
-              }
-              return outcome::success();
-            },
-            [](const auto &) { return outcome::success(); });
-        if (res.has_error()) {
-          SL_WARN(logger_,
-                  "Can't apply grandpa digest of finalized block #{}: {}",
-                  block_number,
-                  res);
-          return res.as_failure();
-        }
-      }
+      OUTCOME_TRY(applyFinalizedDigests(block));
 
-      prune(context.block_info);
+      prune(block);
 
-      if (context.block_info.number % (kSavepointBlockInterval / 10) == 0) {
+      if (block.number % (kSavepointBlockInterval / 10) == 0) {
         // Make savepoint
         auto save_res = save();
         if (save_res.has_error()) {
@@ -275,6 +233,27 @@ namespace kagome::consensus::grandpa {
       }
     }
 
+    // Only blocks carrying grandpa digests are read since index was started
+    if (indexed_since <= finalized_block.number
+        and first_block_number <= finalized_block.number) {
+      OUTCOME_TRY(indexed_blocks,
+                  digest_index_.get(std::max(first_block_number, indexed_since),
+                                    finalized_block.number));
+      SL_DEBUG(logger_,
+               "Applying digests of {} indexed finalized blocks",
+               indexed_blocks.size());
+      for (auto &block : indexed_blocks) {
+        OUTCOME_TRY(block_hash, block_tree_->getBlockHash(block.number));
+        // Block of discarded fork
+        if (block.hash != block_hash) {
+          continue;
+        }
+        OUTCOME_TRY(applyFinalizedDigests(block));
+        prune(block);
+      }
+      need_to_save = true;
+    }
+
     // Save state on finalized part of blockchain
     if (need_to_save) {
       if (auto save_res = save(); save_res.has_error()) {
@@ -386,7 +365,70 @@ namespace kagome::consensus::grandpa {
     return outcome::success();
   }
 
+  outcome::result<void> AuthorityManagerImpl::applyFinalizedDigests(
+      const primitives::BlockInfo &block) {
+    auto block_header_res = block_tree_->getBlockHeader(block.hash);
+    if (block_header_res.has_error()) {
+      SL_WARN(logger_,
+              "Can't get header of an already finalized block {}: {}",
+              block,
+              block_header_res.error());
+      return block_header_res.as_failure();
+    }
+    const auto &block_header = block_header_res.value();
+
+    primitives::BlockContext context{
+        .block_info = block,
+        .header = block_header,
+    };
+
+    for (auto &item : block_header.digest) {
+      auto res = visit_in_place(
+          item,
+          [&](const primitives::PreRuntime &msg) -> outcome::result<void> {
+            if (msg.consensus_engine_id == primitives::kBabeEngineId) {
+              OUTCOME_TRY(
+                  digest_item,
+                  scale::decode<consensus::babe::BabeBlockHeader>(msg.data));
+
+              return onDigest(context, digest_item);
+            }
+            return outcome::success();
+          },
+          [&](const primitives::Consensus &msg) -> outcome::result<void> {
+            if (msg.consensus_engine_id == primitives::kGrandpaEngineId) {
+              OUTCOME_TRY(digest_item,
+                          scale::decode<primitives::GrandpaDigest>(msg.data));
+
+              return onDigest(context, digest_item);
+            }
+            return outcome::success();
+          },
+          [](const auto &) { return outcome::success(); });
+      if (res.has_error()) {
+        SL_WARN(logger_,
+                "Can't apply grandpa digest of finalized block {}: {}",
+                block,
+                res);
+        return res.as_failure();
+      }
+    }
+    return outcome::success();
+  }
+
   outcome::result<void> AuthorityManagerImpl::save() {
+    for (auto &[key, value] : stateToSave()) {
+      OUTCOME_TRY(persistent_storage_->put(key, std::move(value)));
+    }
+    return outcome::success();
+  }
+
+  void AuthorityManagerImpl::stop() {
+    // Wait for state saved in background
+    digest_index_.stop();
+  }
+
+  DigestIndex::StateEntries AuthorityManagerImpl::stateToSave() {
     const auto finalized_block = block_tree_->getLastFinalized();
 
     BOOST_ASSERT(last_saved_state_block_ <= finalized_block.number);
@@ -394,68 +436,32 @@ namespace kagome::consensus::grandpa {
     auto saving_state_node = getNode({.block_info = finalized_block});
     BOOST_ASSERT_MSG(saving_state_node != nullptr,
                      "Finalized block must have associated node");
-    const auto saving_state_block = saving_state_node->block;
 
-    // Does not need to save
-    if (last_saved_state_block_ >= saving_state_block.number) {
-      return outcome::success();
-    }
-
-    const auto last_savepoint =
-        (last_saved_state_block_ / kSavepointBlockInterval)
-        * kSavepointBlockInterval;
-
-    const auto new_savepoint =
-        (saving_state_block.number / kSavepointBlockInterval)
-        * kSavepointBlockInterval;
-
-    // It's time to make savepoint
-    if (new_savepoint > last_savepoint) {
-      auto hash_res = header_repo_->getHashByNumber(new_savepoint);
-      if (hash_res.has_value()) {
-        primitives::BlockInfo savepoint_block(new_savepoint, hash_res.value());
-
-        auto ancestor_node = getNode({.block_info = savepoint_block});
-        if (ancestor_node != nullptr) {
-          auto node = ancestor_node->block == savepoint_block
-                        ? ancestor_node
-                        : ancestor_node->makeDescendant(savepoint_block,
-                                                        IsBlockFinalized{true});
-          auto res = persistent_storage_->put(
-              storage::kAuthorityManagerStateLookupKey(new_savepoint),
-              storage::Buffer(scale::encode(node).value()));
-          if (res.has_error()) {
+    return digest_index_.stateToSave(
+        last_saved_state_block_,
+        saving_state_node,
+        [&](primitives::BlockNumber savepoint)
+            -> std::shared_ptr<ScheduleNode> {
+          auto hash_res = header_repo_->getHashByNumber(savepoint);
+          if (hash_res.has_error()) {
             SL_WARN(logger_,
-                    "Can't make savepoint on block {}: {}",
-                    savepoint_block,
+                    "Can't take hash of savepoint block {}: {}",
+                    savepoint,
                     hash_res.error());
-            return res.as_failure();
+            return nullptr;
           }
-          SL_DEBUG(logger_, "Savepoint has made on block {}", savepoint_block);
-        }
-      } else {
-        SL_WARN(logger_,
-                "Can't take hash of savepoint block {}: {}",
-                new_savepoint,
-                hash_res.error());
-      }
-    }
-
-    auto res = persistent_storage_->put(
-        storage::kAuthorityManagerStateLookupKey("last"),
-        storage::Buffer(scale::encode(saving_state_node).value()));
-    if (res.has_error()) {
-      SL_WARN(logger_,
-              "Can't save last state on block {}: {}",
-              saving_state_block,
-              res.error());
-      return res.as_failure();
-    }
-    SL_DEBUG(logger_, "Last state has saved on block {}", saving_state_block);
-
-    last_saved_state_block_ = saving_state_block.number;
-
-    return outcome::success();
+          primitives::BlockInfo savepoint_block(savepoint, hash_res.value());
+          auto ancestor_node = getNode({.block_info = savepoint_block});
+          if (ancestor_node == nullptr
+              or ancestor_node->block == savepoint_block) {
+            return ancestor_node;
+          }
+          return ancestor_node->makeDescendant(savepoint_block,
+                                               IsBlockFinalized{true});
+        },
+        [](const auto &tag) {
+          return storage::kAuthorityManagerStateLookupKey(tag);
+        });
   }
 
   primitives::BlockInfo AuthorityManagerImpl::base() const {
@@ -870,6 +876,7 @@ namespace kagome::consensus::grandpa {
   outcome::result<void> AuthorityManagerImpl::onDigest(
       const primitives::BlockContext &context,
       const primitives::GrandpaDigest &digest) {
+    digest_index_.add(context.block_info);
     return visit_in_place(
         digest,
         [this, &context](
@@ -1082,10 +1089,10 @@ namespace kagome::consensus::grandpa {
       };
       fixKusamaHardFork(block_tree_->getGenesisBlockHash(), *root_);
     }
-    persistent_storage_
-        ->put(storage::kAuthorityManagerStateLookupKey("last"),
-              scale::encode(root_).value())
-        .value();
+    DigestIndex::StateEntries entries;
+    entries.emplace_back(storage::kAuthorityManagerStateLookupKey("last"),
+                         storage::Buffer(scale::encode(root_).value()));
+    digest_index_.writeInBackground(std::move(entries));
     last_saved_state_block_ = block.number;
   }
 }  // namespace kagome::consensus::grandpa
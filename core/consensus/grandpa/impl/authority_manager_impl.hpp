@@ -9,6 +9,7 @@
 #include "consensus/grandpa/authority_manager.hpp"
 #include "consensus/grandpa/grandpa_digest_observer.hpp"
 
+#include "consensus/digest_index.hpp"
 #include "log/logger.hpp"
 #include "primitives/authority.hpp"
 #include "primitives/block_header.hpp"
@@ -51,7 +52,8 @@ namespace kagome::consensus::grandpa {
     inline static const std::vector<primitives::ConsensusEngineId>
         kKnownEngines{primitives::kBabeEngineId, primitives::kGrandpaEngineId};
 
-    static const primitives::BlockNumber kSavepointBlockInterval = 100000;
+    static const primitives::BlockNumber kSavepointBlockInterval =
+        DigestIndex::kSavepointBlockInterval;
 
     struct Config {
       // Whether OnDisabled digest message should be processed.
@@ -75,6 +77,8 @@ namespace kagome::consensus::grandpa {
 
     bool prepare();
 
+    void stop();
+
     // GrandpaDigestObserver
 
     outcome::result<void> onDigest(
@@ -127,6 +131,13 @@ namespace kagome::consensus::grandpa {
     void prune(const primitives::BlockInfo &block);
 
     outcome::result<void> load();
+
+    outcome::result<void> applyFinalizedDigests(
+        const primitives::BlockInfo &block);
+
+    /// Encodes state of finalized block and savepoint, if they are not saved
+    DigestIndex::StateEntries stateToSave();
+
     outcome::result<void> save();
 
     /**
@@ -155,6 +166,7 @@ namespace kagome::consensus::grandpa {
     std::shared_ptr<crypto::Hasher> hasher_;
     std::shared_ptr<storage::BufferStorage> persistent_storage_;
     std::shared_ptr<blockchain::BlockHeaderRepository> header_repo_;
+    DigestIndex digest_index_;
     std::shared_ptr<primitives::events::ChainEventSubscriber> chain_sub_;
 
     std::shared_ptr<ScheduleNode> root_;
@@ -124,6 +124,7 @@ namespace kagome::consensus::babe {
     // digest
     auto unsealed_header = header;
     unsealed_header.digest.pop_back();
+    unsealed_header.hash_opt.reset();
 
     auto unsealed_header_encoded = scale::encode(unsealed_header).value();
 
@@ -11,6 +11,10 @@
 
 #include "blake2b.h"
 
+#include <cstring>
+
+#include "blake2b_simd.h"
+
 namespace kagome::crypto {
 
   // Cyclic right rotation.
@@ -55,57 +59,91 @@ namespace kagome::crypto {
                                          0x1F83D9ABFB41BD6B,
                                          0x5BE0CD19137E2179};
 
-  // Compression function. "last" flag indicates last block.
-
-  static void blake2b_compress(blake2b_ctx *ctx, int last) {
-    const uint8_t sigma[12][16] = {
-        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
-        {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
-        {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
-        {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
-        {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
-        {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
-        {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
-        {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
-        {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
-        {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
-        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
-        {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3}};
+  static const uint8_t blake2b_sigma[12][16] = {
+      {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+      {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+      {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+      {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+      {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+      {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+      {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+      {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+      {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+      {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+      {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+      {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3}};
+
+  // Compression function of portable implementation.
+  //      "t" is number of bytes including the block, "f" is ~0 for the last
+  //      block.
+
+  static void blake2b_compress_ref(uint64_t h[8],
+                                   const uint64_t m[16],
+                                   uint64_t t,
+                                   uint64_t f) {
     int i;
     uint64_t v[16];
-    uint64_t m[16];
 
     for (i = 0; i < 8; i++) {  // init work variables
-      v[i] = ctx->h[i];
+      v[i] = h[i];
       v[i + 8] = blake2b_iv[i];
     }
 
-    v[12] ^= ctx->t[0];  // low 64 bits of offset
-    v[13] ^= ctx->t[1];  // high 64 bits
-    if (last) {          // last block flag set ?
-      v[14] = ~v[14];
+    v[12] ^= t;  // low 64 bits of offset, high bits are always zero
+    v[14] ^= f;  // last block flag
+
+    for (i = 0; i < 12; i++) {  // twelve rounds
+      const uint8_t *sigma = blake2b_sigma[i];
+      B2B_G(0, 4, 8, 12, m[sigma[0]], m[sigma[1]]);
+      B2B_G(1, 5, 9, 13, m[sigma[2]], m[sigma[3]]);
+      B2B_G(2, 6, 10, 14, m[sigma[4]], m[sigma[5]]);
+      B2B_G(3, 7, 11, 15, m[sigma[6]], m[sigma[7]]);
+      B2B_G(0, 5, 10, 15, m[sigma[8]], m[sigma[9]]);
+      B2B_G(1, 6, 11, 12, m[sigma[10]], m[sigma[11]]);
+      B2B_G(2, 7, 8, 13, m[sigma[12]], m[sigma[13]]);
+      B2B_G(3, 4, 9, 14, m[sigma[14]], m[sigma[15]]);
     }
 
-    for (i = 0; i < 16; i++) {  // get little-endian words
-      m[i] = B2B_GET64(&ctx->b[8 * i]);
+    for (i = 0; i < 8; ++i) {
+      h[i] ^= v[i] ^ v[i + 8];
     }
+  }
 
-    for (i = 0; i < 12; i++) {  // twelve rounds
-      B2B_G(0, 4, 8, 12, m[sigma[i][0]], m[sigma[i][1]]);
-      B2B_G(1, 5, 9, 13, m[sigma[i][2]], m[sigma[i][3]]);
-      B2B_G(2, 6, 10, 14, m[sigma[i][4]], m[sigma[i][5]]);
-      B2B_G(3, 7, 11, 15, m[sigma[i][6]], m[sigma[i][7]]);
-      B2B_G(0, 5, 10, 15, m[sigma[i][8]], m[sigma[i][9]]);
-      B2B_G(1, 6, 11, 12, m[sigma[i][10]], m[sigma[i][11]]);
-      B2B_G(2, 7, 8, 13, m[sigma[i][12]], m[sigma[i][13]]);
-      B2B_G(3, 4, 9, 14, m[sigma[i][14]], m[sigma[i][15]]);
+  using blake2b_compress_fn = void (*)(uint64_t h[8],
+                                       const uint64_t m[16],
+                                       uint64_t t,
+                                       uint64_t f);
+
+  // Picks the fastest compression function supported by CPU.
+
+  static blake2b_compress_fn blake2b_select_compress() {
+#ifdef KAGOME_BLAKE2B_X86
+    if (blake2b_simd::avx2Supported()) {
+      return blake2b_simd::compressAvx2;
     }
+#endif
+    return blake2b_compress_ref;
+  }
 
-    for (i = 0; i < 8; ++i) {
-      ctx->h[i] ^= v[i] ^ v[i + 8];
+  // Loads little-endian words of the block.
+
+  static void blake2b_load(uint64_t m[16], const uint8_t *block) {
+    for (int i = 0; i < 16; i++) {
+      m[i] = B2B_GET64(block + 8 * i);
     }
   }
 
+  // Compression function. "last" flag indicates last block.
+
+  static void blake2b_compress(blake2b_ctx *ctx,
+                               const uint8_t *block,
+                               int last) {
+    static const blake2b_compress_fn compress = blake2b_select_compress();
+    uint64_t m[16];
+    blake2b_load(m, block);
+    compress(ctx->h, m, ctx->t[0], last ? ~uint64_t{0} : 0);
+  }
+
   // Initialize the hashing context "ctx" with optional key "key".
   //      1 <= outlen <= 64 gives the digest size in bytes.
   //      Secret key (also <= 64 bytes) is optional (keylen = 0).
@@ -148,18 +186,36 @@ namespace kagome::crypto {
                       const void *in,
                       size_t inlen)  // data bytes
   {
-    size_t i;
+    const uint8_t *data = (const uint8_t *)in;
 
-    for (i = 0; i < inlen; i++) {
+    while (inlen > 0) {
       if (ctx->c == 128) {         // buffer full ?
         ctx->t[0] += ctx->c;       // add counters
         if (ctx->t[0] < ctx->c) {  // carry overflow ?
           ctx->t[1]++;             // high word
         }
-        blake2b_compress(ctx, 0);  // compress (not last)
-        ctx->c = 0;                // counter to zero
+        blake2b_compress(ctx, ctx->b, 0);  // compress (not last)
+        ctx->c = 0;                        // counter to zero
+      }
+      // whole blocks are compressed in place, unless it could be the last
+      // one, which has to stay in the buffer till final
+      while (ctx->c == 0 && inlen > 128) {
+        ctx->t[0] += 128;
+        if (ctx->t[0] < 128) {
+          ctx->t[1]++;
+        }
+        blake2b_compress(ctx, data, 0);
+        data += 128;
+        inlen -= 128;
+      }
+      size_t n = 128 - ctx->c;
+      if (n > inlen) {
+        n = inlen;
       }
-      ctx->b[ctx->c++] = ((const uint8_t *)in)[i];
+      memcpy(ctx->b + ctx->c, data, n);
+      ctx->c += n;
+      data += n;
+      inlen -= n;
     }
   }
 
@@ -177,7 +233,7 @@ namespace kagome::crypto {
     while (ctx->c < 128) {  // fill up with zeros
       ctx->b[ctx->c++] = 0;
     }
-    blake2b_compress(ctx, 1);  // final block flag = 1
+    blake2b_compress(ctx, ctx->b, 1);  // final block flag = 1
 
     // little endian convert and store
     for (i = 0; i < ctx->outlen; i++) {
@@ -204,4 +260,122 @@ namespace kagome::crypto {
     return 0;
   }
 
+  // Hash messages in "N" lanes. Lane takes the next message as soon as its
+  //      previous one is finished, so messages of different length are
+  //      packed tightly.
+
+  template <size_t N>
+  static void blake2b_lanes(void (*compress)(blake2b_simd::Lanes<N> &),
+                            uint8_t *out,
+                            size_t outlen,
+                            const void *const *in,
+                            const size_t *inlen,
+                            size_t count) {
+    blake2b_simd::Lanes<N> lanes;
+    size_t message[N];  // message of lane, "count" if lane is idle
+    size_t offset[N];   // bytes of message compressed
+    size_t next = 0;
+    size_t busy = 0;
+    uint8_t block[128];
+    size_t i, lane;
+
+    auto start = [&](size_t lane) {
+      if (next == count) {
+        message[lane] = count;
+        return;
+      }
+      message[lane] = next++;
+      offset[lane] = 0;
+      for (i = 0; i < 8; i++) {
+        lanes.h[i][lane] = blake2b_iv[i];
+      }
+      lanes.h[0][lane] ^= 0x01010000 ^ outlen;
+      lanes.t[lane] = 0;
+      ++busy;
+    };
+    for (lane = 0; lane < N; lane++) {
+      start(lane);
+    }
+
+    while (busy != 0) {
+      for (lane = 0; lane < N; lane++) {
+        if (message[lane] == count) {  // idle lane computes garbage
+          for (i = 0; i < 16; i++) {
+            lanes.m[i][lane] = 0;
+          }
+          lanes.f[lane] = 0;
+          continue;
+        }
+        const uint8_t *data = (const uint8_t *)in[message[lane]] + offset[lane];
+        size_t n = inlen[message[lane]] - offset[lane];
+        if (n > 128) {
+          n = 128;
+          lanes.f[lane] = 0;
+        } else {
+          memcpy(block, data, n);
+          memset(block + n, 0, 128 - n);
+          data = block;
+          lanes.f[lane] = ~uint64_t{0};
+        }
+        for (i = 0; i < 16; i++) {
+          lanes.m[i][lane] = B2B_GET64(data + 8 * i);
+        }
+        offset[lane] += n;
+        lanes.t[lane] += n;
+      }
+
+      compress(lanes);
+
+      for (lane = 0; lane < N; lane++) {
+        if (message[lane] == count || lanes.f[lane] == 0) {
+          continue;
+        }
+        uint8_t *digest = out + message[lane] * outlen;
+        for (i = 0; i < outlen; i++) {
+          digest[i] = (lanes.h[i >> 3][lane] >> (8 * (i & 7))) & 0xFF;
+        }
+        --busy;
+        start(lane);
+      }
+    }
+  }
+
+  int blake2b_multi(void *out,
+                    size_t outlen,
+                    const void *const *in,
+                    const size_t *inlen,
+                    size_t count) {
+    if (outlen == 0 || outlen > 64) {
+      return -1;  // illegal parameters
+    }
+
+#ifdef KAGOME_BLAKE2B_X86
+    // idle lanes are wasted, so wider registers are used only when there is
+    // enough messages to fill them
+    if (count > 4 && blake2b_simd::avx512Supported()) {
+      blake2b_lanes<8>(blake2b_simd::compressLanesAvx512,
+                       (uint8_t *)out,
+                       outlen,
+                       in,
+                       inlen,
+                       count);
+      return 0;
+    }
+    if (count > 1 && blake2b_simd::avx2Supported()) {
+      blake2b_lanes<4>(blake2b_simd::compressLanesAvx2,
+                       (uint8_t *)out,
+                       outlen,
+                       in,
+                       inlen,
+                       count);
+      return 0;
+    }
+#endif
+
+    for (size_t i = 0; i < count; i++) {
+      blake2b((uint8_t *)out + i * outlen, outlen, nullptr, 0, in[i], inlen[i]);
+    }
+    return 0;
+  }
+
 }  // namespace kagome::crypto
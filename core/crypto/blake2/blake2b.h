@@ -48,6 +48,16 @@ namespace kagome::crypto {
               const void *in,
               size_t inlen);  // data to be hashed
 
+  // Hash "count" independent messages, "in[i]" of "inlen[i]" bytes, without
+  //      key. Digests of "outlen" bytes are placed one after another in
+  //      "out". Messages are compressed together in lanes of SIMD registers
+  //      when supported by CPU.
+  int blake2b_multi(void *out,
+                    size_t outlen,  // size of each digest
+                    const void *const *in,
+                    const size_t *inlen,
+                    size_t count);  // number of messages
+
 }  // namespace kagome::crypto
 
 #endif
@@ -0,0 +1,253 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "blake2b_simd.h"
+
+#ifdef KAGOME_BLAKE2B_X86
+
+#include <immintrin.h>
+
+namespace kagome::crypto::blake2b_simd {
+
+  namespace {
+    const uint64_t blake2b_iv[8] = {0x6A09E667F3BCC908,
+                                    0xBB67AE8584CAA73B,
+                                    0x3C6EF372FE94F82B,
+                                    0xA54FF53A5F1D36F1,
+                                    0x510E527FADE682D1,
+                                    0x9B05688C2B3E6C1F,
+                                    0x1F83D9ABFB41BD6B,
+                                    0x5BE0CD19137E2179};
+
+    const uint8_t sigma[12][16] = {
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+        {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+        {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+        {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+        {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+        {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+        {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+        {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+        {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+        {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+        {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3}};
+
+    // byte shuffles rotating 64-bit words right by 24 and 16 bits
+    const uint8_t rotr24_mask[32] = {
+        3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10,
+        3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10};
+    const uint8_t rotr16_mask[32] = {
+        2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9,
+        2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9};
+  }  // namespace
+
+  bool avx2Supported() {
+    static const bool supported = [] {
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return supported;
+  }
+
+  bool avx512Supported() {
+    static const bool supported = [] {
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx512f") != 0;
+    }();
+    return supported;
+  }
+
+  // AVX2 rotations of 64-bit words, 32, 24 and 16 bits rotations are byte
+  // shuffles.
+
+#define B2B_AVX2_ROTR32(x) _mm256_shuffle_epi32((x), _MM_SHUFFLE(2, 3, 0, 1))
+#define B2B_AVX2_ROTR24(x) _mm256_shuffle_epi8((x), rotr24)
+#define B2B_AVX2_ROTR16(x) _mm256_shuffle_epi8((x), rotr16)
+#define B2B_AVX2_ROTR63(x) \
+  _mm256_xor_si256(_mm256_srli_epi64((x), 63), _mm256_add_epi64((x), (x)))
+
+  // Single message: rows of 4x4 matrix "v" are AVX2 registers, diagonal
+  // step rotates rows instead of picking words.
+
+#define B2B_AVX2_ROW_G(a, b, c, d, x, y)            \
+  {                                                 \
+    a = _mm256_add_epi64(_mm256_add_epi64(a, b), x); \
+    d = B2B_AVX2_ROTR32(_mm256_xor_si256(d, a));    \
+    c = _mm256_add_epi64(c, d);                     \
+    b = B2B_AVX2_ROTR24(_mm256_xor_si256(b, c));    \
+    a = _mm256_add_epi64(_mm256_add_epi64(a, b), y); \
+    d = B2B_AVX2_ROTR16(_mm256_xor_si256(d, a));    \
+    c = _mm256_add_epi64(c, d);                     \
+    b = B2B_AVX2_ROTR63(_mm256_xor_si256(b, c));    \
+  }
+
+#define B2B_AVX2_WORDS(s, i0, i1, i2, i3) \
+  _mm256_set_epi64x(m[s[i3]], m[s[i2]], m[s[i1]], m[s[i0]])
+
+  __attribute__((target("avx2"))) void compressAvx2(uint64_t h[8],
+                                                    const uint64_t m[16],
+                                                    uint64_t t,
+                                                    uint64_t f) {
+    const __m256i rotr24 = _mm256_loadu_si256((const __m256i *)rotr24_mask);
+    const __m256i rotr16 = _mm256_loadu_si256((const __m256i *)rotr16_mask);
+
+    const __m256i h0 = _mm256_loadu_si256((const __m256i *)&h[0]);
+    const __m256i h1 = _mm256_loadu_si256((const __m256i *)&h[4]);
+    __m256i a = h0;
+    __m256i b = h1;
+    __m256i c = _mm256_loadu_si256((const __m256i *)&blake2b_iv[0]);
+    __m256i d = _mm256_xor_si256(
+        _mm256_loadu_si256((const __m256i *)&blake2b_iv[4]),
+        _mm256_set_epi64x(0, (int64_t)f, 0, (int64_t)t));
+
+    for (int i = 0; i < 12; ++i) {
+      const uint8_t *s = sigma[i];
+      B2B_AVX2_ROW_G(a,
+                     b,
+                     c,
+                     d,
+                     B2B_AVX2_WORDS(s, 0, 2, 4, 6),
+                     B2B_AVX2_WORDS(s, 1, 3, 5, 7));
+      // diagonalize
+      b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(0, 3, 2, 1));
+      c = _mm256_permute4x64_epi64(c, _MM_SHUFFLE(1, 0, 3, 2));
+      d = _mm256_permute4x64_epi64(d, _MM_SHUFFLE(2, 1, 0, 3));
+      B2B_AVX2_ROW_G(a,
+                     b,
+                     c,
+                     d,
+                     B2B_AVX2_WORDS(s, 8, 10, 12, 14),
+                     B2B_AVX2_WORDS(s, 9, 11, 13, 15));
+      // undiagonalize
+      b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(2, 1, 0, 3));
+      c = _mm256_permute4x64_epi64(c, _MM_SHUFFLE(1, 0, 3, 2));
+      d = _mm256_permute4x64_epi64(d, _MM_SHUFFLE(0, 3, 2, 1));
+    }
+
+    _mm256_storeu_si256((__m256i *)&h[0],
+                        _mm256_xor_si256(h0, _mm256_xor_si256(a, c)));
+    _mm256_storeu_si256((__m256i *)&h[4],
+                        _mm256_xor_si256(h1, _mm256_xor_si256(b, d)));
+  }
+
+  // Several messages: each word of "v" is a register holding that word of
+  // every message, so the scalar algorithm is executed lane-wise.
+
+#define B2B_LANES_G(ADD, XOR, R32, R24, R16, R63, a, b, c, d, x, y) \
+  {                                                                 \
+    v[a] = ADD(ADD(v[a], v[b]), m[x]);                              \
+    v[d] = R32(XOR(v[d], v[a]));                                    \
+    v[c] = ADD(v[c], v[d]);                                         \
+    v[b] = R24(XOR(v[b], v[c]));                                    \
+    v[a] = ADD(ADD(v[a], v[b]), m[y]);                              \
+    v[d] = R16(XOR(v[d], v[a]));                                    \
+    v[c] = ADD(v[c], v[d]);                                         \
+    v[b] = R63(XOR(v[b], v[c]));                                    \
+  }
+
+#define B2B_LANES_ROUND(G, s)               \
+  {                                         \
+    G(0, 4, 8, 12, (s)[0], (s)[1]);         \
+    G(1, 5, 9, 13, (s)[2], (s)[3]);         \
+    G(2, 6, 10, 14, (s)[4], (s)[5]);        \
+    G(3, 7, 11, 15, (s)[6], (s)[7]);        \
+    G(0, 5, 10, 15, (s)[8], (s)[9]);        \
+    G(1, 6, 11, 12, (s)[10], (s)[11]);      \
+    G(2, 7, 8, 13, (s)[12], (s)[13]);       \
+    G(3, 4, 9, 14, (s)[14], (s)[15]);       \
+  }
+
+#define B2B_AVX2_G(a, b, c, d, x, y) \
+  B2B_LANES_G(_mm256_add_epi64,      \
+              _mm256_xor_si256,      \
+              B2B_AVX2_ROTR32,       \
+              B2B_AVX2_ROTR24,       \
+              B2B_AVX2_ROTR16,       \
+              B2B_AVX2_ROTR63,       \
+              a,                     \
+              b,                     \
+              c,                     \
+              d,                     \
+              x,                     \
+              y)
+
+  __attribute__((target("avx2"))) void compressLanesAvx2(Lanes<4> &lanes) {
+    const __m256i rotr24 = _mm256_loadu_si256((const __m256i *)rotr24_mask);
+    const __m256i rotr16 = _mm256_loadu_si256((const __m256i *)rotr16_mask);
+    __m256i m[16];
+    __m256i v[16];
+    for (int i = 0; i < 16; ++i) {
+      m[i] = _mm256_loadu_si256((const __m256i *)lanes.m[i]);
+    }
+    for (int i = 0; i < 8; ++i) {
+      v[i] = _mm256_loadu_si256((const __m256i *)lanes.h[i]);
+      v[i + 8] = _mm256_set1_epi64x((int64_t)blake2b_iv[i]);
+    }
+    v[12] = _mm256_xor_si256(
+        v[12], _mm256_loadu_si256((const __m256i *)lanes.t));
+    v[14] = _mm256_xor_si256(
+        v[14], _mm256_loadu_si256((const __m256i *)lanes.f));
+
+    for (int i = 0; i < 12; ++i) {
+      B2B_LANES_ROUND(B2B_AVX2_G, sigma[i]);
+    }
+
+    for (int i = 0; i < 8; ++i) {
+      _mm256_storeu_si256(
+          (__m256i *)lanes.h[i],
+          _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)lanes.h[i]),
+                           _mm256_xor_si256(v[i], v[i + 8])));
+    }
+  }
+
+#define B2B_AVX512_ROTR32(x) _mm512_ror_epi64((x), 32)
+#define B2B_AVX512_ROTR24(x) _mm512_ror_epi64((x), 24)
+#define B2B_AVX512_ROTR16(x) _mm512_ror_epi64((x), 16)
+#define B2B_AVX512_ROTR63(x) _mm512_ror_epi64((x), 63)
+
+#define B2B_AVX512_G(a, b, c, d, x, y) \
+  B2B_LANES_G(_mm512_add_epi64,        \
+              _mm512_xor_si512,        \
+              B2B_AVX512_ROTR32,       \
+              B2B_AVX512_ROTR24,       \
+              B2B_AVX512_ROTR16,       \
+              B2B_AVX512_ROTR63,       \
+              a,                       \
+              b,                       \
+              c,                       \
+              d,                       \
+              x,                       \
+              y)
+
+  __attribute__((target("avx512f"))) void compressLanesAvx512(
+      Lanes<8> &lanes) {
+    __m512i m[16];
+    __m512i v[16];
+    for (int i = 0; i < 16; ++i) {
+      m[i] = _mm512_loadu_si512(lanes.m[i]);
+    }
+    for (int i = 0; i < 8; ++i) {
+      v[i] = _mm512_loadu_si512(lanes.h[i]);
+      v[i + 8] = _mm512_set1_epi64((int64_t)blake2b_iv[i]);
+    }
+    v[12] = _mm512_xor_si512(v[12], _mm512_loadu_si512(lanes.t));
+    v[14] = _mm512_xor_si512(v[14], _mm512_loadu_si512(lanes.f));
+
+    for (int i = 0; i < 12; ++i) {
+      B2B_LANES_ROUND(B2B_AVX512_G, sigma[i]);
+    }
+
+    for (int i = 0; i < 8; ++i) {
+      _mm512_storeu_si512(
+          lanes.h[i],
+          _mm512_xor_si512(_mm512_loadu_si512(lanes.h[i]),
+                           _mm512_xor_si512(v[i], v[i + 8])));
+    }
+  }
+
+}  // namespace kagome::crypto::blake2b_simd
+
+#endif  // KAGOME_BLAKE2B_X86
@@ -0,0 +1,51 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// SIMD kernels of BLAKE2b compression function, used by blake2b.cpp.
+// Kernels are compiled for x86-64 only and selected at runtime.
+
+#ifndef CORE_BLAKE2B_SIMD_H
+#define CORE_BLAKE2B_SIMD_H
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define KAGOME_BLAKE2B_X86 1
+#endif
+
+namespace kagome::crypto::blake2b_simd {
+
+  // State of "N" independent messages compressed together.
+  // Words are laid out word-major, so i-th words of all messages form one
+  // SIMD register.
+  template <size_t N>
+  struct Lanes {
+    uint64_t h[8][N];   // chained states
+    uint64_t m[16][N];  // message blocks
+    uint64_t t[N];      // total number of bytes including the block
+    uint64_t f[N];      // ~0 for last block of message, 0 otherwise
+  };
+
+#ifdef KAGOME_BLAKE2B_X86
+  bool avx2Supported();
+  bool avx512Supported();
+
+  // Compresses one block "m" into "h" using AVX2.
+  void compressAvx2(uint64_t h[8],
+                    const uint64_t m[16],
+                    uint64_t t,
+                    uint64_t f);
+
+  // Compresses blocks of 4 messages using 4 lanes of AVX2 registers.
+  void compressLanesAvx2(Lanes<4> &lanes);
+
+  // Compresses blocks of 8 messages using 8 lanes of AVX-512 registers.
+  void compressLanesAvx512(Lanes<8> &lanes);
+#endif
+
+}  // namespace kagome::crypto::blake2b_simd
+
+#endif  // CORE_BLAKE2B_SIMD_H
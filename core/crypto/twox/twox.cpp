@@ -5,10 +5,96 @@
 
 #include "crypto/twox/twox.hpp"
 
+#include <utility>
+
+#include <boost/endian/conversion.hpp>
 #include <xxhash/xxhash.h>
 
 namespace kagome::crypto {
 
+  namespace {
+    // XXH64 computed for several seeds in a single pass over the input.
+    // Every input word is loaded and premultiplied once and then mixed into
+    // accumulators of all seeds, which are independent and so are executed
+    // in parallel by the CPU. Output is bit-identical to S calls of XXH64.
+    constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+    constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+    constexpr uint64_t kPrime4 = 0x85EBCA77C2B2AE63ULL;
+    constexpr uint64_t kPrime5 = 0x27D4EB2F165667C5ULL;
+
+    inline uint64_t rotl(uint64_t x, int r) {
+      return (x << r) | (x >> (64 - r));
+    }
+
+    inline uint64_t round(uint64_t acc, uint64_t input) {
+      return rotl(acc + input * kPrime2, 31) * kPrime1;
+    }
+
+    // Seeds are expanded by fold expressions, so that the loops over seeds
+    // are always unrolled and accumulators stay in registers.
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+    template <uint64_t... Seed>
+    inline void xxh64Seeds(std::integer_sequence<uint64_t, Seed...>,
+                           const uint8_t *in,
+                           size_t len,
+                           uint64_t *out) {
+      constexpr size_t S = sizeof...(Seed);
+      const uint8_t *end = in + len;
+      uint64_t h[S];
+      if (len >= 32) {
+        uint64_t v1[S]{(Seed + kPrime1 + kPrime2)...};
+        uint64_t v2[S]{(Seed + kPrime2)...};
+        uint64_t v3[S]{Seed...};
+        uint64_t v4[S]{(Seed - kPrime1)...};
+        for (const uint8_t *limit = end - 32; in <= limit; in += 32) {
+          auto i1 = boost::endian::load_little_u64(in) * kPrime2;
+          auto i2 = boost::endian::load_little_u64(in + 8) * kPrime2;
+          auto i3 = boost::endian::load_little_u64(in + 16) * kPrime2;
+          auto i4 = boost::endian::load_little_u64(in + 24) * kPrime2;
+          ((v1[Seed] = rotl(v1[Seed] + i1, 31) * kPrime1), ...);
+          ((v2[Seed] = rotl(v2[Seed] + i2, 31) * kPrime1), ...);
+          ((v3[Seed] = rotl(v3[Seed] + i3, 31) * kPrime1), ...);
+          ((v4[Seed] = rotl(v4[Seed] + i4, 31) * kPrime1), ...);
+        }
+        ((h[Seed] = rotl(v1[Seed], 1) + rotl(v2[Seed], 7)
+                  + rotl(v3[Seed], 12) + rotl(v4[Seed], 18)),
+         ...);
+        for (auto v : {v1, v2, v3, v4}) {
+          ((h[Seed] = (h[Seed] ^ round(0, v[Seed])) * kPrime1 + kPrime4),
+           ...);
+        }
+      } else {
+        ((h[Seed] = Seed + kPrime5), ...);
+      }
+      ((h[Seed] += len), ...);
+      for (; in + 8 <= end; in += 8) {
+        auto k = round(0, boost::endian::load_little_u64(in));
+        ((h[Seed] = rotl(h[Seed] ^ k, 27) * kPrime1 + kPrime4), ...);
+      }
+      if (in + 4 <= end) {
+        uint64_t k = boost::endian::load_little_u32(in) * kPrime1;
+        ((h[Seed] = rotl(h[Seed] ^ k, 23) * kPrime2 + kPrime3), ...);
+        in += 4;
+      }
+      for (; in < end; ++in) {
+        uint64_t k = *in * kPrime5;
+        ((h[Seed] = rotl(h[Seed] ^ k, 11) * kPrime1), ...);
+      }
+      for (auto &x : h) {
+        x ^= x >> 33;
+        x *= kPrime2;
+        x ^= x >> 29;
+        x *= kPrime3;
+        x ^= x >> 32;
+      }
+      ((out[Seed] = h[Seed]), ...);
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }  // namespace
+
   void make_twox64(const uint8_t *in, uint32_t len, uint8_t *out) {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
     auto *ptr = reinterpret_cast<uint64_t *>(out);
@@ -25,10 +111,7 @@ namespace kagome::crypto {
   void make_twox128(const uint8_t *in, uint32_t len, uint8_t *out) {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
     auto *ptr = reinterpret_cast<uint64_t *>(out);
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    ptr[0] = XXH64(in, len, 0);
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    ptr[1] = XXH64(in, len, 1);
+    xxh64Seeds(std::make_integer_sequence<uint64_t, 2>{}, in, len, ptr);
   }
 
   common::Hash128 make_twox128(gsl::span<const uint8_t> buf) {
@@ -40,14 +123,7 @@ namespace kagome::crypto {
   void make_twox256(const uint8_t *in, uint32_t len, uint8_t *out) {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
     auto *ptr = reinterpret_cast<uint64_t *>(out);
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    ptr[0] = XXH64(in, len, 0);
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    ptr[1] = XXH64(in, len, 1);
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    ptr[2] = XXH64(in, len, 2);
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    ptr[3] = XXH64(in, len, 3);
+    xxh64Seeds(std::make_integer_sequence<uint64_t, 4>{}, in, len, ptr);
   }
 
   common::Hash256 make_twox256(gsl::span<const uint8_t> buf) {
@@ -0,0 +1,278 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "host_api/host_api_profiler.hpp"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+#include <boost/assert.hpp>
+
+#include "log/logger.hpp"
+#include "metrics/metrics.hpp"
+
+namespace {
+  constexpr auto kCallDurationMetricName = "kagome_host_api_call_duration";
+  constexpr auto kBytesMetricName = "kagome_host_api_bytes";
+}  // namespace
+
+namespace kagome::host_api {
+
+  namespace {
+    struct Function {
+      std::string name;
+      metrics::Histogram *duration = nullptr;
+      metrics::Counter *bytes = nullptr;
+    };
+
+    struct Profiler {
+      std::mutex mutex;
+      std::unordered_map<std::string, HostApiProfiler::FunctionId> ids;
+      std::array<Function, HostApiProfiler::kMaxFunctions> functions;
+      filesystem::path dump_dir;
+      metrics::RegistryPtr metrics_registry = metrics::createRegistry();
+      log::Logger logger = log::createLogger("HostApiProfiler", "host_api");
+
+      Profiler() {
+        metrics_registry->registerHistogramFamily(
+            kCallDurationMetricName, "Duration of Host API calls in seconds");
+        metrics_registry->registerCounterFamily(
+            kBytesMetricName,
+            "Number of bytes passed to and returned from Host API calls");
+      }
+
+      /// metrics are registered only when profiling is enabled, so disabled
+      /// profiler does not expose empty series
+      void registerMetrics(Function &function) {
+        if (function.duration != nullptr) {
+          return;
+        }
+        function.duration = metrics_registry->registerHistogramMetric(
+            kCallDurationMetricName,
+            {0.000001, 0.00001, 0.0001, 0.001, 0.01, 0.1, 1},
+            {{"function", function.name}});
+        function.bytes = metrics_registry->registerCounterMetric(
+            kBytesMetricName, {{"function", function.name}});
+      }
+    };
+
+    Profiler &profiler() {
+      static Profiler profiler;
+      return profiler;
+    }
+  }  // namespace
+
+  struct HostApiProfiler::BlockStats {
+    struct Entry {
+      uint64_t calls = 0;
+      uint64_t nanoseconds = 0;
+      uint64_t bytes = 0;
+    };
+
+    std::array<Entry, kMaxFunctions> entries;
+  };
+
+  std::atomic_bool HostApiProfiler::enabled_ = false;
+
+  HostApiProfiler::BlockStats *&HostApiProfiler::currentBlock() {
+    static thread_local BlockStats *current_block = nullptr;
+    return current_block;
+  }
+
+  void HostApiProfiler::enable(const filesystem::path &dump_dir) {
+    auto &p = profiler();
+    {
+      std::lock_guard lock{p.mutex};
+      p.dump_dir = dump_dir;
+      for (size_t id = 0; id < p.ids.size(); ++id) {
+        p.registerMetrics(p.functions[id]);
+      }
+    }
+    if (not dump_dir.empty()) {
+      std::error_code ec;
+      filesystem::create_directories(dump_dir, ec);
+      if (ec) {
+        SL_ERROR(p.logger,
+                 "Can't create directory {} for host api profile: {}",
+                 dump_dir.native(),
+                 ec.message());
+      }
+    }
+    enabled_.store(true, std::memory_order_release);
+    p.logger->info("Host API profiling is enabled");
+  }
+
+  HostApiProfiler::FunctionId HostApiProfiler::registerFunction(
+      std::string_view name) {
+    auto &p = profiler();
+    std::lock_guard lock{p.mutex};
+    std::string key{name};
+    if (auto it = p.ids.find(key); it != p.ids.end()) {
+      return it->second;
+    }
+    BOOST_ASSERT_MSG(p.ids.size() < kMaxFunctions,
+                     "Too many profiled Host API functions");
+    auto id = p.ids.size();
+    auto &function = p.functions[id];
+    function.name = key;
+    if (enabled()) {
+      p.registerMetrics(function);
+    }
+    p.ids.emplace(std::move(key), id);
+    return id;
+  }
+
+  HostApiProfiler::SpanLayout HostApiProfiler::spanLayout(
+      std::string_view name) {
+    // functions with i64 values, which are numbers rather than spans
+    static const std::unordered_map<std::string_view, SpanLayout> kLayouts{
+        {"ext_misc_print_num_version_1", {.args = 0}},
+        {"ext_offchain_sleep_until_version_1", {.args = 0}},
+        {"ext_offchain_timestamp_version_1", {.result = false}},
+    };
+    if (auto it = kLayouts.find(name); it != kLayouts.end()) {
+      return it->second;
+    }
+    return {};
+  }
+
+  HostApiProfiler::Call::Call(FunctionId id, uint64_t bytes)
+      : id_{id}, active_{enabled()}, bytes_{bytes} {
+    if (active_) {
+      start_ = std::chrono::steady_clock::now();
+    }
+  }
+
+  HostApiProfiler::Call::~Call() {
+    if (not active_) {
+      return;
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start_;
+    auto &function = profiler().functions[id_];
+    function.duration->observe(
+        std::chrono::duration<double>(elapsed).count());
+    function.bytes->inc(static_cast<double>(bytes_));
+    if (auto stats = currentBlock()) {
+      auto &entry = stats->entries[id_];
+      ++entry.calls;
+      entry.nanoseconds +=
+          std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+              .count();
+      entry.bytes += bytes_;
+    }
+  }
+
+  HostApiProfiler::BlockScope::BlockScope(const primitives::BlockInfo &block,
+                                          bool dump)
+      : block_{block}, dump_{dump} {
+    if (not enabled() or currentBlock() != nullptr) {
+      return;
+    }
+    if (dump_) {
+      auto &p = profiler();
+      std::lock_guard lock{p.mutex};
+      if (p.dump_dir.empty()) {
+        return;
+      }
+    }
+    stats_ = std::make_unique<BlockStats>();
+    currentBlock() = stats_.get();
+    start_ = std::chrono::steady_clock::now();
+  }
+
+  std::vector<HostApiProfiler::FunctionStats>
+  HostApiProfiler::BlockScope::stats() const {
+    std::vector<FunctionStats> calls;
+    if (stats_ == nullptr) {
+      return calls;
+    }
+    {
+      auto &p = profiler();
+      std::lock_guard lock{p.mutex};
+      for (size_t id = 0; id < p.ids.size(); ++id) {
+        auto &entry = stats_->entries[id];
+        if (entry.calls != 0) {
+          // names are never changed after registration
+          calls.emplace_back(FunctionStats{p.functions[id].name,
+                                           entry.calls,
+                                           entry.nanoseconds,
+                                           entry.bytes});
+        }
+      }
+    }
+    std::sort(calls.begin(), calls.end(), [](auto &l, auto &r) {
+      return l.nanoseconds > r.nanoseconds;
+    });
+    return calls;
+  }
+
+  HostApiProfiler::BlockScope::~BlockScope() {
+    if (stats_ == nullptr) {
+      return;
+    }
+    currentBlock() = nullptr;
+    if (not dump_) {
+      return;
+    }
+    const uint64_t total_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start_)
+            .count();
+
+    auto calls = stats();
+    auto &p = profiler();
+    filesystem::path dump_dir;
+    {
+      std::lock_guard lock{p.mutex};
+      dump_dir = p.dump_dir;
+    }
+
+    const auto name = fmt::format("{}_{}", block_.number, block_.hash.toHex());
+    const auto block_frame = fmt::format("block_{}", block_.number);
+
+    std::ofstream json{dump_dir / (name + ".json")};
+    std::ofstream folded{dump_dir / (name + ".folded")};
+    if (not json or not folded) {
+      SL_ERROR(p.logger,
+               "Can't write host api profile of block {} into {}",
+               block_,
+               dump_dir.native());
+      return;
+    }
+
+    uint64_t host_ns = 0;
+    json << fmt::format(
+        R"({{"block":{{"number":{},"hash":"0x{}"}},)"
+        R"("duration_ns":{},"calls":[)",
+        block_.number,
+        block_.hash.toHex(),
+        total_ns);
+    for (size_t i = 0; i < calls.size(); ++i) {
+      auto &call = calls[i];
+      host_ns += call.nanoseconds;
+      json << fmt::format(
+          R"({}{{"function":"{}","calls":{},"time_ns":{},"bytes":{}}})",
+          i == 0 ? "" : ",",
+          call.function,
+          call.calls,
+          call.nanoseconds,
+          call.bytes);
+      folded << fmt::format(
+          "{};host_api;{} {}\n", block_frame, call.function, call.nanoseconds);
+    }
+    json << "]}\n";
+    // time of block execution spent outside of Host API
+    if (total_ns > host_ns) {
+      folded << fmt::format("{};wasm {}\n", block_frame, total_ns - host_ns);
+    }
+  }
+
+}  // namespace kagome::host_api
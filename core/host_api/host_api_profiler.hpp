@@ -0,0 +1,157 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_HOST_API_HOST_API_PROFILER_HPP
+#define KAGOME_CORE_HOST_API_HOST_API_PROFILER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "filesystem/common.hpp"
+#include "primitives/common.hpp"
+
+namespace kagome::host_api {
+
+  /**
+   * Opt-in profiler of Host API calls made by runtime.
+   * Collects number of calls, time spent and bytes passed through memory
+   * spans for each Host API function and exports them as metrics.
+   * Calls made during block execution are optionally dumped per block as json
+   * and as folded stacks for flamegraph tools.
+   * Profiler is process-wide, because WAVM intrinsics are plain functions
+   * without access to injected objects.
+   */
+  class HostApiProfiler final {
+    struct BlockStats;
+
+   public:
+    using FunctionId = size_t;
+
+    /// Max number of distinct profiled Host API functions
+    static constexpr size_t kMaxFunctions = 256;
+
+    HostApiProfiler() = delete;
+
+    /**
+     * Enables profiling
+     * @param dump_dir directory to dump per block statistics into, nothing is
+     * dumped if empty
+     */
+    static void enable(const filesystem::path &dump_dir);
+
+    static bool enabled() {
+      return enabled_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @return id of Host API function, same for same name
+     */
+    static FunctionId registerFunction(std::string_view name);
+
+    /**
+     * @return number of bytes referenced by WasmSpan argument or result
+     */
+    static constexpr uint64_t spanSize(uint64_t span) {
+      return span >> 32;
+    }
+
+    /**
+     * Positions of WasmSpan values in signature of Host API function.
+     * Only i64 values are checked against layout, i32 values are never spans.
+     */
+    struct SpanLayout {
+      /// bit per argument, set if i64 argument is WasmSpan
+      uint64_t args = ~uint64_t{0};
+      /// whether i64 result is WasmSpan
+      bool result = true;
+
+      uint64_t argBytes(size_t index, uint64_t value) const {
+        return ((args >> index) & 1) != 0 ? spanSize(value) : 0;
+      }
+
+      uint64_t resultBytes(uint64_t value) const {
+        return result ? spanSize(value) : 0;
+      }
+    };
+
+    /**
+     * @return span layout of Host API function by its name, i64 values of
+     * functions passing plain numbers (e.g. timestamps) are excluded
+     */
+    static SpanLayout spanLayout(std::string_view name);
+
+    /**
+     * Measures single Host API call from construction till destruction.
+     * Time of nested calls (e.g. made by sandboxed code) is included into
+     * time of the outer one.
+     */
+    class Call final {
+     public:
+      Call(FunctionId id, uint64_t bytes);
+      Call(const Call &) = delete;
+      Call &operator=(const Call &) = delete;
+      ~Call();
+
+      void addBytes(uint64_t bytes) {
+        bytes_ += bytes;
+      }
+
+     private:
+      FunctionId id_;
+      bool active_;
+      uint64_t bytes_;
+      std::chrono::steady_clock::time_point start_;
+    };
+
+    /// Calls of single Host API function made in scope of block
+    struct FunctionStats {
+      std::string_view function;
+      uint64_t calls = 0;
+      uint64_t nanoseconds = 0;
+      uint64_t bytes = 0;
+    };
+
+    /**
+     * Collects calls made by current thread while block is executed and dumps
+     * them on destruction
+     */
+    class BlockScope final {
+     public:
+      /**
+       * @param dump whether to dump collected calls on destruction, calls are
+       * collected regardless of dump directory when false
+       */
+      explicit BlockScope(const primitives::BlockInfo &block,
+                          bool dump = true);
+      BlockScope(const BlockScope &) = delete;
+      BlockScope &operator=(const BlockScope &) = delete;
+      ~BlockScope();
+
+      /**
+       * @return calls collected so far, the most expensive first, empty if
+       * profiling is disabled
+       */
+      std::vector<FunctionStats> stats() const;
+
+     private:
+      primitives::BlockInfo block_;
+      bool dump_;
+      std::unique_ptr<BlockStats> stats_;
+      std::chrono::steady_clock::time_point start_;
+    };
+
+   private:
+    /// statistics of block executed by current thread, if any
+    static BlockStats *&currentBlock();
+
+    static std::atomic_bool enabled_;
+  };
+
+}  // namespace kagome::host_api
+
+#endif  // KAGOME_CORE_HOST_API_HOST_API_PROFILER_HPP
@@ -15,7 +15,6 @@
 #include "runtime/memory_provider.hpp"
 #include "runtime/ptr_size.hpp"
 #include "runtime/trie_storage_provider.hpp"
-#include "scale/encode_append.hpp"
 #include "storage/predefined_keys.hpp"
 #include "storage/trie/impl/topper_trie_batch_impl.hpp"
 #include "storage/trie/polkadot_trie/trie_error.hpp"
@@ -35,6 +34,7 @@ namespace kagome::host_api {
   }
 
   void StorageExtension::reset() {
+    resetNextKeyCursor();
     // rollback will have value until there are opened transactions that need
     // to be closed
     for (; transactions_ != 0; --transactions_) {
@@ -99,9 +99,38 @@ namespace kagome::host_api {
   outcome::result<std::optional<Buffer>> StorageExtension::getStorageNextKey(
       const common::Buffer &key) const {
     auto batch = storage_provider_->getCurrentBatch();
+    if (next_key_cursor_ and next_key_cursor_->key == key
+        and next_key_cursor_->batch.lock() == batch) {
+      auto &cursor = next_key_cursor_->cursor;
+      if (auto res = cursor->next(); res.has_error()) {
+        resetNextKeyCursor();
+        return res.as_failure();
+      }
+      auto next_key = cursor->key();
+      if (next_key) {
+        next_key_cursor_->key = *next_key;
+      } else {
+        resetNextKeyCursor();
+      }
+      return next_key;
+    }
+
     auto cursor = batch->trieCursor();
-    OUTCOME_TRY(cursor->seekUpperBound(key));
-    return cursor->key();
+    if (auto res = cursor->seekUpperBound(key); res.has_error()) {
+      resetNextKeyCursor();
+      return res.as_failure();
+    }
+    auto next_key = cursor->key();
+    if (next_key) {
+      next_key_cursor_ = NextKeyCursor{batch, *next_key, std::move(cursor)};
+    } else {
+      resetNextKeyCursor();
+    }
+    return next_key;
+  }
+
+  void StorageExtension::resetNextKeyCursor() const {
+    next_key_cursor_.reset();
   }
 
   void StorageExtension::ext_storage_set_version_1(
@@ -114,6 +143,7 @@ namespace kagome::host_api {
 
     SL_TRACE_VOID_FUNC_CALL(logger_, key, value);
 
+    resetNextKeyCursor();
     auto batch = storage_provider_->getCurrentBatch();
     auto put_result = batch->put(key, std::move(value));
     if (not put_result) {
@@ -154,6 +184,7 @@ namespace kagome::host_api {
     auto batch = storage_provider_->getCurrentBatch();
     auto &memory = memory_provider_->getCurrentMemory()->get();
     auto key = memory.loadN(key_ptr, key_size);
+    resetNextKeyCursor();
     auto del_result = batch->remove(key);
     SL_TRACE_FUNC_CALL(logger_, del_result.has_value(), key);
     if (not del_result) {
@@ -216,6 +247,7 @@ namespace kagome::host_api {
   runtime::WasmSpan StorageExtension::ext_storage_root_version_2(
       runtime::WasmI32 version) {
     auto state_version = detail::toStateVersion(version);
+    resetNextKeyCursor();
     auto res = storage_provider_->commit(state_version);
     if (res.has_error()) {
       logger_->error("ext_storage_root resulted with an error: {}",
@@ -270,29 +302,21 @@ namespace kagome::host_api {
     auto key_bytes = memory.loadN(key_ptr, key_size);
     auto append_bytes = memory.loadN(append_ptr, append_size);
 
-    auto val_opt_res = get(key_bytes);
-    if (val_opt_res.has_error()) {
+    resetNextKeyCursor();
+    auto batch = storage_provider_->getCurrentBatch();
+    SL_TRACE_VOID_FUNC_CALL(logger_, key_bytes, append_bytes);
+    // batch defers concatenation, so appending is not quadratic
+    auto append_result = batch->append(key_bytes, append_bytes);
+    if (not append_result) {
       throw std::runtime_error{fmt::format(
-          "Error fetching value from storage: {}", val_opt_res.error())};
-    }
-    auto &val_opt = val_opt_res.value();
-    auto &&val = val_opt ? common::Buffer{val_opt.value()} : common::Buffer{};
-
-    if (scale::append_or_new_vec(val.asVector(), append_bytes).has_value()) {
-      auto batch = storage_provider_->getCurrentBatch();
-      SL_TRACE_VOID_FUNC_CALL(logger_, key_bytes, val);
-      auto put_result = batch->put(key_bytes, std::move(val));
-      if (not put_result) {
-        logger_->error(
-            "ext_storage_append_version_1 failed, due to fail in trie db "
-            "with reason: {}",
-            put_result.error());
-      }
-      return;
+          "ext_storage_append_version_1 failed, due to fail in trie db "
+          "with reason: {}",
+          append_result.error())};
     }
   }
 
   void StorageExtension::ext_storage_start_transaction_version_1() {
+    resetNextKeyCursor();
     auto res = storage_provider_->startTransaction();
     if (res.has_error()) {
       logger_->error("Storage transaction start has failed: {}", res.error());
@@ -302,6 +326,7 @@ namespace kagome::host_api {
   }
 
   void StorageExtension::ext_storage_commit_transaction_version_1() {
+    resetNextKeyCursor();
     auto res = storage_provider_->commitTransaction();
     SL_TRACE_VOID_FUNC_CALL(logger_);
     if (res.has_error()) {
@@ -313,6 +338,7 @@ namespace kagome::host_api {
   }
 
   void StorageExtension::ext_storage_rollback_transaction_version_1() {
+    resetNextKeyCursor();
     auto res = storage_provider_->rollbackTransaction();
     SL_TRACE_VOID_FUNC_CALL(logger_);
     if (res.has_error()) {
@@ -416,6 +442,7 @@ namespace kagome::host_api {
 
   runtime::WasmSpan StorageExtension::clearPrefix(
       common::BufferView prefix, std::optional<uint32_t> limit) {
+    resetNextKeyCursor();
     auto batch = storage_provider_->getCurrentBatch();
     auto &memory = memory_provider_->getCurrentMemory()->get();
 
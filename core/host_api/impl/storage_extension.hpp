@@ -7,11 +7,13 @@
 #define KAGOME_HOST_API_STORAGE_EXTENSION_HPP
 
 #include <cstdint>
+#include <optional>
 
 #include "common/buffer_or_view.hpp"
 #include "log/logger.hpp"
 #include "runtime/types.hpp"
 #include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/trie_batches.hpp"
 
 namespace kagome::runtime {
   class MemoryProvider;
@@ -162,6 +164,12 @@ namespace kagome::host_api {
     outcome::result<std::optional<common::Buffer>> getStorageNextKey(
         const common::Buffer &key) const;
 
+    /**
+     * Trie nodes are modified in place, so cursor is dropped on any write
+     * to the storage
+     */
+    void resetNextKeyCursor() const;
+
     runtime::WasmSpan clearPrefix(common::BufferView prefix,
                                   std::optional<uint32_t> limit);
 
@@ -172,6 +180,18 @@ namespace kagome::host_api {
 
     size_t transactions_ = 0;
 
+    /**
+     * Cursor which returned the last next key. Runtime iterating a storage
+     * map asks for the key following the previous result, so the cursor
+     * advances in place instead of seeking from the root.
+     */
+    struct NextKeyCursor {
+      std::weak_ptr<storage::trie::TrieBatch> batch;
+      common::Buffer key;
+      std::unique_ptr<storage::trie::PolkadotTrieCursor> cursor;
+    };
+    mutable std::optional<NextKeyCursor> next_key_cursor_;
+
     static constexpr auto kDefaultLoggerTag = "WASM Runtime [StorageExtension]";
   };
 
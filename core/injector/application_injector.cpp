@@ -38,6 +38,7 @@
 #include "api/service/system/system_jrpc_processor.hpp"
 #include "api/transport/impl/ws/ws_listener_impl.hpp"
 #include "api/transport/impl/ws/ws_session.hpp"
+#include "api/transport/rpc_request_scheduler.hpp"
 #include "api/transport/rpc_thread_pool.hpp"
 #include "application/app_configuration.hpp"
 #include "application/impl/app_state_manager_impl.hpp"
@@ -50,6 +51,7 @@
 #include "authorship/impl/block_builder_impl.hpp"
 #include "authorship/impl/proposer_impl.hpp"
 #include "benchmark/block_execution_benchmark.hpp"
+#include "benchmark/component_benchmark.hpp"
 #include "blockchain/impl/block_header_repository_impl.hpp"
 #include "blockchain/impl/block_storage_impl.hpp"
 #include "blockchain/impl/block_tree_impl.hpp"
@@ -126,6 +128,7 @@
 #include "runtime/common/executor.hpp"
 #include "runtime/common/module_repository_impl.hpp"
 #include "runtime/common/runtime_instances_pool.hpp"
+#include "runtime/common/runtime_precompiler.hpp"
 #include "runtime/common/runtime_upgrade_tracker_impl.hpp"
 #include "runtime/common/storage_code_provider.hpp"
 #include "runtime/common/trie_storage_provider_impl.hpp"
@@ -216,7 +219,8 @@ namespace {
         storage::RocksDb::create(app_config.databasePath(chain_spec->id()),
                                  options,
                                  app_config.dbCacheSize(),
-                                 prevent_destruction);
+                                 prevent_destruction,
+                                 app_config.dbProfiles());
     if (!db_res) {
       auto log = log::createLogger("Injector", "injector");
       log->critical(
@@ -442,7 +446,10 @@ namespace {
             }),
         makeWavmInjector(method),
         makeBinaryenInjector(method),
-        di::bind<runtime::ModuleRepository>.template to<runtime::ModuleRepositoryImpl>(),
+        bind_by_lambda<runtime::ModuleRepository>([](const auto &injector) {
+          return injector
+              .template create<sptr<runtime::ModuleRepositoryImpl>>();
+        }),
         bind_by_lambda<runtime::CoreApiFactory>([method](const auto &injector) {
           return choose_runtime_implementation<
               runtime::CoreApiFactory,
@@ -526,6 +533,7 @@ namespace {
                                Ts &&...args) {
     // default values for configurations
     api::RpcThreadPool::Configuration rpc_thread_pool_config{};
+    api::RpcRequestScheduler::Configuration rpc_request_scheduler_config{};
     api::WsSession::Configuration ws_config{};
     transaction_pool::PoolModeratorImpl::Params pool_moderator_config{};
     transaction_pool::TransactionPool::Limits tp_pool_limits{};
@@ -537,6 +545,7 @@ namespace {
         make_injector(
             // bind configs
             useConfig(rpc_thread_pool_config),
+            useConfig(rpc_request_scheduler_config),
             useConfig(ws_config),
             useConfig(pool_moderator_config),
             useConfig(tp_pool_limits),
@@ -939,10 +948,22 @@ namespace kagome::injector {
         .template create<sptr<authority_discovery::AddressPublisher>>();
   }
 
+  std::shared_ptr<runtime::RuntimePrecompiler>
+  KagomeNodeInjector::injectRuntimePrecompiler() {
+    return pimpl_->injector_
+        .template create<sptr<runtime::RuntimePrecompiler>>();
+  }
+
   std::shared_ptr<benchmark::BlockExecutionBenchmark>
   KagomeNodeInjector::injectBlockBenchmark() {
     return pimpl_->injector_
         .template create<sptr<benchmark::BlockExecutionBenchmark>>();
   }
 
+  std::shared_ptr<benchmark::ComponentBenchmark>
+  KagomeNodeInjector::injectComponentBenchmark() {
+    return pimpl_->injector_
+        .template create<sptr<benchmark::ComponentBenchmark>>();
+  }
+
 }  // namespace kagome::injector
@@ -36,6 +36,7 @@ namespace kagome {
 
   namespace benchmark {
     class BlockExecutionBenchmark;
+    class ComponentBenchmark;
   }
 
   namespace metrics {
@@ -58,6 +59,7 @@ namespace kagome {
 
   namespace runtime {
     class Executor;
+    class RuntimePrecompiler;
   }
 
   namespace api {
@@ -125,11 +127,13 @@ namespace kagome::injector {
     std::shared_ptr<storage::SpacedStorage> injectStorage();
     std::shared_ptr<authority_discovery::AddressPublisher>
     injectAddressPublisher();
+    std::shared_ptr<runtime::RuntimePrecompiler> injectRuntimePrecompiler();
 
     std::shared_ptr<application::mode::PrintChainInfoMode>
     injectPrintChainInfoMode();
     std::shared_ptr<application::mode::RecoveryMode> injectRecoveryMode();
     std::shared_ptr<benchmark::BlockExecutionBenchmark> injectBlockBenchmark();
+    std::shared_ptr<benchmark::ComponentBenchmark> injectComponentBenchmark();
 
    protected:
     std::shared_ptr<class KagomeNodeInjectorImpl> pimpl_;
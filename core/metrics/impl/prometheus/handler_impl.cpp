@@ -39,6 +39,7 @@ namespace kagome::metrics {
                                            std::shared_ptr<Session> session) {
     std::vector<MetricFamily> metrics;
 
+    PrometheusRegistry::flush();
     {
       std::lock_guard<std::mutex> lock{collectables_mutex_};
       metrics = CollectMetrics(collectables_);
@@ -5,20 +5,56 @@
 
 #include "metrics/impl/prometheus/metrics_impl.hpp"
 
+#include <algorithm>
+
 #include <prometheus/counter.h>
 #include <prometheus/gauge.h>
 #include <prometheus/histogram.h>
 #include <prometheus/summary.h>
 
+namespace {
+  /**
+   * @return shard of current thread, threads get shards round-robin
+   */
+  size_t shardIndex() {
+    static std::atomic<size_t> next_shard{0};
+    thread_local const size_t shard =
+        next_shard.fetch_add(1, std::memory_order_relaxed)
+        % kagome::metrics::kMetricShards;
+    return shard;
+  }
+
+  void atomicAdd(std::atomic<double> &value, double increment) {
+    auto current = value.load(std::memory_order_relaxed);
+    while (not value.compare_exchange_weak(
+        current, current + increment, std::memory_order_relaxed)) {
+    }
+  }
+}  // namespace
+
 namespace kagome::metrics {
   PrometheusCounter::PrometheusCounter(prometheus::Counter &m) : m_(m) {}
 
   void PrometheusCounter::inc() {
-    m_.Increment();
+    atomicAdd(shards_[shardIndex()].value, 1);
   }
 
   void PrometheusCounter::inc(double val) {
-    m_.Increment(val);
+    // prometheus counter ignores negative increments
+    if (val < 0) {
+      return;
+    }
+    atomicAdd(shards_[shardIndex()].value, val);
+  }
+
+  void PrometheusCounter::flush() {
+    double total = 0;
+    for (auto &shard : shards_) {
+      total += shard.value.exchange(0, std::memory_order_relaxed);
+    }
+    if (total > 0) {
+      m_.Increment(total);
+    }
   }
 
   PrometheusGauge::PrometheusGauge(prometheus::Gauge &m) : m_(m) {}
@@ -49,9 +85,42 @@ namespace kagome::metrics {
     m_.Observe(value);
   }
 
-  PrometheusHistogram::PrometheusHistogram(prometheus::Histogram &m) : m_(m) {}
+  PrometheusHistogram::PrometheusHistogram(
+      prometheus::Histogram &m, std::vector<double> bucket_boundaries)
+      : m_(m), bucket_boundaries_(std::move(bucket_boundaries)) {
+    for (auto &shard : shards_) {
+      shard.buckets = std::make_unique<std::atomic<uint64_t>[]>(
+          bucket_boundaries_.size() + 1);
+    }
+  }
 
   void PrometheusHistogram::observe(const double value) {
-    m_.Observe(value);
+    // same bucket as prometheus chooses, first with upper bound >= value
+    const auto bucket = std::distance(
+        bucket_boundaries_.begin(),
+        std::lower_bound(
+            bucket_boundaries_.begin(), bucket_boundaries_.end(), value));
+    auto &shard = shards_[shardIndex()];
+    shard.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    atomicAdd(shard.sum, value);
+  }
+
+  void PrometheusHistogram::flush() {
+    std::vector<double> increments(bucket_boundaries_.size() + 1, 0);
+    double sum = 0;
+    bool observed = false;
+    for (auto &shard : shards_) {
+      for (size_t i = 0; i < increments.size(); ++i) {
+        if (auto count =
+                shard.buckets[i].exchange(0, std::memory_order_relaxed)) {
+          increments[i] += static_cast<double>(count);
+          observed = true;
+        }
+      }
+      sum += shard.sum.exchange(0, std::memory_order_relaxed);
+    }
+    if (observed) {
+      m_.ObserveMultiple(increments, sum);
+    }
   }
 }  // namespace kagome::metrics
@@ -6,6 +6,10 @@
 #ifndef KAGOME_CORE_METRICS_IMPL_PROMETHEUS_METRICS_IMPL_HPP
 #define KAGOME_CORE_METRICS_IMPL_PROMETHEUS_METRICS_IMPL_HPP
 
+#include <array>
+#include <atomic>
+#include <memory>
+
 #include "metrics/metrics.hpp"
 
 namespace prometheus {
@@ -16,16 +20,33 @@ namespace prometheus {
 }  // namespace prometheus
 
 namespace kagome::metrics {
+  /// Number of shards of counter and histogram, threads are spread among them
+  constexpr size_t kMetricShards = 16;
+
+  /**
+   * Accumulates increments in per-thread shards, which are moved to
+   * prometheus counter only on scrape, so hot paths don't contend on it.
+   */
   class PrometheusCounter : public Counter {
     friend class PrometheusRegistry;
     prometheus::Counter &m_;
 
+    struct alignas(64) Shard {
+      std::atomic<double> value{0};
+    };
+    std::array<Shard, kMetricShards> shards_;
+
    public:
     PrometheusCounter(prometheus::Counter &m);
 
    public:
     void inc() override;
     void inc(double val) override;
+
+    /**
+     * Moves accumulated increments to prometheus counter
+     */
+    void flush();
   };
 
   class PrometheusGauge : public Gauge {
@@ -54,15 +75,33 @@ namespace kagome::metrics {
     void observe(const double value) override;
   };
 
+  /**
+   * Accumulates bucket counts and sum in per-thread shards, which are moved
+   * to prometheus histogram only on scrape.
+   */
   class PrometheusHistogram : public Histogram {
     friend class PrometheusRegistry;
     prometheus::Histogram &m_;
+    const std::vector<double> bucket_boundaries_;
+
+    struct alignas(64) Shard {
+      /// last bucket is +Inf
+      std::unique_ptr<std::atomic<uint64_t>[]> buckets;
+      std::atomic<double> sum{0};
+    };
+    std::array<Shard, kMetricShards> shards_;
 
    public:
-    PrometheusHistogram(prometheus::Histogram &m);
+    PrometheusHistogram(prometheus::Histogram &m,
+                        std::vector<double> bucket_boundaries);
 
    public:
     void observe(const double value) override;
+
+    /**
+     * Moves accumulated observations to prometheus histogram
+     */
+    void flush();
   };
 }  // namespace kagome::metrics
 
@@ -14,6 +14,30 @@ namespace kagome::metrics {
     return std::make_unique<PrometheusRegistry>();
   }
 
+  PrometheusRegistry::PrometheusRegistry() {
+    std::lock_guard lock{registries_mutex()};
+    registries().emplace(this);
+  }
+
+  PrometheusRegistry::~PrometheusRegistry() {
+    std::lock_guard lock{registries_mutex()};
+    registries().erase(this);
+  }
+
+  void PrometheusRegistry::flush() {
+    std::lock_guard lock{registries_mutex()};
+    for (auto *registry : registries()) {
+      for (auto &counter :
+           std::get<MetricInfo<Counter>::index>(registry->metrics_)) {
+        counter.flush();
+      }
+      for (auto &histogram :
+           std::get<MetricInfo<Histogram>::index>(registry->metrics_)) {
+        histogram.flush();
+      }
+    }
+  }
+
   void PrometheusRegistry::setHandler(Handler &handler) {
     handler.registerCollectable(*this);
   }
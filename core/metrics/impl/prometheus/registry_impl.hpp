@@ -9,8 +9,10 @@
 #include <forward_list>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <tuple>
 #include <type_traits>
+#include <unordered_set>
 
 #include <prometheus/counter.h>
 #include <prometheus/family.h>
@@ -102,8 +104,13 @@ namespace kagome::metrics {
           dynamic_cast<prometheus::Family<typename MetricInfo<T>::type> &>(
               family_.at(name).get())
               .Add(labels, args...);
-      return &std::get<MetricInfo<T>::index>(metrics_).emplace_front(
-          typename MetricInfo<T>::dtype(var));
+      std::lock_guard lock{registries_mutex()};
+      if constexpr (std::is_same_v<T, Histogram>) {
+        return &std::get<MetricInfo<T>::index>(metrics_).emplace_front(
+            var, args...);
+      } else {
+        return &std::get<MetricInfo<T>::index>(metrics_).emplace_front(var);
+      }
     }
 
     static std::shared_ptr<prometheus::Registry> registry() {
@@ -111,7 +118,26 @@ namespace kagome::metrics {
       return registry;
     }
 
+    // registries with sharded metrics to flush on scrape
+    static std::mutex &registries_mutex() {
+      static std::mutex mutex;
+      return mutex;
+    }
+    static std::unordered_set<PrometheusRegistry *> &registries() {
+      static std::unordered_set<PrometheusRegistry *> registries;
+      return registries;
+    }
+
    public:
+    PrometheusRegistry();
+    ~PrometheusRegistry() override;
+
+    /**
+     * Moves values accumulated by sharded metrics of all registries to
+     * prometheus metrics, must be called before collecting them
+     */
+    static void flush();
+
     // Handler has access to internal prometheus registry and gathers metrics,
     // prepares them for sending by http
     void setHandler(Handler &handler) override;
@@ -159,6 +185,7 @@ namespace kagome::metrics {
     // it is used for test purposes
     template <typename T>
     static typename MetricInfo<T>::type *internalMetric(T *metric) {
+      flush();
       return &dynamic_cast<typename MetricInfo<T>::dtype *>(metric)->m_;
     }
   };
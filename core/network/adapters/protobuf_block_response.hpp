@@ -8,8 +8,14 @@
 
 #include "network/adapters/protobuf.hpp"
 
+#include <google/protobuf/arena.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+
 #include "network/protobuf/api.v1.pb.h"
+#include "common/outcome_throw.hpp"
 #include "network/types/blocks_response.hpp"
+#include "primitives/shared_block_body.hpp"
 #include "scale/scale.hpp"
 
 namespace kagome::network {
@@ -24,7 +30,10 @@ namespace kagome::network {
         const BlocksResponse &t,
         std::vector<uint8_t> &out,
         std::vector<uint8_t>::iterator loaded) {
-      ::api::v1::BlockResponse msg;
+      google::protobuf::Arena arena;
+      auto &msg =
+          *google::protobuf::Arena::CreateMessage<::api::v1::BlockResponse>(
+              &arena);
       for (const auto &src_block : t.blocks) {
         auto *dst_block = msg.add_blocks();
         dst_block->set_hash(src_block.hash.toString());
@@ -36,8 +45,14 @@ namespace kagome::network {
 
         if (src_block.body) {
           for (const auto &ext_body : *src_block.body) {
-            dst_block->add_body(
-                vector_to_string(scale::encode(ext_body).value()));
+            // encoded extrinsic is written directly into the message
+            auto prefix =
+                scale::encode(scale::CompactInteger(ext_body.data.size()))
+                    .value();
+            auto &dst_body = *dst_block->add_body();
+            dst_body.reserve(prefix.size() + ext_body.data.size());
+            dst_body.append(prefix.begin(), prefix.end());
+            dst_body.append(ext_body.data.begin(), ext_body.data.end());
           }
         }
 
@@ -58,6 +73,36 @@ namespace kagome::network {
         };
       }
 
+      for (const auto &src_block : t.encoded_blocks) {
+        auto *dst_block = msg.add_blocks();
+        dst_block->set_hash(src_block.hash.toString());
+
+        if (src_block.header) {
+          dst_block->set_header(src_block.header->toString());
+        }
+
+        if (src_block.body) {
+          write_encoded_body(*src_block.body, *dst_block);
+        }
+
+        if (src_block.justification) {
+          // stored justification is its data with compact length prefix
+          common::BufferView justification{*src_block.justification};
+          scale::ScaleDecoderStream s{justification};
+          scale::CompactInteger size;
+          s >> size;
+          auto data = justification.subspan(s.currentIndex());
+          if (data.size() != size) {
+            common::raise(scale::DecodeError::NOT_ENOUGH_DATA);
+          }
+          dst_block->set_justification(
+              std::string(reinterpret_cast<const char *>(data.data()),  // NOLINT
+                          data.size()));
+
+          dst_block->set_is_empty_justification(data.empty());
+        }
+      }
+
       return appendToVec(msg, out, loaded);
     }
 
@@ -68,69 +113,246 @@ namespace kagome::network {
       const auto remains = src.size() - std::distance(src.begin(), from);
       assert(remains >= size(out));
 
-      ::api::v1::BlockResponse msg;
-      if (!msg.ParseFromArray(from.base(), remains)) {
-        return AdaptersError::PARSE_FAILED;
+      OUTCOME_TRY(read_blocks(out,
+                              common::BufferView{from.base(), remains},
+                              [](const BlockDataFields &fields)
+                                  -> outcome::result<BlockBodyOpt> {
+                                return to_block_body(fields.body);
+                              }));
+
+      std::advance(from, remains);
+      return from;
+    }
+
+    /**
+     * Zero-copy decode of response. Extrinsics of received blocks are views
+     * into `src`, which is shared by all of them and kept alive until the
+     * last block is imported. Bodies are put into `out.shared_bodies` instead
+     * of BlockData::body.
+     */
+    static outcome::result<void> readShared(
+        BlocksResponse &out, std::shared_ptr<const std::vector<uint8_t>> src) {
+      if (not src or src->empty()) {
+        return outcome::failure(std::errc::invalid_argument);
       }
+      return read_blocks(
+          out,
+          common::BufferView{*src},
+          [&](const BlockDataFields &fields) -> outcome::result<BlockBodyOpt> {
+            std::optional<primitives::SharedBlockBody> shared_body;
+            if (not fields.body.empty()) {
+              shared_body.emplace(primitives::SharedBlockBody{.buffer = src});
+              shared_body->extrinsics.reserve(fields.body.size());
+              for (auto &encoded : fields.body) {
+                OUTCOME_TRY(extrinsic, extrinsic_view(encoded));
+                shared_body->extrinsics.emplace_back(extrinsic);
+              }
+            }
+            out.shared_bodies.emplace_back(std::move(shared_body));
+            return BlockBodyOpt{};
+          });
+    }
 
-      auto &dst_blocks = out.blocks;
-      dst_blocks.reserve(msg.blocks().size());
-      for (const auto &src_block_data : msg.blocks()) {
-        OUTCOME_TRY(hash,
-                    primitives::BlockHash::fromString(src_block_data.hash()));
+   private:
+    /**
+     * Splits encoded vector of extrinsics into encoded extrinsics, which are
+     * written into the message as is
+     */
+    static void write_encoded_body(common::BufferView body,
+                                   ::api::v1::BlockData &dst_block) {
+      scale::ScaleDecoderStream s{body};
+      scale::CompactInteger count;
+      s >> count;
+      auto offset = s.currentIndex();
+      for (; count > 0; --count) {
+        scale::ScaleDecoderStream ext_s{body.subspan(offset)};
+        scale::CompactInteger size;
+        ext_s >> size;
+        auto prefix = ext_s.currentIndex();
+        if (size > body.size() - offset - prefix) {
+          common::raise(scale::DecodeError::NOT_ENOUGH_DATA);
+        }
+        // encoded extrinsic is its data with compact length prefix
+        auto ext_size = prefix + size.convert_to<size_t>();
+        dst_block.add_body()->assign(
+            reinterpret_cast<const char *>(body.data() + offset),  // NOLINT
+            ext_size);
+        offset += ext_size;
+      }
+    }
 
-        OUTCOME_TRY(header, extract_value<primitives::BlockHeader>([&]() {
-                      return src_block_data.header();
-                    }));
+    using BlockBodyOpt = std::optional<primitives::BlockBody>;
 
-        std::optional<primitives::BlockBody> bodies;
-        for (const auto &b : src_block_data.body()) {
-          if (!bodies) {
-            bodies = primitives::BlockBody{};
-          }
+    /// Fields of BlockData message, as views into the received buffer
+    struct BlockDataFields {
+      common::BufferView hash;
+      common::BufferView header;
+      std::vector<common::BufferView> body;
+      common::BufferView receipt;
+      common::BufferView message_queue;
+      common::BufferView justification;
+      bool is_empty_justification = false;
+    };
 
-          OUTCOME_TRY(
-              body, extract_value<primitives::Extrinsic>([&]() { return b; }));
-          bodies->emplace_back(std::move(body));
+    /**
+     * Parses BlockResponse message and converts its blocks. Bytes fields are
+     * not copied by parser, so extrinsics may stay views into `src`.
+     * @param make_body converts encoded extrinsics into body of block
+     */
+    template <typename F>
+    static outcome::result<void> read_blocks(BlocksResponse &out,
+                                             common::BufferView src,
+                                             F &&make_body) {
+      using google::protobuf::internal::WireFormatLite;
+      google::protobuf::io::CodedInputStream input{
+          src.data(), static_cast<int>(src.size())};
+      while (auto tag = input.ReadTag()) {
+        if (WireFormatLite::GetTagFieldNumber(tag) != 1
+            or WireFormatLite::GetTagWireType(tag)
+                   != WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          if (not WireFormatLite::SkipField(&input, tag)) {
+            return AdaptersError::PARSE_FAILED;
+          }
+          continue;
         }
+        OUTCOME_TRY(block_data, read_bytes(input, src));
+        OUTCOME_TRY(fields, parse_block_data(block_data));
+
+        OUTCOME_TRY(hash, primitives::BlockHash::fromSpan(fields.hash));
 
-        auto receipt = common::Buffer::fromString(src_block_data.receipt());
+        OUTCOME_TRY(header,
+                    extract_value<primitives::BlockHeader>(fields.header));
 
-        auto message_queue =
-            common::Buffer::fromString(src_block_data.message_queue());
+        OUTCOME_TRY(body, make_body(fields));
 
         std::optional<primitives::Justification> justification;
+        if (not fields.justification.empty()
+            or fields.is_empty_justification) {
+          justification.emplace(
+              primitives::Justification{common::Buffer{fields.justification}});
+        }
 
-        if (not src_block_data.justification().empty()
-            || src_block_data.is_empty_justification()) {
-          auto data =
-              common::Buffer::fromString(src_block_data.justification());
+        out.blocks.emplace_back(primitives::BlockData{
+            .hash = hash,
+            .header = std::move(header),
+            .body = std::move(body),
+            .receipt = common::Buffer{fields.receipt},
+            .message_queue = common::Buffer{fields.message_queue},
+            .justification = std::move(justification)});
+      }
+      if (not input.ConsumedEntireMessage()) {
+        return AdaptersError::PARSE_FAILED;
+      }
+      return outcome::success();
+    }
 
-          justification.emplace(primitives::Justification{std::move(data)});
+    static outcome::result<BlockDataFields> parse_block_data(
+        common::BufferView src) {
+      using google::protobuf::internal::WireFormatLite;
+      google::protobuf::io::CodedInputStream input{
+          src.data(), static_cast<int>(src.size())};
+      BlockDataFields fields;
+      while (auto tag = input.ReadTag()) {
+        auto bytes_field = [&]() -> common::BufferView * {
+          if (WireFormatLite::GetTagWireType(tag)
+              != WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+            return nullptr;
+          }
+          switch (WireFormatLite::GetTagFieldNumber(tag)) {
+            case 1:
+              return &fields.hash;
+            case 2:
+              return &fields.header;
+            case 3:
+              return &fields.body.emplace_back();
+            case 4:
+              return &fields.receipt;
+            case 5:
+              return &fields.message_queue;
+            case 6:
+              return &fields.justification;
+            default:
+              return nullptr;
+          }
+        }();
+        if (bytes_field != nullptr) {
+          OUTCOME_TRY(bytes, read_bytes(input, src));
+          *bytes_field = bytes;
+        } else if (WireFormatLite::GetTagFieldNumber(tag) == 7
+                   and WireFormatLite::GetTagWireType(tag)
+                           == WireFormatLite::WIRETYPE_VARINT) {
+          uint64_t value = 0;
+          if (not input.ReadVarint64(&value)) {
+            return AdaptersError::PARSE_FAILED;
+          }
+          fields.is_empty_justification = value != 0;
+        } else if (not WireFormatLite::SkipField(&input, tag)) {
+          return AdaptersError::PARSE_FAILED;
         }
+      }
+      if (not input.ConsumedEntireMessage()) {
+        return AdaptersError::PARSE_FAILED;
+      }
+      return fields;
+    }
 
-        dst_blocks.emplace_back(
-            primitives::BlockData{.hash = hash,
-                                  .header = std::move(header),
-                                  .body = std::move(bodies),
-                                  .receipt = std::move(receipt),
-                                  .message_queue = std::move(message_queue),
-                                  .justification = std::move(justification)});
+    /// @return view of length-delimited field at current position of `input`
+    static outcome::result<common::BufferView> read_bytes(
+        google::protobuf::io::CodedInputStream &input, common::BufferView src) {
+      uint32_t size = 0;
+      if (not input.ReadVarint32(&size)) {
+        return AdaptersError::PARSE_FAILED;
+      }
+      auto offset = static_cast<size_t>(input.CurrentPosition());
+      if (size > src.size() - offset
+          or not input.Skip(static_cast<int>(size))) {
+        return AdaptersError::PARSE_FAILED;
       }
+      return common::BufferView{src.subspan(offset, size)};
+    }
 
-      std::advance(from, msg.ByteSizeLong());
-      return from;
+    /// @return body owning copies of encoded extrinsics
+    static outcome::result<BlockBodyOpt> to_block_body(
+        const std::vector<common::BufferView> &encoded_body) {
+      BlockBodyOpt body;
+      if (not encoded_body.empty()) {
+        body.emplace();
+        body->reserve(encoded_body.size());
+        for (auto &encoded : encoded_body) {
+          OUTCOME_TRY(extrinsic, extrinsic_view(encoded));
+          body->emplace_back(primitives::Extrinsic{common::Buffer{extrinsic}});
+        }
+      }
+      return body;
     }
 
-   private:
-    template <typename T, typename F>
-    static outcome::result<T> extract_value(F &&f) {
-      if (const auto &buffer = std::forward<F>(f)(); !buffer.empty()) {
-        OUTCOME_TRY(
-            decoded,
-            scale::decode<T>(gsl::span<const uint8_t>(
-                reinterpret_cast<const uint8_t *>(buffer.data()),  // NOLINT
-                buffer.size())));
+    /**
+     * Zero-copy decode of encoded extrinsic
+     * @return view of extrinsic data following its compact length prefix
+     */
+    static outcome::result<common::BufferView> extrinsic_view(
+        common::BufferView encoded) {
+      if (encoded.empty()) {
+        return AdaptersError::EMPTY_DATA;
+      }
+      scale::ScaleDecoderStream s{encoded};
+      scale::CompactInteger size;
+      try {
+        s >> size;
+      } catch (const std::system_error &e) {
+        return e.code();
+      }
+      auto data = encoded.subspan(s.currentIndex());
+      if (size > data.size()) {
+        return scale::DecodeError::NOT_ENOUGH_DATA;
+      }
+      return common::BufferView{data.first(size.convert_to<size_t>())};
+    }
+
+    template <typename T>
+    static outcome::result<T> extract_value(common::BufferView buffer) {
+      if (not buffer.empty()) {
+        OUTCOME_TRY(decoded, scale::decode<T>(buffer));
         return std::move(decoded);
       }
       return AdaptersError::EMPTY_DATA;
@@ -64,6 +64,32 @@ namespace kagome::network {
           });
     }
 
+    /**
+     * Read a Protobuf message, which keeps views into the received buffer
+     * instead of copying its parts
+     * @tparam MsgType - type of the message, its adapter provides `readShared`
+     * @param cb to be called, when the message is read, or error happens
+     */
+    template <typename MsgType>
+    void readShared(ReadCallback<MsgType> &&cb) const {
+      read_writer_->read(
+          [self{shared_from_this()}, cb = std::move(cb)](auto &&read_res) {
+            if (!read_res) {
+              return cb(read_res.error());
+            }
+
+            MsgType msg;
+            if (read_res.value()) {
+              if (auto msg_res = ProtobufMessageAdapter<MsgType>::readShared(
+                      msg, read_res.value());
+                  !msg_res) {
+                return cb(msg_res.error());
+              }
+            }
+            return cb(std::move(msg));
+          });
+    }
+
     /**
      * Serialize to protobuf message and write it to the channel
      * @tparam MsgType - type of the message
@@ -534,7 +534,7 @@ namespace kagome::network {
 
   void PeerManagerImpl::updatePeerState(const PeerId &peer_id,
                                         const BlockAnnounce &announce) {
-    auto hash = hasher_->blake2b_256(scale::encode(announce.header).value());
+    auto hash = announce.header.hash(*hasher_);
 
     auto [it, _] = peer_states_.emplace(peer_id, PeerState{});
     it->second.time = clock_->now();
@@ -16,6 +16,10 @@
 namespace {
   constexpr const char *kPropagatedTransactions =
       "kagome_sync_propagated_transactions";
+  constexpr const char *kDuplicateTransactions =
+      "kagome_sync_propagated_transactions_duplicates";
+  constexpr const char *kDuplicateTransactionsBytes =
+      "kagome_sync_propagated_transactions_duplicates_bytes";
 }
 
 namespace kagome::network {
@@ -33,7 +37,9 @@ namespace kagome::network {
       std::shared_ptr<primitives::events::ExtrinsicSubscriptionEngine>
           extrinsic_events_engine,
       std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
-          ext_event_key_repo)
+          ext_event_key_repo,
+      std::shared_ptr<crypto::Hasher> hasher,
+      std::shared_ptr<libp2p::basic::Scheduler> scheduler)
       : base_(kPropagateTransactionsProtocolName,
               host,
               make_protocols(
@@ -45,11 +51,15 @@ namespace kagome::network {
         extrinsic_observer_(std::move(extrinsic_observer)),
         stream_engine_(std::move(stream_engine)),
         extrinsic_events_engine_{std::move(extrinsic_events_engine)},
-        ext_event_key_repo_{std::move(ext_event_key_repo)} {
+        ext_event_key_repo_{std::move(ext_event_key_repo)},
+        hasher_{std::move(hasher)},
+        scheduler_{std::move(scheduler)} {
     BOOST_ASSERT(extrinsic_observer_ != nullptr);
     BOOST_ASSERT(stream_engine_ != nullptr);
     BOOST_ASSERT(extrinsic_events_engine_ != nullptr);
     BOOST_ASSERT(ext_event_key_repo_ != nullptr);
+    BOOST_ASSERT(hasher_ != nullptr);
+    BOOST_ASSERT(scheduler_ != nullptr);
 
     // Register metrics
     metrics_registry_->registerCounterFamily(
@@ -57,6 +67,16 @@ namespace kagome::network {
         "Number of transactions propagated to at least one peer");
     metric_propagated_tx_counter_ =
         metrics_registry_->registerCounterMetric(kPropagatedTransactions);
+    metrics_registry_->registerCounterFamily(
+        kDuplicateTransactions,
+        "Number of transactions not sent to peers, which already know them");
+    metric_duplicate_tx_counter_ =
+        metrics_registry_->registerCounterMetric(kDuplicateTransactions);
+    metrics_registry_->registerCounterFamily(
+        kDuplicateTransactionsBytes,
+        "Size of transactions not sent to peers, which already know them");
+    metric_duplicate_tx_bytes_counter_ =
+        metrics_registry_->registerCounterMetric(kDuplicateTransactionsBytes);
   }
 
   bool PropagateTransactionsProtocol::start() {
@@ -300,6 +320,17 @@ namespace kagome::network {
                  message.extrinsics.size(),
                  peer_id);
 
+      // peer knows transactions it sent, so they are not sent back to it
+      {
+        std::lock_guard lock{self->mutex_};
+        auto &known =
+            self->known_txs_.try_emplace(peer_id, kMaxKnownTransactions)
+                .first->second;
+        for (auto &ext : message.extrinsics) {
+          known.add(self->hasher_->blake2b_256(ext.data));
+        }
+      }
+
       if (self->babe_->wasSynchronized()) {
         for (auto &ext : message.extrinsics) {
           auto result = self->extrinsic_observer_->onTxMessage(ext);
@@ -324,32 +355,100 @@ namespace kagome::network {
     SL_DEBUG(
         base_.logger(), "Propagate transactions : {} extrinsics", txs.size());
 
+    std::lock_guard lock{mutex_};
+    pending_txs_.insert(pending_txs_.end(), txs.begin(), txs.end());
+    if (send_scheduled_) {
+      return;
+    }
+    send_scheduled_ = true;
+    scheduler_->schedule(
+        [wp = weak_from_this()] {
+          if (auto self = wp.lock()) {
+            self->sendPendingTransactions();
+          }
+        },
+        kPropagateBatchDelay);
+  }
+
+  void PropagateTransactionsProtocol::sendPendingTransactions() {
+    // only peers with streams of this protocol get transactions, others
+    // must not be marked as knowing them
     std::vector<libp2p::peer::PeerId> peers;
+    const std::shared_ptr<ProtocolBase> protocol = shared_from_this();
     stream_engine_->forEachPeer(
-        [&peers](const libp2p::peer::PeerId &peer_id, const auto &) {
-          peers.push_back(peer_id);
+        [&](const libp2p::peer::PeerId &peer_id, const auto &proto_map) {
+          if (proto_map.count(protocol) != 0) {
+            peers.push_back(peer_id);
+          }
         });
-    if (peers.size() > 1) {  // One of peers is current node itself
-      metric_propagated_tx_counter_->inc(peers.size() - 1);
-      for (const auto &tx : txs) {
-        if (auto key = ext_event_key_repo_->get(tx.hash); key.has_value()) {
-          extrinsic_events_engine_->notify(
-              key.value(),
-              primitives::events::ExtrinsicLifecycleEvent::Broadcast(
-                  key.value(), peers));
+
+    std::vector<primitives::Transaction> txs;
+    // peers each transaction is sent to
+    std::vector<std::vector<libp2p::peer::PeerId>> receivers;
+    std::vector<std::shared_ptr<PropagatedExtrinsics>> messages;
+    size_t duplicates = 0;
+    size_t duplicates_bytes = 0;
+    {
+      std::lock_guard lock{mutex_};
+      txs.swap(pending_txs_);
+      send_scheduled_ = false;
+
+      // forget disconnected peers
+      for (auto it = known_txs_.begin(); it != known_txs_.end();) {
+        if (std::find(peers.begin(), peers.end(), it->first) == peers.end()) {
+          it = known_txs_.erase(it);
+        } else {
+          ++it;
         }
       }
+
+      receivers.resize(txs.size());
+      messages.reserve(peers.size());
+      for (auto &peer_id : peers) {
+        auto &known = known_txs_.try_emplace(peer_id, kMaxKnownTransactions)
+                          .first->second;
+        auto &propagated_exts =
+            messages.emplace_back(KAGOME_EXTRACT_SHARED_CACHE(
+                PropagateTransactionsProtocol, PropagatedExtrinsics));
+        propagated_exts->extrinsics.clear();
+        for (size_t i = 0; i < txs.size(); ++i) {
+          if (known.add(txs[i].hash)) {
+            propagated_exts->extrinsics.emplace_back(txs[i].ext);
+            receivers[i].emplace_back(peer_id);
+          } else {
+            ++duplicates;
+            duplicates_bytes += txs[i].ext.data.size();
+          }
+        }
+      }
+    }
+
+    for (size_t i = 0; i < peers.size(); ++i) {
+      if (not messages[i]->extrinsics.empty()) {
+        stream_engine_->send(peers[i], protocol, messages[i]);
+      }
+    }
+
+    if (duplicates != 0) {
+      SL_TRACE(base_.logger(),
+               "Skipped {} transactions already known by peers",
+               duplicates);
+      metric_duplicate_tx_counter_->inc(duplicates);
+      metric_duplicate_tx_bytes_counter_->inc(duplicates_bytes);
     }
 
-    auto propagated_exts = KAGOME_EXTRACT_SHARED_CACHE(
-        PropagateTransactionsProtocol, PropagatedExtrinsics);
-    propagated_exts->extrinsics.resize(txs.size());
-    std::transform(txs.begin(),
-                   txs.end(),
-                   propagated_exts->extrinsics.begin(),
-                   [](auto &tx) { return tx.ext; });
-    stream_engine_->broadcast<PropagatedExtrinsics>(shared_from_this(),
-                                                    propagated_exts);
+    for (size_t i = 0; i < txs.size(); ++i) {
+      if (receivers[i].empty()) {
+        continue;
+      }
+      metric_propagated_tx_counter_->inc();
+      if (auto key = ext_event_key_repo_->get(txs[i].hash); key.has_value()) {
+        extrinsic_events_engine_->notify(
+            key.value(),
+            primitives::events::ExtrinsicLifecycleEvent::Broadcast(
+                key.value(), receivers[i]));
+      }
+    }
   }
 
 }  // namespace kagome::network
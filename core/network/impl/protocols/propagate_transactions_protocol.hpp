@@ -9,14 +9,19 @@
 #include "network/protocol_base.hpp"
 
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
+#include <libp2p/basic/scheduler.hpp>
 #include <libp2p/connection/stream.hpp>
 #include <libp2p/host/host.hpp>
 
 #include "application/app_configuration.hpp"
 #include "application/chain_spec.hpp"
+#include "common/lru_set.hpp"
 #include "consensus/babe/babe.hpp"
 #include "containers/objects_cache.hpp"
+#include "crypto/hasher.hpp"
 #include "log/logger.hpp"
 #include "metrics/metrics.hpp"
 #include "network/extrinsic_observer.hpp"
@@ -58,7 +63,9 @@ namespace kagome::network {
         std::shared_ptr<primitives::events::ExtrinsicSubscriptionEngine>
             extrinsic_events_engine,
         std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
-            ext_event_key_repo);
+            ext_event_key_repo,
+        std::shared_ptr<crypto::Hasher> hasher,
+        std::shared_ptr<libp2p::basic::Scheduler> scheduler);
 
     bool start() override;
 
@@ -70,9 +77,23 @@ namespace kagome::network {
         std::function<void(outcome::result<std::shared_ptr<Stream>>)> &&cb)
         override;
 
+    /**
+     * Queues transactions to be sent with the next batch. Each peer gets only
+     * transactions it has not sent to us and we have not sent to it yet
+     */
     void propagateTransactions(gsl::span<const primitives::Transaction> txs);
 
    private:
+    /// transaction hashes remembered per peer, as in substrate
+    static constexpr size_t kMaxKnownTransactions = 10240;
+    /// delay to collect transactions into one batch
+    static constexpr std::chrono::milliseconds kPropagateBatchDelay{100};
+
+    using KnownTransactions = common::LruSet<primitives::Transaction::Hash>;
+
+    /// sends queued transactions to peers which don't know them
+    void sendPendingTransactions();
+
     enum class Direction { INCOMING, OUTGOING };
     void readHandshake(std::shared_ptr<Stream> stream,
                        Direction direction,
@@ -95,10 +116,19 @@ namespace kagome::network {
         extrinsic_events_engine_;
     std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
         ext_event_key_repo_;
+    std::shared_ptr<crypto::Hasher> hasher_;
+    std::shared_ptr<libp2p::basic::Scheduler> scheduler_;
+
+    std::mutex mutex_;
+    std::unordered_map<libp2p::peer::PeerId, KnownTransactions> known_txs_;
+    std::vector<primitives::Transaction> pending_txs_;
+    bool send_scheduled_ = false;
 
     // Metrics
     metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
     metrics::Counter *metric_propagated_tx_counter_;
+    metrics::Counter *metric_duplicate_tx_counter_;
+    metrics::Counter *metric_duplicate_tx_bytes_counter_;
   };
 
 }  // namespace kagome::network
@@ -282,6 +282,12 @@ namespace kagome::network {
           break;
         }
       }
+      for (auto &block : block_response.encoded_blocks) {
+        if (block.header or block.body or block.justification) {
+          empty = false;
+          break;
+        }
+      }
 
       if ((not empty) and stream->remotePeerId()
           and self->response_cache_.isDuplicate(stream->remotePeerId().value(),
@@ -388,39 +394,41 @@ namespace kagome::network {
              protocolName(),
              stream->remotePeerId().value());
 
-    read_writer->read<BlocksResponse>([stream,
-                                       wp = weak_from_this(),
-                                       response_handler =
-                                           std::move(response_handler)](
-                                          auto &&block_response_res) mutable {
-      auto self = wp.lock();
-      if (not self) {
-        stream->reset();
-        response_handler(ProtocolError::GONE);
-        return;
-      }
+    // extrinsics of received blocks stay in the response buffer until import
+    read_writer->readShared<BlocksResponse>(
+        [stream,
+         wp = weak_from_this(),
+         response_handler = std::move(response_handler)](
+            auto &&block_response_res) mutable {
+          auto self = wp.lock();
+          if (not self) {
+            stream->reset();
+            response_handler(ProtocolError::GONE);
+            return;
+          }
 
-      if (not block_response_res.has_value()) {
-        SL_VERBOSE(self->base_.logger(),
-                   "Error at read response from outgoing {} stream with {}: {}",
-                   self->protocolName(),
-                   stream->remotePeerId().value(),
-                   block_response_res.error());
+          if (not block_response_res.has_value()) {
+            SL_VERBOSE(
+                self->base_.logger(),
+                "Error at read response from outgoing {} stream with {}: {}",
+                self->protocolName(),
+                stream->remotePeerId().value(),
+                block_response_res.error());
 
-        stream->reset();
-        response_handler(block_response_res.as_failure());
-        return;
-      }
-      auto &blocks_response = block_response_res.value();
+            stream->reset();
+            response_handler(block_response_res.as_failure());
+            return;
+          }
+          auto &blocks_response = block_response_res.value();
 
-      SL_DEBUG(self->base_.logger(),
-               "Successful response read from outgoing {} stream with {}",
-               self->protocolName(),
-               stream->remotePeerId().value());
+          SL_DEBUG(self->base_.logger(),
+                   "Successful response read from outgoing {} stream with {}",
+                   self->protocolName(),
+                   stream->remotePeerId().value());
 
-      stream->reset();
-      response_handler(std::move(blocks_response));
-    });
+          stream->reset();
+          response_handler(std::move(blocks_response));
+        });
   }
 
   void SyncProtocolImpl::request(
@@ -43,10 +43,13 @@ namespace kagome::network {
   }
 
   outcome::result<std::pair<KeyValueStateEntry, size_t>>
-  StateProtocolObserverImpl::getEntry(const storage::trie::RootHash &hash,
-                                      const common::Buffer &key,
-                                      size_t limit) const {
-    OUTCOME_TRY(batch, storage_->getEphemeralBatchAt(hash));
+  StateProtocolObserverImpl::getEntry(
+      const storage::trie::TrieSnapshot &snapshot,
+      const storage::trie::RootHash &hash,
+      const common::Buffer &key,
+      size_t limit) const {
+    // child trie is read from the same snapshot as the main one
+    OUTCOME_TRY(batch, snapshot.batchAt(hash));
 
     auto cursor = batch->trieCursor();
 
@@ -80,7 +83,9 @@ namespace kagome::network {
   outcome::result<network::StateResponse>
   StateProtocolObserverImpl::onStateRequest(const StateRequest &request) const {
     OUTCOME_TRY(header, blocks_headers_->getBlockHeader(request.hash));
-    OUTCOME_TRY(batch, storage_->getEphemeralBatchAt(header.state_root));
+    // snapshot is not affected by blocks imported meanwhile
+    OUTCOME_TRY(snapshot, storage_->getSnapshotAt(header.state_root));
+    OUTCOME_TRY(batch, snapshot->batch());
 
     auto cursor = batch->trieCursor();
     // if key is not empty continue iteration from place where left
@@ -110,7 +115,8 @@ namespace kagome::network {
                     storage::trie::RootHash::fromSpan(*value_res.value()));
         OUTCOME_TRY(
             entry_res,
-            this->getEntry(hash, request.start[1], MAX_RESPONSE_BYTES - size));
+            this->getEntry(
+                *snapshot, hash, request.start[1], MAX_RESPONSE_BYTES - size));
         response.entries.emplace_back(std::move(entry_res.first));
         size += entry_res.second;
       } else {
@@ -136,8 +142,10 @@ namespace kagome::network {
           OUTCOME_TRY(hash,
                       storage::trie::RootHash::fromSpan(*value_res.value()));
           OUTCOME_TRY(entry_res,
-                      this->getEntry(
-                          hash, common::Buffer(), MAX_RESPONSE_BYTES - size));
+                      this->getEntry(*snapshot,
+                                     hash,
+                                     common::Buffer(),
+                                     MAX_RESPONSE_BYTES - size));
           response.entries.emplace_back(std::move(entry_res.first));
           size += entry_res.second;
           // not complete means response bytes limit exceeded
@@ -11,6 +11,7 @@
 
 #include "log/logger.hpp"
 #include "network/types/state_response.hpp"
+#include "storage/trie/trie_snapshot.hpp"
 #include "storage/trie/types.hpp"
 
 namespace kagome {
@@ -41,6 +42,7 @@ namespace kagome::network {
 
    private:
     outcome::result<std::pair<KeyValueStateEntry, size_t>> getEntry(
+        const storage::trie::TrieSnapshot &snapshot,
         const storage::trie::RootHash &hash,
         const common::Buffer &key,
         size_t limit) const;
@@ -28,13 +28,16 @@ namespace kagome::network {
   SyncProtocolObserverImpl::SyncProtocolObserverImpl(
       std::shared_ptr<blockchain::BlockTree> block_tree,
       std::shared_ptr<blockchain::BlockHeaderRepository> blocks_headers,
+      std::shared_ptr<blockchain::BlockStorage> block_storage,
       std::shared_ptr<PeerManager> peer_manager)
       : block_tree_{std::move(block_tree)},
         blocks_headers_{std::move(blocks_headers)},
+        block_storage_{std::move(block_storage)},
         peer_manager_{std::move(peer_manager)},
         log_(log::createLogger("SyncProtocolObserver", "network")) {
     BOOST_ASSERT(block_tree_);
     BOOST_ASSERT(blocks_headers_);
+    BOOST_ASSERT(block_storage_);
     BOOST_ASSERT(peer_manager_);
   }
 
@@ -70,40 +73,21 @@ namespace kagome::network {
 
     // thirdly, fill the resulting response with data, which we were asked for
     fillBlocksResponse(request, response, chain_hash);
-    if (response.blocks.empty()) {
+    const auto &blocks = response.encoded_blocks;
+    if (blocks.empty()) {
       SL_DEBUG(log_, "Return response id={}: no blocks", request_id);
-    } else if (response.blocks.size() == 1) {
-      if (response.blocks.front().header.has_value()) {
-        SL_DEBUG(log_,
-                 "Return response id={}: {}, count 1",
-                 request_id,
-                 primitives::BlockInfo(response.blocks.front().header->number,
-                                       response.blocks.front().hash));
-      } else {
-        SL_DEBUG(log_,
-                 "Return response id={}: {}, count 1",
-                 request_id,
-                 response.blocks.front().hash);
-      }
+    } else if (blocks.size() == 1) {
+      SL_DEBUG(log_,
+               "Return response id={}: {}, count 1",
+               request_id,
+               blocks.front().hash);
     } else {
-      if (response.blocks.front().header.has_value()
-          and response.blocks.back().header.has_value()) {
-        SL_DEBUG(log_,
-                 "Return response id={}: from {} to {}, count {}",
-                 request_id,
-                 primitives::BlockInfo(response.blocks.front().header->number,
-                                       response.blocks.front().hash),
-                 primitives::BlockInfo(response.blocks.back().header->number,
-                                       response.blocks.back().hash),
-                 response.blocks.size());
-      } else {
-        SL_DEBUG(log_,
-                 "Return response id={}: from {} to {}, count {}",
-                 request_id,
-                 response.blocks.front().hash,
-                 response.blocks.back().hash,
-                 response.blocks.size());
-      }
+      SL_DEBUG(log_,
+               "Return response id={}: from {} to {}, count {}",
+               request_id,
+               blocks.front().hash,
+               blocks.back().hash,
+               blocks.size());
     }
 
     requested_ids_.erase(request_id);
@@ -158,34 +142,19 @@ namespace kagome::network {
     auto justification_needed =
         request.attributeIsSet(network::BlockAttribute::JUSTIFICATION);
 
-    for (const auto &hash : hash_chain) {
-      auto &new_block =
-          response.blocks.emplace_back(primitives::BlockData{hash});
-
-      if (header_needed) {
-        auto header_res = blocks_headers_->getBlockHeader(hash);
-        if (header_res) {
-          new_block.header = std::move(header_res.value());
-        } else {
-          response.blocks.pop_back();
-          break;
-        }
-      }
-      if (body_needed) {
-        auto body_res = block_tree_->getBlockBody(hash);
-        if (body_res) {
-          new_block.body = std::move(body_res.value());
-        } else {
-          response.blocks.pop_back();
-          break;
-        }
-      }
-      if (justification_needed) {
-        auto justification_res = block_tree_->getBlockJustification(hash);
-        if (justification_res) {
-          new_block.justification = std::move(justification_res.value());
-        }
-      }
+    // stored blocks are spliced into the response without decoding
+    auto blocks_res =
+        block_storage_->getEncodedBlocks(hash_chain,
+                                         header_needed,
+                                         body_needed,
+                                         justification_needed,
+                                         kMaxBlocksBytesInResponse);
+    if (not blocks_res) {
+      log_->warn("cannot read requested blocks: {}", blocks_res.error());
+      return;
+    }
+    for (auto &block : blocks_res.value()) {
+      response.encoded_blocks.emplace_back(std::move(block));
     }
   }
 }  // namespace kagome::network
@@ -12,6 +12,7 @@
 #include <libp2p/peer/peer_info.hpp>
 
 #include "blockchain/block_header_repository.hpp"
+#include "blockchain/block_storage.hpp"
 #include "blockchain/block_tree.hpp"
 #include "log/logger.hpp"
 #include "network/peer_manager.hpp"
@@ -29,6 +30,7 @@ namespace kagome::network {
     SyncProtocolObserverImpl(
         std::shared_ptr<blockchain::BlockTree> block_tree,
         std::shared_ptr<blockchain::BlockHeaderRepository> blocks_headers,
+        std::shared_ptr<blockchain::BlockStorage> block_storage,
         std::shared_ptr<PeerManager> peer_manager);
 
     ~SyncProtocolObserverImpl() override = default;
@@ -49,6 +51,7 @@ namespace kagome::network {
 
     std::shared_ptr<blockchain::BlockTree> block_tree_;
     std::shared_ptr<blockchain::BlockHeaderRepository> blocks_headers_;
+    std::shared_ptr<blockchain::BlockStorage> block_storage_;
 
     mutable std::unordered_set<BlocksRequest::Fingerprint> requested_ids_;
     std::shared_ptr<PeerManager> peer_manager_;
@@ -52,6 +52,8 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::network, SynchronizerImpl::Error, e) {
 namespace {
   constexpr const char *kImportQueueLength =
       "kagome_import_queue_blocks_submitted";
+  constexpr const char *kReusedHeaderHashes =
+      "kagome_block_header_hashes_reused";
   constexpr uint32_t kBabeDigestBatch = 100;
 
   kagome::network::BlockAttributes attributesForSync(
@@ -83,6 +85,7 @@ namespace kagome::network {
       std::shared_ptr<consensus::babe::BlockExecutor> block_executor,
       std::shared_ptr<storage::trie::TrieSerializer> serializer,
       std::shared_ptr<storage::trie::TrieStorage> storage,
+      std::shared_ptr<storage::SpacedStorage> spaced_storage,
       std::shared_ptr<network::Router> router,
       std::shared_ptr<libp2p::basic::Scheduler> scheduler,
       std::shared_ptr<crypto::Hasher> hasher,
@@ -97,6 +100,7 @@ namespace kagome::network {
         block_executor_(std::move(block_executor)),
         serializer_(std::move(serializer)),
         storage_(std::move(storage)),
+        spaced_storage_(std::move(spaced_storage)),
         router_(std::move(router)),
         scheduler_(std::move(scheduler)),
         hasher_(std::move(hasher)),
@@ -109,6 +113,7 @@ namespace kagome::network {
     BOOST_ASSERT(block_executor_);
     BOOST_ASSERT(serializer_);
     BOOST_ASSERT(storage_);
+    BOOST_ASSERT(spaced_storage_);
     BOOST_ASSERT(router_);
     BOOST_ASSERT(scheduler_);
     BOOST_ASSERT(hasher_);
@@ -125,6 +130,13 @@ namespace kagome::network {
     metric_import_queue_length_ =
         metrics_registry_->registerGaugeMetric(kImportQueueLength);
     metric_import_queue_length_->set(0);
+    metrics_registry_->registerGaugeFamily(
+        kReusedHeaderHashes,
+        "Number of block header hashes taken from memoized value instead of "
+        "calculation");
+    metric_reused_header_hashes_ =
+        metrics_registry_->registerGaugeMetric(kReusedHeaderHashes);
+    metric_reused_header_hashes_->set(primitives::reusedBlockHeaderHashes());
 
     app_state_manager_->takeControl(*this);
   }
@@ -132,6 +144,9 @@ namespace kagome::network {
   /** @see AppStateManager::takeControl */
   void SynchronizerImpl::stop() {
     node_is_shutting_down_ = true;
+    if (auto res = spaced_storage_->setBulkImport(false); res.has_error()) {
+      SL_ERROR(log_, "Can't persist bulk import: {}", res.error());
+    }
   }
 
   bool SynchronizerImpl::subscribeToBlock(
@@ -308,7 +323,7 @@ namespace kagome::network {
       const primitives::BlockHeader &header,
       const libp2p::peer::PeerId &peer_id,
       Synchronizer::SyncResultHandler &&handler) {
-    auto block_hash = hasher_->blake2b_256(scale::encode(header).value());
+    auto block_hash = header.hash(*hasher_);
     const primitives::BlockInfo block_info(header.number, block_hash);
 
     // Block was applied before
@@ -454,6 +469,7 @@ namespace kagome::network {
         return;
       }
       auto &blocks = response_res.value().blocks;
+      auto &shared_bodies = response_res.value().shared_bodies;
 
       // No block in response is abnormal situation. Requested block must be
       // existed because finding in interval of numbers of blocks that must
@@ -628,6 +644,7 @@ namespace kagome::network {
         return;
       }
       auto &blocks = response_res.value().blocks;
+      auto &shared_bodies = response_res.value().shared_bodies;
 
       // No block in response is abnormal situation.
       // At least one starting block should be returned as existing
@@ -652,7 +669,8 @@ namespace kagome::network {
       bool some_blocks_added = false;
       primitives::BlockInfo last_loaded_block;
 
-      for (auto &block : blocks) {
+      for (size_t i = 0; i < blocks.size(); ++i) {
+        auto &block = blocks[i];
         // Check if header is provided
         if (not block.header.has_value()) {
           SL_ERROR(self->log_,
@@ -749,9 +767,8 @@ namespace kagome::network {
           return;
         }
 
-        // Check if hash is valid
-        auto calculated_hash =
-            self->hasher_->blake2b_256(scale::encode(header).value());
+        // Check if hash is valid, it is memoized for the next import steps
+        auto &calculated_hash = header.updateHash(*self->hasher_);
         if (block.hash != calculated_hash) {
           SL_ERROR(self->log_,
                    "Can't complete blocks loading from {} starting from "
@@ -771,10 +788,7 @@ namespace kagome::network {
 
         // Add block in queue and save peer or just add peer for existing record
         auto it = self->known_blocks_.find(block.hash);
-        if (it == self->known_blocks_.end()) {
-          self->known_blocks_.emplace(block.hash, KnownBlock{block, {peer_id}});
-          self->metric_import_queue_length_->set(self->known_blocks_.size());
-        } else {
+        if (it != self->known_blocks_.end()) {
           it->second.peers.emplace(peer_id);
           SL_TRACE(self->log_,
                    "Skip block {} received from {}: already enqueued",
@@ -791,6 +805,18 @@ namespace kagome::network {
         self->generations_.emplace(header.number, block.hash);
         self->ancestry_.emplace(header.parent_hash, block.hash);
 
+        // Response is not used anymore, so block is moved with its body
+        // instead of copying every extrinsic
+        auto hash = block.hash;
+        std::optional<primitives::SharedBlockBody> shared_body;
+        if (i < shared_bodies.size()) {
+          shared_body = std::move(shared_bodies[i]);
+        }
+        self->known_blocks_.emplace(
+            hash,
+            KnownBlock{std::move(block), std::move(shared_body), {peer_id}});
+        self->metric_import_queue_length_->set(self->known_blocks_.size());
+
         some_blocks_added = true;
       }
 
@@ -1049,9 +1075,8 @@ namespace kagome::network {
             cb(Error::RESPONSE_WITHOUT_BLOCK_HEADER);
             return;
           }
-          primitives::BlockInfo info{
-              header->number,
-              self->hasher_->blake2b_256(scale::encode(*header).value())};
+          primitives::BlockInfo info{header->number,
+                                     header->updateHash(*self->hasher_)};
           if (info != block) {
             cb(Error::INVALID_HASH);
             return;
@@ -1252,10 +1277,14 @@ namespace kagome::network {
 
         if (sync_method_ == application::AppConfiguration::SyncMethod::Full) {
           // Regular syncing
+          // extrinsics received as views are copied only now
+          auto &shared_body = it->second.shared_body;
           primitives::Block block{
               .header = std::move(block_data.header.value()),
-              .body = std::move(block_data.body.value()),
+              .body = shared_body ? shared_body->toBlockBody()
+                                  : std::move(block_data.body.value()),
           };
+          shared_body.reset();
           block_executor_->applyBlock(
               std::move(block), block_data.justification, std::move(callback));
 
@@ -1383,6 +1412,8 @@ namespace kagome::network {
       SL_TRACE(log_, "{} blocks in queue", known_blocks_.size());
     }
     metric_import_queue_length_->set(known_blocks_.size());
+    metric_reused_header_hashes_->set(primitives::reusedBlockHeaderHashes());
+    updateBulkImport();
     scheduler_->schedule([wp = weak_from_this()] {
       if (auto self = wp.lock()) {
         self->applyNextBlock();
@@ -1457,6 +1488,25 @@ namespace kagome::network {
     return affected;
   }
 
+  void SynchronizerImpl::updateBulkImport() {
+    const bool far_from_tip = known_blocks_.size() > kBulkImportMinQueueLength;
+    if (far_from_tip != bulk_import_) {
+      bulk_import_ = far_from_tip;
+      bulk_import_group_blocks_ = 0;
+      if (auto res = spaced_storage_->setBulkImport(bulk_import_);
+          res.has_error()) {
+        SL_ERROR(log_, "Can't switch bulk import: {}", res.error());
+      }
+      return;
+    }
+    if (bulk_import_ and ++bulk_import_group_blocks_ >= kBulkImportGroupSize) {
+      bulk_import_group_blocks_ = 0;
+      if (auto res = spaced_storage_->flushBulkImport(); res.has_error()) {
+        SL_ERROR(log_, "Can't persist bulk import: {}", res.error());
+      }
+    }
+  }
+
   void SynchronizerImpl::prune(const primitives::BlockInfo &finalized_block) {
     // Remove blocks whose numbers less finalized one
     while (not generations_.empty()) {
@@ -20,6 +20,7 @@
 #include "metrics/metrics.hpp"
 #include "network/impl/state_sync_request_flow.hpp"
 #include "network/router.hpp"
+#include "primitives/shared_block_body.hpp"
 #include "primitives/event_types.hpp"
 #include "storage/spaced_storage.hpp"
 #include "telemetry/service.hpp"
@@ -68,6 +69,13 @@ namespace kagome::network {
     static constexpr std::chrono::milliseconds kRecentnessDuration =
         std::chrono::seconds(60);
 
+    /// Bulk import is used while more blocks than this are queued, i.e.
+    /// while node is catching up and is far from the tip of chain
+    static constexpr size_t kBulkImportMinQueueLength = 16;
+
+    /// Writes of bulk import are persisted once per this number of blocks
+    static constexpr size_t kBulkImportGroupSize = 256;
+
     enum class Error {
       SHUTTING_DOWN = 1,
       EMPTY_RESPONSE,
@@ -91,6 +99,7 @@ namespace kagome::network {
         std::shared_ptr<consensus::babe::BlockExecutor> block_executor,
         std::shared_ptr<storage::trie::TrieSerializer> serializer,
         std::shared_ptr<storage::trie::TrieStorage> storage,
+        std::shared_ptr<storage::SpacedStorage> spaced_storage,
         std::shared_ptr<network::Router> router,
         std::shared_ptr<libp2p::basic::Scheduler> scheduler,
         std::shared_ptr<crypto::Hasher> hasher,
@@ -206,6 +215,10 @@ namespace kagome::network {
         const libp2p::peer::PeerId &peer_id,
         const BlocksRequest::Fingerprint &fingerprint);
 
+    /// Switches bulk import mode of database depending on length of queue,
+    /// and persists writes of every group of blocks imported in that mode
+    void updateBulkImport();
+
     void syncState();
     outcome::result<void> syncState(std::unique_lock<std::mutex> &lock,
                                     outcome::result<StateResponse> &&_res);
@@ -217,6 +230,7 @@ namespace kagome::network {
     std::shared_ptr<consensus::babe::BlockExecutor> block_executor_;
     std::shared_ptr<storage::trie::TrieSerializer> serializer_;
     std::shared_ptr<storage::trie::TrieStorage> storage_;
+    std::shared_ptr<storage::SpacedStorage> spaced_storage_;
     std::shared_ptr<network::Router> router_;
     std::shared_ptr<libp2p::basic::Scheduler> scheduler_;
     std::shared_ptr<crypto::Hasher> hasher_;
@@ -230,6 +244,7 @@ namespace kagome::network {
     // Metrics
     metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
     metrics::Gauge *metric_import_queue_length_;
+    metrics::Gauge *metric_reused_header_hashes_;
 
     log::Logger log_ = log::createLogger("Synchronizer", "synchronizer");
     telemetry::Telemetry telemetry_ = telemetry::createTelemetryService();
@@ -248,6 +263,8 @@ namespace kagome::network {
     struct KnownBlock {
       /// Data of block
       primitives::BlockData data;
+      /// Body of block, when it is received as views into response buffer
+      std::optional<primitives::SharedBlockBody> shared_body;
       /// Peers who know this block
       std::set<libp2p::peer::PeerId> peers;
     };
@@ -278,6 +295,9 @@ namespace kagome::network {
     std::multimap<primitives::BlockInfo, SyncResultHandler> subscriptions_;
 
     std::atomic_bool applying_in_progress_ = false;
+
+    bool bulk_import_ = false;
+    size_t bulk_import_group_blocks_ = 0;
     std::atomic_bool asking_blocks_portion_in_progress_ = false;
     std::set<libp2p::peer::PeerId> busy_peers_;
 
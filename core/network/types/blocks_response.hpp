@@ -8,16 +8,26 @@
 
 #include "common/size_limited_containers.hpp"
 #include "primitives/block_data.hpp"
+#include "primitives/shared_block_body.hpp"
 
 namespace kagome::network {
 
   constexpr size_t kMaxBlocksInResponse = 256;
 
+  /// Limit of total size of encoded blocks in response, as in substrate
+  constexpr size_t kMaxBlocksBytesInResponse = 8 * 1024 * 1024;
+
   /**
    * Response to the BlockRequest
    */
   struct BlocksResponse {
     common::SLVector<primitives::BlockData, kMaxBlocksInResponse> blocks{};
+    /// blocks as they are stored, written after `blocks` without re-encoding
+    common::SLVector<primitives::EncodedBlockData, kMaxBlocksInResponse>
+        encoded_blocks{};
+    /// bodies of received `blocks` by index, when response is decoded without
+    /// copying extrinsics; BlockData::body is empty then
+    std::vector<std::optional<primitives::SharedBlockBody>> shared_bodies{};
   };
 
 }  // namespace kagome::network
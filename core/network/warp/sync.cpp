@@ -59,7 +59,7 @@ namespace kagome::network {
     for (size_t i = 0; i < res.proofs.size(); ++i) {
       auto &fragment = res.proofs[i];
       primitives::BlockInfo block_info{
-          hasher_->blake2b_256(scale::encode(fragment.header).value()),
+          fragment.header.hash(*hasher_),
           fragment.header.number,
       };
       if (fragment.justification.block_info != block_info) {
@@ -52,7 +52,7 @@ namespace kagome::offchain {
     BOOST_ASSERT(executor_);
     BOOST_ASSERT(ocw_pool_);
 
-    auto hash = hasher_->blake2b_256(scale::encode(header_).value());
+    auto hash = header_.hash(*hasher_);
     const_cast<primitives::BlockInfo &>(block_) =
         primitives::BlockInfo(header_.number, hash);
 
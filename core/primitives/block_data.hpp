@@ -29,6 +29,18 @@ namespace kagome::primitives {
     std::optional<primitives::Justification> justification{};
   };
 
+  /**
+   * Parts of the block as they are stored, SCALE encoded. Used to serve blocks
+   * without decoding and encoding them again
+   */
+  struct EncodedBlockData {
+    primitives::BlockHash hash;
+    std::optional<common::Buffer> header{};
+    /// encoded vector of extrinsics
+    std::optional<common::Buffer> body{};
+    std::optional<common::Buffer> justification{};
+  };
+
   struct BlockDataFlags {
     static BlockDataFlags allSet(primitives::BlockHash hash) {
       return BlockDataFlags{std::move(hash), true, true, true, true, true};
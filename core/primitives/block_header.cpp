@@ -1,11 +1,38 @@
 #include "primitives/block_header.hpp"
 
+#include <atomic>
+
+#include <boost/assert.hpp>
+
 namespace kagome::primitives {
 
+  namespace {
+    std::atomic<uint64_t> reused_hashes{0};
+  }
+
   outcome::result<BlockHash> calculateBlockHash(BlockHeader const &header,
                                                 crypto::Hasher const &hasher) {
     OUTCOME_TRY(enc_header, scale::encode(header));
     return hasher.blake2b_256(enc_header);
   }
 
+  const BlockHash &BlockHeader::updateHash(const crypto::Hasher &hasher) {
+    hash_opt = calculateBlockHash(*this, hasher).value();
+    return *hash_opt;
+  }
+
+  BlockHash BlockHeader::hash(const crypto::Hasher &hasher) const {
+    if (hash_opt.has_value()) {
+      BOOST_ASSERT_MSG(*hash_opt == calculateBlockHash(*this, hasher).value(),
+                       "Header was modified after its hash was memoized");
+      reused_hashes.fetch_add(1, std::memory_order_relaxed);
+      return *hash_opt;
+    }
+    return calculateBlockHash(*this, hasher).value();
+  }
+
+  uint64_t reusedBlockHeaderHashes() {
+    return reused_hashes.load(std::memory_order_relaxed);
+  }
+
 }  // namespace kagome::primitives
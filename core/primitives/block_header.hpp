@@ -6,6 +6,7 @@
 #ifndef KAGOME_PRIMITIVES_BLOCK_HEADER_HPP
 #define KAGOME_PRIMITIVES_BLOCK_HEADER_HPP
 
+#include <optional>
 #include <type_traits>
 #include <vector>
 
@@ -29,6 +30,23 @@ namespace kagome::primitives {
     common::Hash256 extrinsics_root{};     ///< field for validation integrity
     Digest digest{};                       ///< chain-specific auxiliary data
 
+    /// Memoized hash of the header, it is neither encoded nor compared.
+    /// Set by `updateHash` when header is received or created, and must be
+    /// reset if header is modified after that.
+    std::optional<BlockHash> hash_opt{};
+
+    /**
+     * Calculates hash of the header and memoizes it
+     * @return calculated hash
+     */
+    const BlockHash &updateHash(const crypto::Hasher &hasher);
+
+    /**
+     * @return memoized hash if any, otherwise calculated one.
+     * Memoized hash is verified in debug build.
+     */
+    BlockHash hash(const crypto::Hasher &hasher) const;
+
     bool operator==(const BlockHeader &rhs) const {
       return std::tie(parent_hash, number, state_root, extrinsics_root, digest)
           == std::tie(rhs.parent_hash,
@@ -91,12 +109,17 @@ namespace kagome::primitives {
     s >> bh.parent_hash >> number_compact >> bh.state_root >> bh.extrinsics_root
         >> bh.digest;
     bh.number = number_compact.convert_to<BlockNumber>();
+    bh.hash_opt.reset();
     return s;
   }
 
   outcome::result<BlockHash> calculateBlockHash(const BlockHeader &header,
                                                 const crypto::Hasher &hasher);
 
+  /// Number of header hashes, which were taken from memoized value instead of
+  /// calculation
+  uint64_t reusedBlockHeaderHashes();
+
 }  // namespace kagome::primitives
 
 #endif  // KAGOME_PRIMITIVES_BLOCK_HEADER_HPP
@@ -0,0 +1,44 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_PRIMITIVES_SHARED_BLOCK_BODY_HPP
+#define KAGOME_PRIMITIVES_SHARED_BLOCK_BODY_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/buffer_view.hpp"
+#include "primitives/block.hpp"
+
+namespace kagome::primitives {
+
+  /**
+   * Block body, which extrinsics are views into received message instead of
+   * separate buffers. Message is shared by bodies of all blocks decoded from
+   * it and is kept alive while any of them is alive.
+   */
+  struct SharedBlockBody {
+    /// memory extrinsics refer to
+    std::shared_ptr<const std::vector<uint8_t>> buffer;
+    /// data of extrinsics, without length prefix
+    std::vector<common::BufferView> extrinsics;
+
+    /**
+     * @return body owning its extrinsics, data is copied only here, when block
+     * is imported
+     */
+    BlockBody toBlockBody() const {
+      BlockBody body;
+      body.reserve(extrinsics.size());
+      for (auto &extrinsic : extrinsics) {
+        body.emplace_back(Extrinsic{common::Buffer{extrinsic}});
+      }
+      return body;
+    }
+  };
+
+}  // namespace kagome::primitives
+
+#endif  // KAGOME_PRIMITIVES_SHARED_BLOCK_BODY_HPP
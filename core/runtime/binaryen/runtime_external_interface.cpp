@@ -6,6 +6,7 @@
 #include "runtime/binaryen/runtime_external_interface.hpp"
 
 #include "host_api/host_api_factory.hpp"
+#include "host_api/host_api_profiler.hpp"
 #include "runtime/memory.hpp"
 
 namespace {
@@ -297,7 +298,26 @@ namespace kagome::runtime::binaryen {
       wasm::LiteralList &arguments) {
     this_.checkArguments(
         import->base.c_str(), hostApiFuncArgSize<mf>(), arguments.size());
-    return callHostApiFunc<mf>(this_.host_api_.get(), arguments);
+    if (not host_api::HostApiProfiler::enabled()) {
+      return callHostApiFunc<mf>(this_.host_api_.get(), arguments);
+    }
+    static const auto function_id =
+        host_api::HostApiProfiler::registerFunction(import->base.c_str());
+    static const auto spans =
+        host_api::HostApiProfiler::spanLayout(import->base.c_str());
+    uint64_t bytes = 0;
+    for (size_t i = 0; i < arguments.size(); ++i) {
+      if (arguments[i].type == wasm::i64) {
+        bytes +=
+            spans.argBytes(i, static_cast<uint64_t>(arguments[i].geti64()));
+      }
+    }
+    host_api::HostApiProfiler::Call call{function_id, bytes};
+    auto result = callHostApiFunc<mf>(this_.host_api_.get(), arguments);
+    if (result.type == wasm::i64) {
+      call.addBytes(spans.resultBytes(static_cast<uint64_t>(result.geti64())));
+    }
+    return result;
   }
 
   void RuntimeExternalInterface::init(wasm::Module &wasm,
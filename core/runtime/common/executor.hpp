@@ -8,6 +8,8 @@
 
 #include "runtime/raw_executor.hpp"
 
+#include <algorithm>
+#include <array>
 #include <optional>
 
 #include "common/buffer.hpp"
@@ -81,7 +83,8 @@ namespace kagome::runtime {
                                    std::string_view name,
                                    Args &&...args) {
       OUTCOME_TRY(env, env_factory_->start(block_info, storage_state)->make());
-      return callWithCache<Result>(*env, name, std::forward<Args>(args)...);
+      OUTCOME_TRY(encoded_args, encodeArgs(std::forward<Args>(args)...));
+      return callWithCache<Result>(*env, name, encoded_args);
     }
 
     /**
@@ -94,8 +97,8 @@ namespace kagome::runtime {
                                    std::string_view name,
                                    Args &&...args) {
       OUTCOME_TRY(env_template, env_factory_->start(block_hash));
-      OUTCOME_TRY(env, env_template->make());
-      return callWithCache<Result>(*env, name, std::forward<Args>(args)...);
+      OUTCOME_TRY(encoded_args, encodeArgs(std::forward<Args>(args)...));
+      return callAtWithCache<Result>(*env_template, name, encoded_args);
     }
 
     /**
@@ -107,8 +110,8 @@ namespace kagome::runtime {
     outcome::result<Result> callAtGenesis(std::string_view name,
                                           Args &&...args) {
       OUTCOME_TRY(env_template, env_factory_->start());
-      OUTCOME_TRY(env, env_template->make());
-      return callWithCache<Result>(*env, name, std::forward<Args>(args)...);
+      OUTCOME_TRY(encoded_args, encodeArgs(std::forward<Args>(args)...));
+      return callAtWithCache<Result>(*env_template, name, encoded_args);
     }
 
     outcome::result<common::Buffer> callAtRaw(
@@ -116,22 +119,15 @@ namespace kagome::runtime {
         std::string_view name,
         const common::Buffer &encoded_args) override {
       OUTCOME_TRY(env_template, env_factory_->start(block_hash));
-      OUTCOME_TRY(env, env_template->make());
-
-      auto &memory = env->memory_provider->getCurrentMemory()->get();
-
-      KAGOME_PROFILE_START(call_execution)
-
-      auto result_span =
-          env->module_instance->callExportFunction(name, encoded_args);
-
-      KAGOME_PROFILE_END(call_execution)
-      OUTCOME_TRY(span, result_span);
-
-      OUTCOME_TRY(env->module_instance->resetEnvironment());
-      auto result = memory.loadN(span.ptr, span.size);
-
-      return result;
+      auto raw_call = [&]() -> outcome::result<Buffer> {
+        OUTCOME_TRY(env, env_template->make());
+        return callRaw(*env, name, encoded_args);
+      };
+      if (cache_ != nullptr and isPureCall(name)) {
+        return cache_->getCallResult(
+            env_template->storageState(), name, encoded_args, raw_call);
+      }
+      return raw_call();
     }
 
     /**
@@ -145,13 +141,43 @@ namespace kagome::runtime {
     outcome::result<Result> call(RuntimeEnvironment &env,
                                  std::string_view name,
                                  Args &&...args) {
-      auto &memory = env.memory_provider->getCurrentMemory()->get();
+      OUTCOME_TRY(encoded_args, encodeArgs(std::forward<Args>(args)...));
+      return callEncoded<Result>(env, name, encoded_args);
+    }
+
+   private:
+    /**
+     * Runtime calls, results of which depend only on storage state and
+     * arguments. Their results are cached by state root, so repeated calls
+     * at the same state (e.g. by RPC) don't even need runtime instance.
+     * Core_version and Metadata_metadata are not here, they depend only on
+     * code and are cached by code hash, which is shared by many states.
+     */
+    static bool isPureCall(std::string_view name) {
+      static constexpr std::array<std::string_view, 4> kPureCalls{
+          "AccountNonceApi_account_nonce",
+          "TransactionPaymentApi_query_fee_details",
+          "TransactionPaymentApi_query_info",
+          "TransactionPaymentCallApi_query_call_info",
+      };
+      return std::find(kPureCalls.begin(), kPureCalls.end(), name)
+          != kPureCalls.end();
+    }
 
+    template <typename... Args>
+    static outcome::result<Buffer> encodeArgs(Args &&...args) {
       Buffer encoded_args{};
       if constexpr (sizeof...(args) > 0) {
         OUTCOME_TRY(res, scale::encode(std::forward<Args>(args)...));
         encoded_args.put(std::move(res));
       }
+      return encoded_args;
+    }
+
+    outcome::result<Buffer> callRaw(RuntimeEnvironment &env,
+                                    std::string_view name,
+                                    const Buffer &encoded_args) {
+      auto &memory = env.memory_provider->getCurrentMemory()->get();
 
       KAGOME_PROFILE_START(call_execution)
 
@@ -162,42 +188,85 @@ namespace kagome::runtime {
       OUTCOME_TRY(span, result_span);
 
       OUTCOME_TRY(env.module_instance->resetEnvironment());
+      return memory.loadN(span.ptr, span.size);
+    }
 
+    template <typename Result>
+    outcome::result<Result> callEncoded(RuntimeEnvironment &env,
+                                        std::string_view name,
+                                        const Buffer &encoded_args) {
       if constexpr (std::is_void_v<Result>) {
+        KAGOME_PROFILE_START(call_execution)
+
+        auto result_span =
+            env.module_instance->callExportFunction(name, encoded_args);
+
+        KAGOME_PROFILE_END(call_execution)
+        OUTCOME_TRY(result_span);
+
+        OUTCOME_TRY(env.module_instance->resetEnvironment());
         return outcome::success();
       } else {
-        auto result = memory.loadN(span.ptr, span.size);
-        Result t{};
-        scale::ScaleDecoderStream s(result);
-        try {
-          s >> t;
-          // Check whether the whole byte buffer was consumed
-          if (s.hasMore(1)) {
-            SL_ERROR(logger_,
-                     "Runtime API call result size exceeds the size of the "
-                     "type to initialize {} (read {}, total size {})",
-                     typeid(Result).name(),
-                     s.currentIndex(),
-                     s.span().size_bytes());
-            return outcome::failure(std::errc::illegal_byte_sequence);
-          }
-          return outcome::success(std::move(t));
-        } catch (std::system_error &e) {
-          return outcome::failure(e.code());
+        OUTCOME_TRY(result, callRaw(env, name, encoded_args));
+        return decodeResult<Result>(result);
+      }
+    }
+
+    template <typename Result>
+    outcome::result<Result> decodeResult(common::BufferView result) {
+      Result t{};
+      scale::ScaleDecoderStream s(result);
+      try {
+        s >> t;
+        // Check whether the whole byte buffer was consumed
+        if (s.hasMore(1)) {
+          SL_ERROR(logger_,
+                   "Runtime API call result size exceeds the size of the "
+                   "type to initialize {} (read {}, total size {})",
+                   typeid(Result).name(),
+                   s.currentIndex(),
+                   s.span().size_bytes());
+          return outcome::failure(std::errc::illegal_byte_sequence);
         }
+        return outcome::success(std::move(t));
+      } catch (std::system_error &e) {
+        return outcome::failure(e.code());
       }
     }
 
-   private:
+    // returns cached results of pure calls without making an environment
+    template <typename Result>
+    outcome::result<Result> callAtWithCache(
+        RuntimeEnvironmentFactory::RuntimeEnvironmentTemplate &env_template,
+        std::string_view name,
+        const Buffer &encoded_args) {
+      if constexpr (not std::is_void_v<Result>) {
+        if (cache_ != nullptr and isPureCall(name)) {
+          auto call = [&]() -> outcome::result<Buffer> {
+            OUTCOME_TRY(env, env_template.make());
+            return callRaw(*env, name, encoded_args);
+          };
+          OUTCOME_TRY(result,
+                      cache_->getCallResult(env_template.storageState(),
+                                            name,
+                                            encoded_args,
+                                            call));
+          return decodeResult<Result>(result);
+        }
+      }
+      OUTCOME_TRY(env, env_template.make());
+      return callWithCache<Result>(*env, name, encoded_args);
+    }
+
     // returns cached results for some common runtime calls
-    template <typename Result, typename... Args>
+    template <typename Result>
     inline outcome::result<Result> callWithCache(RuntimeEnvironment &env,
                                                  std::string_view name,
-                                                 Args &&...args) {
+                                                 const Buffer &encoded_args) {
       if constexpr (std::is_same_v<Result, primitives::Version>) {
         if (likely(name == "Core_version")) {
           return cache_->getVersion(env.module_instance->getCodeHash(), [&] {
-            return call<Result>(env, name, std::forward<Args>(args)...);
+            return callEncoded<Result>(env, name, encoded_args);
           });
         }
       }
@@ -205,12 +274,12 @@ namespace kagome::runtime {
       if constexpr (std::is_same_v<Result, primitives::OpaqueMetadata>) {
         if (likely(name == "Metadata_metadata")) {
           return cache_->getMetadata(env.module_instance->getCodeHash(), [&] {
-            return call<Result>(env, name, std::forward<Args>(args)...);
+            return callEncoded<Result>(env, name, encoded_args);
           });
         }
       }
 
-      return call<Result>(env, name, std::forward<Args>(args)...);
+      return callEncoded<Result>(env, name, encoded_args);
     }
 
     std::shared_ptr<RuntimeEnvironmentFactory> env_factory_;
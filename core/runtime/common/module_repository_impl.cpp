@@ -5,6 +5,7 @@
 
 #include "runtime/common/module_repository_impl.hpp"
 
+#include "crypto/hasher.hpp"
 #include "log/profiling_logger.hpp"
 #include "runtime/common/runtime_instances_pool.hpp"
 #include "runtime/instance_environment.hpp"
@@ -22,16 +23,19 @@ namespace kagome::runtime {
       std::shared_ptr<RuntimeInstancesPool> runtime_instances_pool,
       std::shared_ptr<RuntimeUpgradeTracker> runtime_upgrade_tracker,
       std::shared_ptr<const ModuleFactory> module_factory,
-      std::shared_ptr<SingleModuleCache> last_compiled_module)
+      std::shared_ptr<SingleModuleCache> last_compiled_module,
+      std::shared_ptr<crypto::Hasher> hasher)
       : runtime_instances_pool_{std::move(runtime_instances_pool)},
         runtime_upgrade_tracker_{std::move(runtime_upgrade_tracker)},
         module_factory_{std::move(module_factory)},
         last_compiled_module_{std::move(last_compiled_module)},
+        hasher_{std::move(hasher)},
         logger_{log::createLogger("Module Repository", "runtime")} {
     BOOST_ASSERT(runtime_instances_pool_);
     BOOST_ASSERT(runtime_upgrade_tracker_);
     BOOST_ASSERT(module_factory_);
     BOOST_ASSERT(last_compiled_module_);
+    BOOST_ASSERT(hasher_);
   }
 
   outcome::result<std::shared_ptr<ModuleInstance>>
@@ -43,16 +47,21 @@ namespace kagome::runtime {
     OUTCOME_TRY(state, runtime_upgrade_tracker_->getLastCodeUpdateState(block));
     KAGOME_PROFILE_END(code_retrieval)
 
-    KAGOME_PROFILE_START(module_retrieval) {
+    KAGOME_PROFILE_START(module_retrieval)
+    // module is held until instantiated, because the pool may evict it
+    // meanwhile, e.g. when putting a precompiled module
+    std::shared_ptr<Module> module;
+    {
       // Add compiled module if any
-      if (auto module = last_compiled_module_->try_extract();
-          module.has_value()) {
-        runtime_instances_pool_->putModule(state, module.value());
-      }
-
-      // Compile new module if required
-      if (auto opt_module = runtime_instances_pool_->getModule(state);
-          !opt_module.has_value()) {
+      if (auto compiled = last_compiled_module_->try_extract();
+          compiled.has_value()) {
+        module = std::move(compiled.value());
+        runtime_instances_pool_->putModule(state, module);
+      } else if (auto opt_module = runtime_instances_pool_->getModule(state);
+                 opt_module.has_value()) {
+        module = std::move(opt_module.value());
+      } else {
+        // Compile new module if required
         SL_DEBUG(logger_, "Runtime module cache miss for state {}", state);
         auto code = code_provider->getCodeAt(state);
         if (not code.has_value()) {
@@ -61,15 +70,68 @@ namespace kagome::runtime {
         if (not code.has_value()) {
           return code.as_failure();
         }
-        OUTCOME_TRY(new_module, module_factory_->make(code.value()));
-        runtime_instances_pool_->putModule(state, std::move(new_module));
+        OUTCOME_TRY(new_module, getModuleByCode(code.value()));
+        module = std::move(new_module);
+        runtime_instances_pool_->putModule(state, module);
       }
     }
 
     // Try acquire instance (instantiate if needed)
-    OUTCOME_TRY(runtime_instance, runtime_instances_pool_->tryAcquire(state));
+    OUTCOME_TRY(runtime_instance,
+                runtime_instances_pool_->tryAcquire(state, *module));
     KAGOME_PROFILE_END(module_retrieval)
 
     return std::move(runtime_instance);
   }
+
+  outcome::result<std::shared_ptr<Module>>
+  ModuleRepositoryImpl::getModuleByCode(gsl::span<const uint8_t> code) {
+    auto code_hash = hasher_->blake2b_256(code);
+    std::promise<outcome::result<std::shared_ptr<Module>>> compiled;
+    {
+      std::unique_lock lock{modules_by_code_mutex_};
+      if (auto it = modules_by_code_.find(code_hash);
+          it != modules_by_code_.end()) {
+        if (auto module = it->second.lock()) {
+          SL_DEBUG(
+              logger_, "Reuse runtime module with code hash {}", code_hash);
+          return module;
+        }
+        modules_by_code_.erase(it);
+      }
+      if (auto it = compiling_.find(code_hash); it != compiling_.end()) {
+        auto future = it->second;
+        lock.unlock();
+        SL_DEBUG(logger_,
+                 "Wait for compilation of runtime module with code hash {}",
+                 code_hash);
+        return future.get();
+      }
+      compiling_.emplace(code_hash, compiled.get_future().share());
+    }
+
+    auto module = [&]() -> outcome::result<std::shared_ptr<Module>> {
+      OUTCOME_TRY(new_module, module_factory_->make(code));
+      return std::shared_ptr<Module>{std::move(new_module)};
+    }();
+
+    {
+      std::lock_guard lock{modules_by_code_mutex_};
+      compiling_.erase(code_hash);
+      if (module) {
+        // modules evicted from pool are forgotten
+        for (auto it = modules_by_code_.begin();
+             it != modules_by_code_.end();) {
+          if (it->second.expired()) {
+            it = modules_by_code_.erase(it);
+          } else {
+            ++it;
+          }
+        }
+        modules_by_code_[code_hash] = module.value();
+      }
+    }
+    compiled.set_value(module);
+    return module;
+  }
 }  // namespace kagome::runtime
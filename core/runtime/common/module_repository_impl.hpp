@@ -8,13 +8,21 @@
 
 #include "runtime/module_repository.hpp"
 
+#include <future>
+#include <mutex>
 #include <thread>
 #include <unordered_map>
 
+#include "common/blob.hpp"
 #include "log/logger.hpp"
 #include "runtime/instance_environment.hpp"
 
+namespace kagome::crypto {
+  class Hasher;
+}
+
 namespace kagome::runtime {
+  class Module;
   class RuntimeUpgradeTracker;
   class ModuleFactory;
   class SingleModuleCache;
@@ -26,18 +34,39 @@ namespace kagome::runtime {
         std::shared_ptr<RuntimeInstancesPool> runtime_instances_pool,
         std::shared_ptr<RuntimeUpgradeTracker> runtime_upgrade_tracker,
         std::shared_ptr<const ModuleFactory> module_factory,
-        std::shared_ptr<SingleModuleCache> last_compiled_module);
+        std::shared_ptr<SingleModuleCache> last_compiled_module,
+        std::shared_ptr<crypto::Hasher> hasher);
 
     outcome::result<std::shared_ptr<ModuleInstance>> getInstanceAt(
         std::shared_ptr<const RuntimeCodeProvider> code_provider,
         const primitives::BlockInfo &block,
         const primitives::BlockHeader &header) override;
 
+    /**
+     * Returns module of \param code if it is still loaded for some other
+     * state, compiles it otherwise. Concurrent calls for the same code wait
+     * for the compilation already in progress.
+     */
+    outcome::result<std::shared_ptr<Module>> getModuleByCode(
+        gsl::span<const uint8_t> code);
+
    private:
     std::shared_ptr<RuntimeInstancesPool> runtime_instances_pool_;
     std::shared_ptr<RuntimeUpgradeTracker> runtime_upgrade_tracker_;
     std::shared_ptr<const ModuleFactory> module_factory_;
     std::shared_ptr<SingleModuleCache> last_compiled_module_;
+    std::shared_ptr<crypto::Hasher> hasher_;
+    // same code is often found in different states, e.g. blocks of forks
+    // or before the first known upgrade
+    std::mutex modules_by_code_mutex_;
+    std::unordered_map<common::Hash256, std::weak_ptr<Module>>
+        modules_by_code_;
+    // e.g. code of an upgrade is compiled by the precompiler while the next
+    // block is executed
+    std::unordered_map<
+        common::Hash256,
+        std::shared_future<outcome::result<std::shared_ptr<Module>>>>
+        compiling_;
     log::Logger logger_;
   };
 
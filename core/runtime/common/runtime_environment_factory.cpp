@@ -117,9 +117,13 @@ namespace kagome::runtime {
 
     memory.resize(heap_base);
 
-    instance.forDataSegment([&](auto offset, auto segment) {
-      memory.storeBuffer(offset, segment);
-    });
+    // restored snapshot already contains data segments
+    if (not memory_provider->hasMemorySnapshot()) {
+      instance.forDataSegment([&](auto offset, auto segment) {
+        memory.storeBuffer(offset, segment);
+      });
+      const_cast<MemoryProvider &>(*memory_provider).snapshotMemory(heap_base);
+    }
 
     return outcome::success();
   }
@@ -65,8 +65,8 @@ namespace kagome::runtime {
   };
 
   outcome::result<std::shared_ptr<ModuleInstance>>
-  RuntimeInstancesPool::tryAcquire(
-      const RuntimeInstancesPool::RootHash &state) {
+  RuntimeInstancesPool::tryAcquire(const RuntimeInstancesPool::RootHash &state,
+                                   const Module &module) {
     std::scoped_lock guard{mt_};
     auto &pool = pools_[state];
 
@@ -77,10 +77,7 @@ namespace kagome::runtime {
           weak_from_this(), state, std::move(top));
     }
 
-    auto opt_module = modules_.get(state);
-    BOOST_ASSERT(opt_module.has_value());
-    auto module = opt_module.value();
-    OUTCOME_TRY(instance, module.get()->instantiate());
+    OUTCOME_TRY(instance, module.instantiate());
 
     return std::make_shared<BorrowedInstance>(
         weak_from_this(), state, std::move(instance));
@@ -55,6 +55,13 @@ namespace kagome::runtime {
                         ValueArg,
                         Value> || std::is_constructible_v<ValueArg, Value>);
       ticks_++;
+      for (auto &entry : cache_) {
+        if (entry.key == key) {
+          entry.value = std::forward<ValueArg>(value);
+          entry.latest_use_tick_ = ticks_;
+          return;
+        }
+      }
       if (cache_.size() >= kMaxSize) {
         auto min = std::min_element(cache_.begin(), cache_.end());
         cache_.erase(min);
@@ -99,11 +106,14 @@ namespace kagome::runtime {
      *
      * @param state - the merkle trie root of the state containing the code of
      * the runtime module we are acquiring an instance of.
+     * @param module - the module of that state, instantiated if there is no
+     * free instance. It is passed by the caller, because the module may be
+     * evicted from the cache concurrently.
      * @return pointer to the acquired ModuleInstance if success. Error
      * otherwise.
      */
     outcome::result<std::shared_ptr<ModuleInstance>> tryAcquire(
-        const RootHash &state);
+        const RootHash &state, const Module &module);
     /**
      * @brief Releases the module instance (returns it to the pool)
      *
@@ -132,7 +142,10 @@ namespace kagome::runtime {
 
    private:
     std::mutex mt_;
-    static constexpr size_t MODULES_CACHE_SIZE = 2;
+    // modules of the best state, of another state in use (e.g. a fork or an
+    // older block queried by RPC) and of an upgrade put by the precompiler,
+    // so the latter doesn't evict the module of the best state
+    static constexpr size_t MODULES_CACHE_SIZE = 3;
     ModuleCache modules_{MODULES_CACHE_SIZE};
     std::map<RootHash, ModuleInstancePool> pools_;
   };
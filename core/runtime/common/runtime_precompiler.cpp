@@ -0,0 +1,136 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/common/runtime_precompiler.hpp"
+
+#include <chrono>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "application/app_state_manager.hpp"
+#include "blockchain/block_header_repository.hpp"
+#include "runtime/common/module_repository_impl.hpp"
+#include "runtime/common/runtime_instances_pool.hpp"
+#include "runtime/common/uncompress_code_if_needed.hpp"
+#include "runtime/module.hpp"
+#include "storage/predefined_keys.hpp"
+#include "storage/trie/trie_storage.hpp"
+
+namespace kagome::runtime {
+
+  RuntimePrecompiler::RuntimePrecompiler(
+      std::shared_ptr<application::AppStateManager> app_state_manager,
+      primitives::events::ChainSubscriptionEnginePtr chain_events_engine,
+      std::shared_ptr<blockchain::BlockHeaderRepository> header_repo,
+      std::shared_ptr<const storage::trie::TrieStorage> trie_storage,
+      std::shared_ptr<ModuleRepositoryImpl> module_repo,
+      std::shared_ptr<RuntimeInstancesPool> runtime_instances_pool)
+      : compiler_{std::make_shared<const Compiler>(
+          Compiler{std::move(header_repo),
+                   std::move(trie_storage),
+                   std::move(module_repo),
+                   std::move(runtime_instances_pool),
+                   log::createLogger("RuntimePrecompiler", "runtime")})},
+        chain_events_engine_{std::move(chain_events_engine)},
+        compile_thread_{std::make_shared<ThreadPool>(1ull)} {
+    BOOST_ASSERT(compiler_->header_repo != nullptr);
+    BOOST_ASSERT(compiler_->trie_storage != nullptr);
+    BOOST_ASSERT(compiler_->module_repo != nullptr);
+    BOOST_ASSERT(compiler_->runtime_instances_pool != nullptr);
+    BOOST_ASSERT(chain_events_engine_ != nullptr);
+
+    BOOST_ASSERT(app_state_manager != nullptr);
+    app_state_manager->takeControl(*this);
+  }
+
+  bool RuntimePrecompiler::prepare() {
+#ifdef __linux__
+    // nice value is per thread on linux
+    compile_thread_->io_context()->post([log = compiler_->logger] {
+      auto tid = static_cast<id_t>(syscall(SYS_gettid));
+      if (setpriority(PRIO_PROCESS, tid, 19) != 0) {
+        SL_DEBUG(log, "Can't lower priority of compilation thread");
+      }
+    });
+#endif
+
+    chain_sub_ = std::make_shared<primitives::events::ChainEventSubscriber>(
+        chain_events_engine_);
+    chain_sub_->subscribe(chain_sub_->generateSubscriptionSetId(),
+                          primitives::events::ChainEventType::kNewRuntime);
+    chain_sub_->setCallback(
+        [compiler = compiler_, io_context = compile_thread_->io_context()](
+            subscription::SubscriptionSetId,
+            auto &&,
+            primitives::events::ChainEventType type,
+            const primitives::events::ChainEventParams &event) {
+          if (type != primitives::events::ChainEventType::kNewRuntime) {
+            return;
+          }
+          auto hash =
+              boost::get<primitives::events::NewRuntimeEventParams>(event)
+                  .get();
+          io_context->post([compiler, hash] {
+            if (auto res = compiler->precompile(hash); not res) {
+              SL_WARN(compiler->logger,
+                      "Failed to precompile runtime of block {}: {}",
+                      hash,
+                      res.error());
+            }
+          });
+        });
+    return true;
+  }
+
+  void RuntimePrecompiler::stop() {
+    chain_sub_->unsubscribe();
+    // pending compilations are dropped, the current one is finished
+    compile_thread_->io_context()->stop();
+  }
+
+  outcome::result<void> RuntimePrecompiler::Compiler::precompile(
+      const primitives::BlockHash &hash) const {
+    OUTCOME_TRY(header, header_repo->getBlockHeader(hash));
+    // blocks on top of this one take code from its state, see
+    // RuntimeUpgradeTracker::getLastCodeUpdateState
+    const auto &state = header.state_root;
+    if (runtime_instances_pool->getModule(state)) {
+      return outcome::success();
+    }
+
+    // code is read by itself, because span returned by RuntimeCodeProvider
+    // may be invalidated by concurrent call
+    OUTCOME_TRY(batch, trie_storage->getEphemeralBatchAt(state));
+    OUTCOME_TRY(code, batch->get(storage::kRuntimeCodeKey));
+    common::Buffer uncompressed;
+    OUTCOME_TRY(uncompressCodeIfNeeded(code, uncompressed));
+
+    SL_INFO(logger,
+            "Precompiling runtime of block #{} {}",
+            header.number,
+            hash);
+    auto start = std::chrono::steady_clock::now();
+    // same code may be loaded for another state already
+    OUTCOME_TRY(module, module_repo->getModuleByCode(uncompressed));
+    if (module == nullptr) {
+      // error is already reported by module factory
+      return outcome::success();
+    }
+    runtime_instances_pool->putModule(state, std::move(module));
+    SL_INFO(logger,
+            "Runtime of block #{} {} precompiled in {} ms",
+            header.number,
+            hash,
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start)
+                .count());
+    return outcome::success();
+  }
+
+}  // namespace kagome::runtime
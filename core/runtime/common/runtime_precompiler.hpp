@@ -0,0 +1,78 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_RUNTIME_COMMON_RUNTIME_PRECOMPILER_HPP
+#define KAGOME_CORE_RUNTIME_COMMON_RUNTIME_PRECOMPILER_HPP
+
+#include <memory>
+
+#include "log/logger.hpp"
+#include "outcome/outcome.hpp"
+#include "primitives/event_types.hpp"
+#include "utils/thread_pool.hpp"
+
+namespace kagome::application {
+  class AppStateManager;
+}
+
+namespace kagome::blockchain {
+  class BlockHeaderRepository;
+}
+
+namespace kagome::storage::trie {
+  class TrieStorage;
+}
+
+namespace kagome::runtime {
+  class ModuleRepositoryImpl;
+  class RuntimeInstancesPool;
+
+  /**
+   * Compiles runtime code as soon as a block changing :code is imported, so
+   * the module is ready in RuntimeInstancesPool when the first block on top
+   * of the upgrade is executed. Compilation is done on a dedicated thread
+   * with lowered priority, not to delay import of blocks meanwhile.
+   * Tasks of that thread don't own the precompiler, so it is never destroyed
+   * (and the thread is never joined) from the thread itself.
+   */
+  class RuntimePrecompiler final {
+   public:
+    RuntimePrecompiler(
+        std::shared_ptr<application::AppStateManager> app_state_manager,
+        primitives::events::ChainSubscriptionEnginePtr chain_events_engine,
+        std::shared_ptr<blockchain::BlockHeaderRepository> header_repo,
+        std::shared_ptr<const storage::trie::TrieStorage> trie_storage,
+        std::shared_ptr<ModuleRepositoryImpl> module_repo,
+        std::shared_ptr<RuntimeInstancesPool> runtime_instances_pool);
+
+    bool prepare();
+
+    void stop();
+
+   private:
+    /// Dependencies of compilation, shared with tasks of compile thread
+    struct Compiler {
+      /**
+       * Compiles code from the state of block \param hash and puts the
+       * module into the pool, unless it is there already
+       */
+      outcome::result<void> precompile(const primitives::BlockHash &hash) const;
+
+      std::shared_ptr<blockchain::BlockHeaderRepository> header_repo;
+      std::shared_ptr<const storage::trie::TrieStorage> trie_storage;
+      std::shared_ptr<ModuleRepositoryImpl> module_repo;
+      std::shared_ptr<RuntimeInstancesPool> runtime_instances_pool;
+      log::Logger logger;
+    };
+
+    std::shared_ptr<const Compiler> compiler_;
+    primitives::events::ChainSubscriptionEnginePtr chain_events_engine_;
+    std::shared_ptr<primitives::events::ChainEventSubscriber> chain_sub_;
+    std::shared_ptr<ThreadPool> compile_thread_;
+  };
+
+}  // namespace kagome::runtime
+
+#endif  // KAGOME_CORE_RUNTIME_COMMON_RUNTIME_PRECOMPILER_HPP
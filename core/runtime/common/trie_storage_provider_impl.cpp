@@ -42,7 +42,10 @@ namespace kagome::runtime {
     SL_DEBUG(logger_,
              "Setting storage provider to ephemeral batch with root {}",
              state_root);
-    OUTCOME_TRY(batch, trie_storage_->getEphemeralBatchAt(state_root));
+    // snapshot keeps the state of offchain workers and other read-only calls
+    // consistent while blocks are imported
+    OUTCOME_TRY(snapshot, trie_storage_->getSnapshotAt(state_root));
+    OUTCOME_TRY(batch, snapshot->batch());
     setTo(std::move(batch));
     return outcome::success();
   }
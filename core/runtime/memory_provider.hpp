@@ -22,6 +22,21 @@ namespace kagome::runtime {
     getCurrentMemory() const = 0;
     [[nodiscard]] virtual outcome::result<void> resetMemory(
         WasmSize heap_base) = 0;
+
+    /**
+     * @return true if resetMemory() restores memory to the snapshot, so
+     * data segments don't have to be written again
+     */
+    virtual bool hasMemorySnapshot() const {
+      return false;
+    }
+
+    /**
+     * Saves first \param size bytes of current memory as pristine image,
+     * which following resetMemory() calls restore, while the rest of memory
+     * is zeroed. Does nothing if snapshots are not supported.
+     */
+    virtual void snapshotMemory(WasmSize size) {}
   };
 
 }  // namespace kagome::runtime
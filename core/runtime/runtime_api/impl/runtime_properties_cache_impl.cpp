@@ -5,8 +5,31 @@
 
 #include "runtime_properties_cache_impl.hpp"
 
+#include "crypto/blake2/blake2b.h"
+
+namespace {
+  constexpr auto kCallCacheHitsMetricName = "kagome_runtime_call_cache_hits";
+  constexpr auto kCallCacheMissesMetricName =
+      "kagome_runtime_call_cache_misses";
+  constexpr auto kCallCacheBytesMetricName = "kagome_runtime_call_cache_bytes";
+}  // namespace
+
 namespace kagome::runtime {
 
+  RuntimePropertiesCacheImpl::RuntimePropertiesCacheImpl() {
+    metrics_registry_->registerCounterFamily(
+        kCallCacheHitsMetricName,
+        "Number of runtime calls answered from cache");
+    metrics_registry_->registerCounterFamily(
+        kCallCacheMissesMetricName,
+        "Number of cacheable runtime calls executed by runtime");
+    metrics_registry_->registerGaugeFamily(
+        kCallCacheBytesMetricName, "Total size of cached runtime call results");
+    metric_call_results_bytes_ =
+        metrics_registry_->registerGaugeMetric(kCallCacheBytesMetricName);
+    metric_call_results_bytes_->set(0);
+  }
+
   outcome::result<primitives::Version> RuntimePropertiesCacheImpl::getVersion(
       const common::Hash256 &hash,
       std::function<outcome::result<primitives::Version>()> obtainer) {
@@ -30,4 +53,72 @@ namespace kagome::runtime {
     return it->second;
   }
 
+  outcome::result<common::Buffer> RuntimePropertiesCacheImpl::getCallResult(
+      const common::Hash256 &state_root,
+      std::string_view method,
+      common::BufferView args,
+      std::function<outcome::result<common::Buffer>()> obtainer) {
+    // length of method is hashed, so method and arguments can't be mixed up
+    const uint64_t method_size = method.size();
+    CallKey key;
+    crypto::blake2b_ctx ctx;
+    crypto::blake2b_init(&ctx, key.size(), nullptr, 0);
+    crypto::blake2b_update(&ctx, state_root.data(), state_root.size());
+    crypto::blake2b_update(&ctx, &method_size, sizeof(method_size));
+    crypto::blake2b_update(&ctx, method.data(), method.size());
+    crypto::blake2b_update(&ctx, args.data(), args.size());
+    crypto::blake2b_final(&ctx, key.data());
+
+    {
+      std::lock_guard lock{calls_mutex_};
+      if (auto it = call_result_index_.find(key);
+          it != call_result_index_.end()) {
+        call_results_.splice(call_results_.end(), call_results_, it->second);
+        methodMetrics(method).hits->inc();
+        return it->second->second;
+      }
+      methodMetrics(method).misses->inc();
+    }
+
+    // runtime is called without lock, so concurrent misses of the same call
+    // are executed twice, but don't block other calls
+    OUTCOME_TRY(result, obtainer());
+    if (result.size() > kMaxCallResultsBytes) {
+      return result;
+    }
+
+    std::lock_guard lock{calls_mutex_};
+    if (call_result_index_.count(key) != 0) {
+      return result;
+    }
+    while (call_results_bytes_ + result.size() > kMaxCallResultsBytes) {
+      auto &[oldest_key, oldest_result] = call_results_.front();
+      call_results_bytes_ -= oldest_result.size();
+      call_result_index_.erase(oldest_key);
+      call_results_.pop_front();
+    }
+    call_results_bytes_ += result.size();
+    call_result_index_.emplace(
+        key, call_results_.emplace(call_results_.end(), key, result));
+    metric_call_results_bytes_->set(call_results_bytes_);
+    return result;
+  }
+
+  RuntimePropertiesCacheImpl::MethodMetrics &
+  RuntimePropertiesCacheImpl::methodMetrics(std::string_view method) {
+    auto it = method_metrics_.find(method);
+    if (it == method_metrics_.end()) {
+      const std::map<std::string, std::string> labels{
+          {"method", std::string{method}}};
+      MethodMetrics method_metrics{
+          metrics_registry_->registerCounterMetric(kCallCacheHitsMetricName,
+                                                   labels),
+          metrics_registry_->registerCounterMetric(kCallCacheMissesMetricName,
+                                                   labels),
+      };
+      it = method_metrics_.emplace(method, method_metrics).first;
+    }
+    return it->second;
+  }
+
 }  // namespace kagome::runtime
@@ -8,11 +8,22 @@
 
 #include "runtime/runtime_properties_cache.hpp"
 
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "metrics/metrics.hpp"
+
 namespace kagome::runtime {
 
   class RuntimePropertiesCacheImpl final : public RuntimePropertiesCache {
    public:
-    RuntimePropertiesCacheImpl() = default;
+    /// Max total size of cached results of runtime calls
+    static constexpr size_t kMaxCallResultsBytes = 32 << 20;
+
+    RuntimePropertiesCacheImpl();
 
     outcome::result<primitives::Version> getVersion(
         const common::Hash256 &hash,
@@ -24,9 +35,36 @@ namespace kagome::runtime {
         std::function<outcome::result<primitives::OpaqueMetadata>()> obtainer)
         override;
 
+    outcome::result<common::Buffer> getCallResult(
+        const common::Hash256 &state_root,
+        std::string_view method,
+        common::BufferView args,
+        std::function<outcome::result<common::Buffer>()> obtainer) override;
+
    private:
+    struct MethodMetrics {
+      metrics::Counter *hits;
+      metrics::Counter *misses;
+    };
+
+    /// hash of state root, method and arguments
+    using CallKey = common::Hash256;
+    using CallResults = std::list<std::pair<CallKey, common::Buffer>>;
+
+    MethodMetrics &methodMetrics(std::string_view method);
+
     std::map<common::Hash256, primitives::Version> cached_versions_;
     std::map<common::Hash256, primitives::OpaqueMetadata> cached_metadata_;
+
+    std::mutex calls_mutex_;
+    /// least recently used results first
+    CallResults call_results_;
+    std::unordered_map<CallKey, CallResults::iterator> call_result_index_;
+    size_t call_results_bytes_ = 0;
+
+    metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
+    std::map<std::string, MethodMetrics, std::less<>> method_metrics_;
+    metrics::Gauge *metric_call_results_bytes_;
   };
 
 }  // namespace kagome::runtime
@@ -122,6 +122,10 @@ namespace kagome::runtime {
     [[nodiscard]] virtual outcome::result<std::unique_ptr<RuntimeEnvironment>>
     make();
 
+    const storage::trie::RootHash &storageState() const {
+      return storage_state_;
+    }
+
    private:
     primitives::BlockInfo blockchain_state_;
 
@@ -10,7 +10,11 @@
 #ifndef KAGOME_RUNTIME_RUNTIMEPROPERTIESCACHE
 #define KAGOME_RUNTIME_RUNTIMEPROPERTIESCACHE
 
+#include <functional>
+#include <string_view>
+
 #include "common/blob.hpp"
+#include "common/buffer.hpp"
 #include "outcome/outcome.hpp"
 #include "primitives/metadata.hpp"
 #include "primitives/version.hpp"
@@ -34,6 +38,21 @@ namespace kagome::runtime {
         const common::Hash256 &hash,
         std::function<outcome::result<primitives::OpaqueMetadata>()>
             obtainer) = 0;
+
+    /**
+     * Cache for results of runtime calls, which depend only on storage state
+     * and arguments, so don't have to be invalidated
+     * @param state_root storage state of the call
+     * @param method name of runtime method
+     * @param args SCALE-encoded arguments
+     * @param obtainer makes the call, result is cached only on success
+     * @return SCALE-encoded result of the call
+     */
+    virtual outcome::result<common::Buffer> getCallResult(
+        const common::Hash256 &state_root,
+        std::string_view method,
+        common::BufferView args,
+        std::function<outcome::result<common::Buffer>()> obtainer) = 0;
   };
 
 }  // namespace kagome::runtime
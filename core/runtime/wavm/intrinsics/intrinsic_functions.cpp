@@ -5,6 +5,7 @@
 
 #include "runtime/wavm/intrinsics/intrinsic_functions.hpp"
 
+#include "host_api/host_api_profiler.hpp"
 #include "runtime/module_repository.hpp"
 #include "runtime/wavm/intrinsics/intrinsic_module.hpp"
 
@@ -698,14 +699,67 @@ namespace kagome::runtime::wavm {
     return peekHostApi()->ext_trie_blake2_256_root_version_1(values_data);
   }
 
+  /**
+   * Intrinsic calling `f` and measuring the call with HostApiProfiler, when
+   * profiling is enabled
+   */
+  template <auto f>
+  struct ProfiledIntrinsic;
+
+  template <typename Ret,
+            typename... Args,
+            Ret (*f)(WAVM::Runtime::ContextRuntimeData *, Args...)>
+  struct ProfiledIntrinsic<f> {
+    static inline host_api::HostApiProfiler::FunctionId function_id = 0;
+    static inline host_api::HostApiProfiler::SpanLayout spans;
+
+    static Ret call(WAVM::Runtime::ContextRuntimeData *contextRuntimeData,
+                    Args... args) {
+      if (not host_api::HostApiProfiler::enabled()) {
+        return f(contextRuntimeData, args...);
+      }
+      host_api::HostApiProfiler::Call call{
+          function_id, argsBytes(std::index_sequence_for<Args...>{}, args...)};
+      if constexpr (std::is_void_v<Ret>) {
+        f(contextRuntimeData, args...);
+      } else {
+        auto result = f(contextRuntimeData, args...);
+        if constexpr (std::is_same_v<Ret, WAVM::I64>) {
+          call.addBytes(spans.resultBytes(static_cast<uint64_t>(result)));
+        }
+        return result;
+      }
+    }
+
+    /// @return number of bytes referenced by WasmSpan arguments
+    template <size_t... I>
+    static uint64_t argsBytes(std::index_sequence<I...>, Args... args) {
+      return (argBytes(I, args) + ... + 0ull);
+    }
+
+    template <typename T>
+    static uint64_t argBytes(size_t index, T value) {
+      if constexpr (std::is_same_v<T, WAVM::I64>) {
+        return spans.argBytes(index, static_cast<uint64_t>(value));
+      } else {
+        return 0;
+      }
+    }
+  };
+
   void registerHostApiMethods(IntrinsicModule &module) {
     if (logger == nullptr) {
       logger = log::createLogger("Host API wrappers", "wavm");
     }
 
-#define REGISTER_HOST_INTRINSIC(Ret, name, ...) \
-  module.addFunction(                           \
-      #name, &name, WAVM::IR::FunctionType{{Ret}, {__VA_ARGS__}});
+#define REGISTER_HOST_INTRINSIC(Ret, name, ...)                  \
+  ProfiledIntrinsic<&name>::function_id =                        \
+      host_api::HostApiProfiler::registerFunction(#name);        \
+  ProfiledIntrinsic<&name>::spans =                              \
+      host_api::HostApiProfiler::spanLayout(#name);              \
+  module.addFunction(#name,                                      \
+                     &ProfiledIntrinsic<&name>::call,            \
+                     WAVM::IR::FunctionType{{Ret}, {__VA_ARGS__}});
 
     auto I32 = WAVM::IR::ValueType::i32;
     auto I64 = WAVM::IR::ValueType::i64;
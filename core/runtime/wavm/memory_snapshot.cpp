@@ -0,0 +1,109 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/wavm/memory_snapshot.hpp"
+
+#include <WAVM/Runtime/Runtime.h>
+
+#include <cstring>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "log/logger.hpp"
+#include "runtime/memory.hpp"
+
+namespace kagome::runtime::wavm {
+
+  namespace {
+    log::Logger &logger() {
+      static auto logger = log::createLogger("MemorySnapshot", "wavm");
+      return logger;
+    }
+  }  // namespace
+
+  MemorySnapshot::MemorySnapshot(WAVM::Runtime::Memory *memory)
+      : memory_{memory} {}
+
+#ifdef __linux__
+
+  std::optional<MemorySnapshot> MemorySnapshot::take(
+      WAVM::Runtime::Memory *memory, size_t size) {
+    // wasm pages are multiple of os pages, so whole wasm pages are mapped
+    size = (size + kMemoryPageSize - 1) / kMemoryPageSize * kMemoryPageSize;
+    if (size == 0
+        or size > WAVM::Runtime::getMemoryNumPages(memory) * kMemoryPageSize) {
+      return std::nullopt;
+    }
+    auto *base = WAVM::Runtime::getMemoryBaseAddress(memory);
+
+    int fd = memfd_create("kagome_wasm_memory", MFD_CLOEXEC);
+    if (fd == -1) {
+      SL_DEBUG(logger(), "memfd_create failed: {}", std::strerror(errno));
+      return std::nullopt;
+    }
+    auto write_image = [&] {
+      if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        return false;
+      }
+      for (size_t offset = 0; offset < size;) {
+        auto n = pwrite(
+            fd, base + offset, size - offset, static_cast<off_t>(offset));
+        if (n <= 0) {
+          return false;
+        }
+        offset += static_cast<size_t>(n);
+      }
+      return true;
+    };
+    if (not write_image()) {
+      SL_WARN(
+          logger(), "Can't write memory snapshot: {}", std::strerror(errno));
+      close(fd);
+      return std::nullopt;
+    }
+    // contents of memory are equal to the image, so memory is replaced with
+    // mapping of the image transparently for wasm code
+    void *mapped = mmap(
+        base, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0);
+    auto error = errno;
+    // mapping keeps the file alive
+    close(fd);
+    if (mapped == MAP_FAILED) {
+      SL_WARN(logger(), "Can't map memory snapshot: {}", std::strerror(error));
+      return std::nullopt;
+    }
+    return MemorySnapshot{memory};
+  }
+
+  bool MemorySnapshot::restore() const {
+    auto *base = WAVM::Runtime::getMemoryBaseAddress(memory_);
+    auto size = WAVM::Runtime::getMemoryNumPages(memory_) * kMemoryPageSize;
+    // private pages of the image are dropped and read from the file again,
+    // pages of the rest of memory are anonymous, so they become zero
+    if (madvise(base, size, MADV_DONTNEED) != 0) {
+      SL_WARN(
+          logger(), "Can't restore memory snapshot: {}", std::strerror(errno));
+      return false;
+    }
+    return true;
+  }
+
+#else
+
+  std::optional<MemorySnapshot> MemorySnapshot::take(
+      WAVM::Runtime::Memory *memory, size_t size) {
+    return std::nullopt;
+  }
+
+  bool MemorySnapshot::restore() const {
+    return false;
+  }
+
+#endif
+
+}  // namespace kagome::runtime::wavm
@@ -0,0 +1,49 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_RUNTIME_WAVM_MEMORY_SNAPSHOT_HPP
+#define KAGOME_CORE_RUNTIME_WAVM_MEMORY_SNAPSHOT_HPP
+
+#include <cstddef>
+#include <optional>
+
+namespace WAVM::Runtime {
+  struct Memory;
+}
+
+namespace kagome::runtime::wavm {
+
+  /**
+   * Pristine image of WAVM memory, e.g. right after data segments are
+   * written. The image is kept in anonymous file, which is mapped
+   * copy-on-write over the beginning of memory, so restoring only drops
+   * pages dirtied since then with madvise(MADV_DONTNEED). Cost of restoring
+   * is proportional to number of touched pages, not to size of memory.
+   * Supported on Linux only.
+   */
+  class MemorySnapshot final {
+   public:
+    /**
+     * Takes snapshot of first \param size bytes of \param memory
+     * @return nullopt if snapshots are not supported or failed
+     */
+    static std::optional<MemorySnapshot> take(WAVM::Runtime::Memory *memory,
+                                              size_t size);
+
+    /**
+     * Restores the image and zeroes the rest of memory
+     * @return false if memory is left untouched because of an error
+     */
+    bool restore() const;
+
+   private:
+    explicit MemorySnapshot(WAVM::Runtime::Memory *memory);
+
+    WAVM::Runtime::Memory *memory_;
+  };
+
+}  // namespace kagome::runtime::wavm
+
+#endif  // KAGOME_CORE_RUNTIME_WAVM_MEMORY_SNAPSHOT_HPP
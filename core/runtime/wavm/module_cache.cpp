@@ -6,16 +6,23 @@
 #include "runtime/wavm/module_cache.hpp"
 
 #include <fstream>
+#include <thread>
 #include <vector>
 
+#include <llvm/Config/llvm-config.h>
+#include <llvm/Support/Host.h>
+
 #include "crypto/hasher.hpp"
-#include "utils/read_file.hpp"
 
 namespace kagome::runtime::wavm {
   ModuleCache::ModuleCache(std::shared_ptr<crypto::Hasher> hasher,
                            fs::path cache_dir)
       : cache_dir_{std::move(cache_dir)},
         hasher_{std::move(hasher)},
+        header_{fmt::format("kagome wavm object v{} llvm {} cpu {}\n",
+                            kFormatVersion,
+                            LLVM_VERSION_STRING,
+                            llvm::sys::getHostCPUName().str())},
         logger_{log::createLogger("WAVM Module Cache", "runtime_cache")} {
     BOOST_ASSERT(hasher_ != nullptr);
   }
@@ -27,33 +34,82 @@ namespace kagome::runtime::wavm {
     auto runtime_hash =
         hasher_->twox_64(gsl::span(wasmBytes, numWASMBytes)).toHex();
     auto filepath = cache_dir_ / runtime_hash;
-    if (!exists(filepath) and !exists(cache_dir_)
-        and !fs::createDirectoryRecursive(cache_dir_)) {
+
+    if (auto object = load(filepath)) {
+      SL_VERBOSE(logger_, "WAVM runtime cache hit: {}", filepath);
+      return std::move(*object);
+    }
+
+    auto module = compileThunk();
+    if (save(filepath, module)) {
+      SL_VERBOSE(logger_, "Saved WAVM runtime to cache: {}", filepath);
+    }
+    return module;
+  }
+
+  std::optional<std::vector<WAVM::U8>> ModuleCache::load(
+      const fs::path &path) const {
+    std::ifstream file{path.c_str(), std::ios::in | std::ios::binary};
+    if (not file.is_open()) {
+      return std::nullopt;
+    }
+    std::string header(header_.size(), '\0');
+    if (not file.read(header.data(), header.size()) or header != header_) {
+      SL_VERBOSE(logger_, "Outdated WAVM runtime in cache: {}", path);
+      return std::nullopt;
+    }
+    std::error_code ec;
+    auto size = fs::file_size(path, ec);
+    if (ec or size < header_.size()) {
+      return std::nullopt;
+    }
+    std::vector<WAVM::U8> object(size - header_.size());
+    if (not file.read(reinterpret_cast<char *>(object.data()), object.size())) {
+      SL_ERROR(logger_, "Error reading module from cache: {}", path);
+      return std::nullopt;
+    }
+    return object;
+  }
+
+  bool ModuleCache::save(const fs::path &path,
+                         const std::vector<WAVM::U8> &object) {
+    if (not fs::createDirectoryRecursive(cache_dir_)) {
       SL_ERROR(
           logger_, "Failed to create runtimes cache directory {}", cache_dir_);
+      return false;
     }
 
-    std ::vector<WAVM::U8> module;
-    if (readFile(module, filepath.string())) {
-      SL_VERBOSE(logger_, "WAVM runtime cache hit: {}", filepath);
-    } else {
-      module = compileThunk();
-      if (auto file =
-              std::ofstream{filepath.c_str(), std::ios::out | std::ios::binary};
-          file.is_open()) {
-        file.write(reinterpret_cast<char *>(module.data()), module.size());
-        file.close();
-        if (not file.fail()) {
-          SL_VERBOSE(logger_, "Saved WAVM runtime to cache: {}", filepath);
-        } else {
-          module.clear();
-          SL_ERROR(logger_, "Error writing module to cache: {}", filepath);
-        }
-      } else {
-        SL_ERROR(logger_, "Failed to cache WAVM runtime: {}", filepath);
+    // written aside and renamed, so concurrent or interrupted writes never
+    // leave a partial file under the final name
+    auto tmp_path = path;
+    tmp_path += fmt::format(
+        ".{}.tmp", std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    {
+      std::ofstream file{tmp_path.c_str(), std::ios::out | std::ios::binary};
+      if (not file.is_open()) {
+        SL_ERROR(logger_, "Failed to cache WAVM runtime: {}", path);
+        return false;
+      }
+      file.write(header_.data(), header_.size());
+      file.write(reinterpret_cast<const char *>(object.data()), object.size());
+      file.close();
+      if (file.fail()) {
+        SL_ERROR(logger_, "Error writing module to cache: {}", path);
+        std::error_code ec;
+        fs::remove(tmp_path, ec);
+        return false;
       }
     }
-
-    return module;
+    std::error_code ec;
+    fs::rename(tmp_path, path, ec);
+    if (ec) {
+      SL_ERROR(logger_,
+               "Error writing module to cache: {}: {}",
+               path,
+               ec.message());
+      fs::remove(tmp_path, ec);
+      return false;
+    }
+    return true;
   }
 }  // namespace kagome::runtime::wavm
@@ -8,6 +8,8 @@
 
 #include "application/app_configuration.hpp"
 
+#include <optional>
+
 #include <WAVM/Runtime/Runtime.h>
 #include "filesystem/directories.hpp"
 #include "log/logger.hpp"
@@ -22,10 +24,15 @@ namespace kagome::runtime::wavm {
   /**
    * WAVM runtime cache. Attempts to fetch precompiled module from fs and saves
    * compiled module upon cache miss.
-   *
+   * Each file starts with a header naming cache format, LLVM version and host
+   * CPU, so objects compiled by another build or for another machine are
+   * compiled again instead of being loaded.
    */
   struct ModuleCache : public WAVM::Runtime::ObjectCacheInterface {
    public:
+    /// Increment when layout of cached objects changes
+    static constexpr uint32_t kFormatVersion = 1;
+
     ModuleCache(std::shared_ptr<crypto::Hasher> hasher, fs::path cache_dir);
 
     std::vector<WAVM::U8> getCachedObject(
@@ -34,8 +41,12 @@ namespace kagome::runtime::wavm {
         std::function<std::vector<WAVM::U8>()> &&compileThunk) override;
 
    private:
+    std::optional<std::vector<WAVM::U8>> load(const fs::path &path) const;
+    bool save(const fs::path &path, const std::vector<WAVM::U8> &object);
+
     fs::path cache_dir_;
     std::shared_ptr<crypto::Hasher> hasher_;
+    std::string header_;
     log::Logger logger_;
   };
 
@@ -27,9 +27,25 @@ namespace kagome::runtime::wavm {
 
   outcome::result<void> WavmExternalMemoryProvider::resetMemory(
       WasmSize heap_base) {
+    if (snapshot_ and not snapshot_->restore()) {
+      snapshot_.reset();
+    }
     current_memory_ = std::make_unique<MemoryImpl>(
         intrinsic_module_->getExportedMemory(), heap_base);
     return outcome::success();
   }
 
+  bool WavmExternalMemoryProvider::hasMemorySnapshot() const {
+    return snapshot_.has_value();
+  }
+
+  void WavmExternalMemoryProvider::snapshotMemory(WasmSize size) {
+    // failed attempt is not repeated
+    if (not snapshot_taken_) {
+      snapshot_taken_ = true;
+      snapshot_ =
+          MemorySnapshot::take(intrinsic_module_->getExportedMemory(), size);
+    }
+  }
+
 }  // namespace kagome::runtime::wavm
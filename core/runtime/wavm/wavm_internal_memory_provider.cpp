@@ -27,8 +27,23 @@ namespace kagome::runtime::wavm {
 
   outcome::result<void> WavmInternalMemoryProvider::resetMemory(
       WasmSize heap_base) {
+    if (snapshot_ and not snapshot_->restore()) {
+      snapshot_.reset();
+    }
     current_memory_ = std::make_unique<MemoryImpl>(memory_, heap_base);
     return outcome::success();
   }
 
+  bool WavmInternalMemoryProvider::hasMemorySnapshot() const {
+    return snapshot_.has_value();
+  }
+
+  void WavmInternalMemoryProvider::snapshotMemory(WasmSize size) {
+    // failed attempt is not repeated
+    if (not snapshot_taken_) {
+      snapshot_taken_ = true;
+      snapshot_ = MemorySnapshot::take(memory_, size);
+    }
+  }
+
 }  // namespace kagome::runtime::wavm
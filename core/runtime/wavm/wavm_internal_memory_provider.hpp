@@ -8,6 +8,8 @@
 
 #include "runtime/memory_provider.hpp"
 
+#include "runtime/wavm/memory_snapshot.hpp"
+
 namespace WAVM::Runtime {
   struct Memory;
 }
@@ -22,10 +24,14 @@ namespace kagome::runtime::wavm {
     std::optional<std::reference_wrapper<runtime::Memory>> getCurrentMemory()
         const override;
     outcome::result<void> resetMemory(WasmSize heap_base) override;
+    bool hasMemorySnapshot() const override;
+    void snapshotMemory(WasmSize size) override;
 
    private:
     WAVM::Runtime::Memory *memory_;
     std::shared_ptr<Memory> current_memory_;
+    std::optional<MemorySnapshot> snapshot_;
+    bool snapshot_taken_ = false;
   };
 
 }  // namespace kagome::runtime::wavm
@@ -29,6 +29,15 @@ namespace kagome::storage::face {
     virtual size_t size() const {
       throw std::logic_error{"GenericStorage::size not implemented"};
     }
+
+    /**
+     * Read-only view of current content, which is not affected by later
+     * writes. Content is kept while the view is referenced.
+     * @return nullptr if snapshots are not supported
+     */
+    virtual std::shared_ptr<GenericStorage> snapshot() {
+      return nullptr;
+    }
   };
 
 }  // namespace kagome::storage::face
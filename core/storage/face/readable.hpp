@@ -6,6 +6,10 @@
 #ifndef KAGOME_READABLE_HPP
 #define KAGOME_READABLE_HPP
 
+#include <optional>
+#include <vector>
+
+#include <gsl/span>
 #include <outcome/outcome.hpp>
 
 #include "storage/face/owned_or_view.hpp"
@@ -47,6 +51,23 @@ namespace kagome::storage::face {
      */
     virtual outcome::result<std::optional<OwnedOrView<V>>> tryGet(
         const View<K> &key) const = 0;
+
+    /**
+     * @brief Get values of several keys at once. Implementations may serve
+     * all the keys with single request to underlying database.
+     * @param keys keys to look up
+     * @return values in order of keys, std::nullopt for absent keys
+     */
+    virtual outcome::result<std::vector<std::optional<OwnedOrView<V>>>>
+    multiGet(gsl::span<const View<K>> keys) const {
+      std::vector<std::optional<OwnedOrView<V>>> values;
+      values.reserve(keys.size());
+      for (auto &key : keys) {
+        OUTCOME_TRY(value, tryGet(key));
+        values.emplace_back(std::move(value));
+      }
+      return values;
+    }
   };
 }  // namespace kagome::storage::face
 
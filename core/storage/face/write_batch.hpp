@@ -27,6 +27,12 @@ namespace kagome::storage::face {
      * @brief Clear batch.
      */
     virtual void clear() = 0;
+
+    /**
+     * @brief Hints expected total size of keys and values, so batch could
+     * allocate memory at once.
+     */
+    virtual void reserve(size_t bytes) {}
   };
 
 }  // namespace kagome::storage::face
@@ -35,6 +35,14 @@ namespace kagome::storage {
           .first->second;
     }
 
+    outcome::result<void> setBulkImport(bool) override {
+      return outcome::success();
+    }
+
+    outcome::result<void> flushBulkImport() override {
+      return outcome::success();
+    }
+
    private:
     std::map<Space, std::shared_ptr<InMemoryStorage>> spaces;
   };
@@ -40,6 +40,12 @@ namespace kagome::storage {
 
   inline const common::Buffer kWarpSyncOp = ":kagome:WarpSync:op"_buf;
 
+  inline const common::Buffer kBabeConfigRepoDigestIndexPrefix =
+      ":kagome:babe_config_repo_digests:"_buf;
+
+  inline const common::Buffer kAuthorityManagerDigestIndexPrefix =
+      ":kagome:auth_mngr_digests:"_buf;
+
   template <typename Tag>
   inline common::Buffer kBabeConfigRepoStateLookupKey(Tag tag) {
     return common::Buffer::fromString(
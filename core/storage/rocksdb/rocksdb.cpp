@@ -4,6 +4,7 @@
  */
 
 #include "storage/rocksdb/rocksdb.hpp"
+#include <rocksdb/convenience.h>
 #include <rocksdb/filter_policy.h>
 #include <rocksdb/table.h>
 
@@ -19,11 +20,89 @@
 namespace kagome::storage {
   namespace fs = filesystem;
 
+  namespace {
+    /// Makes value view keeping pinned memory alive
+    BufferOrView pinnedValue(std::shared_ptr<const void> owner,
+                             const rocksdb::PinnableSlice &value) {
+      return BufferOrView{make_span(value), std::move(owner)};
+    }
+
+    /// Best supported compression, ZSTD is preferred
+    rocksdb::CompressionType strongCompression() {
+      auto supported = rocksdb::GetSupportedCompressions();
+      for (auto type : {rocksdb::kZSTD, rocksdb::kLZ4HCCompression}) {
+        if (std::find(supported.begin(), supported.end(), type)
+            != supported.end()) {
+          return type;
+        }
+      }
+      return rocksdb::kSnappyCompression;
+    }
+
+    void pointLookupProfile(rocksdb::ColumnFamilyOptions &options,
+                            rocksdb::BlockBasedTableOptions &table_options) {
+      // ribbon filter takes ~30% less memory than bloom one of the same
+      // false positive rate, which matters for billions of trie nodes
+      table_options.filter_policy.reset(rocksdb::NewRibbonFilterPolicy(10));
+      table_options.whole_key_filtering = true;
+      // only top level index and filter partitions have to be in memory
+      table_options.index_type =
+          rocksdb::BlockBasedTableOptions::kTwoLevelIndexSearch;
+      table_options.partition_filters = true;
+      table_options.metadata_block_size = 4096;
+      table_options.cache_index_and_filter_blocks_with_high_priority = true;
+      table_options.pin_top_level_index_and_filter = true;
+      table_options.pin_l0_filter_and_index_blocks_in_cache = true;
+      table_options.data_block_index_type =
+          rocksdb::BlockBasedTableOptions::kDataBlockBinaryAndHash;
+      options.memtable_whole_key_filtering = true;
+      options.memtable_prefix_bloom_size_ratio = 0.02;
+    }
+
+    void sequentialProfile(rocksdb::BlockBasedTableOptions &table_options) {
+      table_options.filter_policy.reset(rocksdb::NewBloomFilterPolicy(10));
+      table_options.whole_key_filtering = true;
+      table_options.pin_l0_filter_and_index_blocks_in_cache = true;
+      table_options.block_size = 4 * 1024;
+      // keys are big endian numbers sharing long prefixes
+      table_options.index_block_restart_interval = 16;
+    }
+
+    void largeValuesProfile(rocksdb::ColumnFamilyOptions &options,
+                            rocksdb::BlockBasedTableOptions &table_options) {
+      table_options.filter_policy.reset(rocksdb::NewBloomFilterPolicy(10));
+      table_options.pin_l0_filter_and_index_blocks_in_cache = true;
+      table_options.block_size = 64 * 1024;
+
+      // bodies share a lot of extrinsic structure, so dictionary trained on
+      // samples of a file improves compression ratio considerably
+      const auto compression = strongCompression();
+      options.compression = compression;
+      options.compression_per_level.clear();
+      options.bottommost_compression = compression;
+      options.bottommost_compression_opts.max_dict_bytes = 16 * 1024;
+      options.bottommost_compression_opts.zstd_max_train_bytes =
+          100 * options.bottommost_compression_opts.max_dict_bytes;
+      options.bottommost_compression_opts.enabled = true;
+
+      // values are kept out of LSM tree, so compactions do not rewrite them
+      options.enable_blob_files = true;
+      options.min_blob_size = 4 * 1024;
+      options.blob_compression_type = compression;
+      options.enable_blob_garbage_collection = true;
+    }
+  }  // namespace
+
   RocksDb::RocksDb() : logger_(log::createLogger("RocksDB", "storage")) {
     ro_.fill_cache = false;
   }
 
   RocksDb::~RocksDb() {
+    if (bulk_import_) {
+      if (auto res = flush(); res.has_error()) {
+        SL_ERROR(logger_, "Can't flush bulk import: {}", res.error());
+      }
+    }
     for (auto *handle : column_family_handles_) {
       db_->DestroyColumnFamilyHandle(handle);
     }
@@ -34,7 +113,8 @@ namespace kagome::storage {
       const filesystem::path &path,
       rocksdb::Options options,
       uint32_t memory_budget_mib,
-      bool prevent_destruction) {
+      bool prevent_destruction,
+      const RocksDbProfiles &profiles) {
     if (!filesystem::createDirectoryRecursive(path)) {
       return DatabaseError::DB_PATH_NOT_CREATED;
     }
@@ -65,7 +145,8 @@ namespace kagome::storage {
       column_family_descriptors.emplace_back(rocksdb::ColumnFamilyDescriptor{
           spaceName(static_cast<Space>(i)),
           configureColumn(i != Space::kTrieNode ? other_spaces_cache_size
-                                                : trie_space_cache_size)});
+                                                : trie_space_cache_size,
+                          profiles[i])});
     }
 
     std::vector<std::string> existing_families;
@@ -86,11 +167,16 @@ namespace kagome::storage {
                        })
           == column_family_descriptors.end()) {
         column_family_descriptors.emplace_back(rocksdb::ColumnFamilyDescriptor{
-            family, configureColumn(other_spaces_cache_size)});
+            family,
+            configureColumn(other_spaces_cache_size,
+                            RocksDbProfile::kLegacy)});
       }
     }
 
     options.create_missing_column_families = true;
+    // Writes of bulk import skip WAL, so flushes must persist the same point
+    // of write history in every column family to keep database consistent
+    options.atomic_flush = true;
     auto rocks_db = std::shared_ptr<RocksDb>(new RocksDb);
     auto status = rocksdb::DB::Open(options,
                                     path.native(),
@@ -123,12 +209,53 @@ namespace kagome::storage {
     if (column_family_handles_.end() == column) {
       throw DatabaseError::INVALID_ARGUMENT;
     }
-    auto space_ptr =
-        std::make_shared<RocksDbSpace>(weak_from_this(), *column, logger_);
+    auto space_ptr = std::make_shared<RocksDbSpace>(
+        weak_from_this(), *column, spaceReadOptions(space), logger_);
     spaces_[space] = space_ptr;
     return space_ptr;
   }
 
+  outcome::result<void> RocksDb::setBulkImport(bool enabled) {
+    if (enabled) {
+      if (not bulk_import_.exchange(true)) {
+        SL_INFO(logger_, "Bulk import is enabled");
+      }
+      return outcome::success();
+    }
+    std::unique_lock lock{bulk_import_mutex_};
+    if (not bulk_import_) {
+      return outcome::success();
+    }
+    // unlogged writes must be durable before any further write is logged
+    OUTCOME_TRY(flush());
+    bulk_import_ = false;
+    SL_INFO(logger_, "Bulk import is disabled");
+    return outcome::success();
+  }
+
+  outcome::result<void> RocksDb::flushBulkImport() {
+    if (not bulk_import_) {
+      return outcome::success();
+    }
+    return flush();
+  }
+
+  rocksdb::WriteOptions RocksDb::writeOptions() const {
+    auto options = wo_;
+    options.disableWAL = bulk_import_.load(std::memory_order_relaxed);
+    return options;
+  }
+
+  outcome::result<void> RocksDb::flush() {
+    rocksdb::FlushOptions options;
+    options.wait = true;
+    auto status = db_->Flush(options, column_family_handles_);
+    if (not status.ok()) {
+      return status_as_error(status);
+    }
+    return outcome::success();
+  }
+
   void RocksDb::dropColumn(kagome::storage::Space space) {
     auto space_name = spaceName(space);
     auto column_it =
@@ -152,6 +279,13 @@ namespace kagome::storage {
     e(db_->CreateColumnFamily({}, space_name, &handle));
   }
 
+  rocksdb::ReadOptions RocksDb::spaceReadOptions(Space space) const {
+    auto read_options = ro_;
+    read_options.fill_cache =
+        space == Space::kTrieNode or space == Space::kHeader;
+    return read_options;
+  }
+
   rocksdb::BlockBasedTableOptions RocksDb::tableOptionsConfiguration(
       uint32_t lru_cache_size_mib, uint32_t block_size_kib) {
     rocksdb::BlockBasedTableOptions table_options;
@@ -165,19 +299,34 @@ namespace kagome::storage {
   }
 
   rocksdb::ColumnFamilyOptions RocksDb::configureColumn(
-      uint32_t memory_budget) {
+      uint32_t memory_budget, RocksDbProfile profile) {
     rocksdb::ColumnFamilyOptions options;
     options.OptimizeLevelStyleCompaction(memory_budget);
     auto table_options = tableOptionsConfiguration();
+    switch (profile) {
+      case RocksDbProfile::kLegacy:
+        break;
+      case RocksDbProfile::kPointLookup:
+        pointLookupProfile(options, table_options);
+        break;
+      case RocksDbProfile::kSequential:
+        sequentialProfile(table_options);
+        break;
+      case RocksDbProfile::kLargeValues:
+        largeValuesProfile(options, table_options);
+        break;
+    }
     options.table_factory.reset(NewBlockBasedTableFactory(table_options));
     return options;
   }
 
   RocksDbSpace::RocksDbSpace(std::weak_ptr<RocksDb> storage,
                              const RocksDb::ColumnFamilyHandlePtr &column,
+                             rocksdb::ReadOptions read_options,
                              log::Logger logger)
       : storage_{std::move(storage)},
         column_{column},
+        ro_{std::move(read_options)},
         logger_{std::move(logger)} {}
 
   std::unique_ptr<BufferBatch> RocksDbSpace::batch() {
@@ -213,14 +362,14 @@ namespace kagome::storage {
       throw DatabaseError::STORAGE_GONE;
     }
     auto it = std::unique_ptr<rocksdb::Iterator>(
-        rocks->db_->NewIterator(rocks->ro_, column_));
+        rocks->db_->NewIterator(iteratorOptions(*rocks), column_));
     return std::make_unique<RocksDBCursor>(std::move(it));
   }
 
   outcome::result<bool> RocksDbSpace::contains(const BufferView &key) const {
     OUTCOME_TRY(rocks, use());
-    std::string value;
-    auto status = rocks->db_->Get(rocks->ro_, column_, make_slice(key), &value);
+    rocksdb::PinnableSlice value;
+    auto status = rocks->db_->Get(ro_, column_, make_slice(key), &value);
     if (status.ok()) {
       return true;
     }
@@ -238,20 +387,17 @@ namespace kagome::storage {
       return true;
     }
     auto it = std::unique_ptr<rocksdb::Iterator>(
-        rocks->db_->NewIterator(rocks->ro_, column_));
+        rocks->db_->NewIterator(iteratorOptions(*rocks), column_));
     it->SeekToFirst();
     return it->Valid();
   }
 
   outcome::result<BufferOrView> RocksDbSpace::get(const BufferView &key) const {
     OUTCOME_TRY(rocks, use());
-    std::string value;
-    auto status = rocks->db_->Get(rocks->ro_, column_, make_slice(key), &value);
+    auto value = std::make_shared<rocksdb::PinnableSlice>();
+    auto status = rocks->db_->Get(ro_, column_, make_slice(key), value.get());
     if (status.ok()) {
-      // cannot move string content to a buffer
-      return Buffer(
-          reinterpret_cast<uint8_t *>(value.data()),                  // NOLINT
-          reinterpret_cast<uint8_t *>(value.data()) + value.size());  // NOLINT
+      return pinnedValue(value, *value);
     }
     return status_as_error(status);
   }
@@ -259,12 +405,10 @@ namespace kagome::storage {
   outcome::result<std::optional<BufferOrView>> RocksDbSpace::tryGet(
       const BufferView &key) const {
     OUTCOME_TRY(rocks, use());
-    std::string value;
-    auto status = rocks->db_->Get(rocks->ro_, column_, make_slice(key), &value);
+    auto value = std::make_shared<rocksdb::PinnableSlice>();
+    auto status = rocks->db_->Get(ro_, column_, make_slice(key), value.get());
     if (status.ok()) {
-      return std::make_optional(Buffer(
-          reinterpret_cast<uint8_t *>(value.data()),                   // NOLINT
-          reinterpret_cast<uint8_t *>(value.data()) + value.size()));  // NOLINT
+      return std::make_optional(pinnedValue(value, *value));
     }
 
     if (status.IsNotFound()) {
@@ -274,11 +418,48 @@ namespace kagome::storage {
     return status_as_error(status);
   }
 
+  outcome::result<std::vector<std::optional<BufferOrView>>>
+  RocksDbSpace::multiGet(gsl::span<const BufferView> keys) const {
+    OUTCOME_TRY(rocks, use());
+    std::vector<rocksdb::Slice> slices;
+    slices.reserve(keys.size());
+    for (auto &key : keys) {
+      slices.emplace_back(make_slice(key));
+    }
+    // all the values are owned by the results together
+    auto values =
+        std::make_shared<std::vector<rocksdb::PinnableSlice>>(keys.size());
+    std::vector<rocksdb::Status> statuses(keys.size());
+    rocks->db_->MultiGet(ro_,
+                         column_,
+                         slices.size(),
+                         slices.data(),
+                         values->data(),
+                         statuses.data());
+
+    std::vector<std::optional<BufferOrView>> result;
+    result.reserve(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+      if (statuses[i].ok()) {
+        result.emplace_back(pinnedValue(values, (*values)[i]));
+      } else if (statuses[i].IsNotFound()) {
+        result.emplace_back(std::nullopt);
+      } else {
+        return status_as_error(statuses[i]);
+      }
+    }
+    return result;
+  }
+
   outcome::result<void> RocksDbSpace::put(const BufferView &key,
                                           BufferOrView &&value) {
+    if (snapshot_ != nullptr) {
+      return DatabaseError::NOT_SUPPORTED;
+    }
     OUTCOME_TRY(rocks, use());
+    std::shared_lock lock{rocks->bulk_import_mutex_};
     auto status = rocks->db_->Put(
-        rocks->wo_, column_, make_slice(key), make_slice(value));
+        rocks->writeOptions(), column_, make_slice(key), make_slice(value));
     if (status.ok()) {
       return outcome::success();
     }
@@ -287,8 +468,13 @@ namespace kagome::storage {
   }
 
   outcome::result<void> RocksDbSpace::remove(const BufferView &key) {
+    if (snapshot_ != nullptr) {
+      return DatabaseError::NOT_SUPPORTED;
+    }
     OUTCOME_TRY(rocks, use());
-    auto status = rocks->db_->Delete(rocks->wo_, column_, make_slice(key));
+    std::shared_lock lock{rocks->bulk_import_mutex_};
+    auto status =
+        rocks->db_->Delete(rocks->writeOptions(), column_, make_slice(key));
     if (status.ok()) {
       return outcome::success();
     }
@@ -315,6 +501,34 @@ namespace kagome::storage {
     }
   }
 
+  std::shared_ptr<BufferStorage> RocksDbSpace::snapshot() {
+    auto rocks = storage_.lock();
+    if (!rocks or !rocks->db_) {
+      return nullptr;
+    }
+    std::weak_ptr<RocksDb> weak = rocks;
+    std::shared_ptr<const rocksdb::Snapshot> pinned{
+        rocks->db_->GetSnapshot(), [weak](const rocksdb::Snapshot *snapshot) {
+          // snapshot is released by db together with it otherwise
+          if (auto rocks = weak.lock()) {
+            rocks->db_->ReleaseSnapshot(snapshot);
+          }
+        }};
+    auto read_options = ro_;
+    read_options.snapshot = pinned.get();
+    auto space = std::make_shared<RocksDbSpace>(
+        storage_, column_, std::move(read_options), logger_);
+    space->snapshot_ = std::move(pinned);
+    return space;
+  }
+
+  rocksdb::ReadOptions RocksDbSpace::iteratorOptions(
+      const RocksDb &rocks) const {
+    auto read_options = rocks.ro_;
+    read_options.snapshot = ro_.snapshot;
+    return read_options;
+  }
+
   outcome::result<std::shared_ptr<RocksDb>> RocksDbSpace::use() const {
     auto rocks = storage_.lock();
     if (!rocks) {
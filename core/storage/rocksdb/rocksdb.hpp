@@ -8,12 +8,17 @@
 
 #include "storage/buffer_map_types.hpp"
 
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+
 #include <rocksdb/db.h>
 #include <rocksdb/table.h>
 #include <boost/container/flat_map.hpp>
 
 #include "filesystem/common.hpp"
 #include "log/logger.hpp"
+#include "storage/rocksdb/rocksdb_profile.hpp"
 #include "storage/spaced_storage.hpp"
 
 namespace kagome::storage {
@@ -42,16 +47,22 @@ namespace kagome::storage {
      * @param prevent_destruction - avoid destruction of underlying db if true
      * @param memory_budget_mib - state cache size in MiB, 90% would be set for
      * trie nodes, and the rest - distributed evenly among left spaces
+     * @param profiles - column family tuning of each space
      * @return instance of RocksDB
      */
     static outcome::result<std::shared_ptr<RocksDb>> create(
         const filesystem::path &path,
         rocksdb::Options options = rocksdb::Options(),
         uint32_t memory_budget_mib = kDefaultStateCacheSizeMiB,
-        bool prevent_destruction = false);
+        bool prevent_destruction = false,
+        const RocksDbProfiles &profiles = legacyRocksDbProfiles());
 
     std::shared_ptr<BufferStorage> getSpace(Space space) override;
 
+    outcome::result<void> setBulkImport(bool enabled) override;
+
+    outcome::result<void> flushBulkImport() override;
+
     /**
      * Implementation specific way to erase the whole space data.
      * Not exposed at SpacedStorage level as only used in pruner.
@@ -75,13 +86,33 @@ namespace kagome::storage {
    private:
     RocksDb();
 
-    static rocksdb::ColumnFamilyOptions configureColumn(uint32_t memory_budget);
+    static rocksdb::ColumnFamilyOptions configureColumn(
+        uint32_t memory_budget, RocksDbProfile profile);
+
+    /**
+     * Point reads of hot spaces (trie nodes and headers) fill block cache,
+     * other reads and iterations do not to avoid cache pollution.
+     */
+    rocksdb::ReadOptions spaceReadOptions(Space space) const;
+
+    /**
+     * Write options, which skip WAL in bulk import mode. Writes hold
+     * `bulk_import_mutex_` shared while using them.
+     */
+    rocksdb::WriteOptions writeOptions() const;
+
+    /// Flushes memtables of all column families atomically
+    outcome::result<void> flush();
 
     rocksdb::DB *db_{};
     std::vector<ColumnFamilyHandlePtr> column_family_handles_;
     boost::container::flat_map<Space, std::shared_ptr<BufferStorage>> spaces_;
     rocksdb::ReadOptions ro_;
     rocksdb::WriteOptions wo_;
+    std::atomic_bool bulk_import_ = false;
+    // held exclusively while bulk import is disabled, so no write is logged
+    // before unlogged ones are flushed
+    std::shared_mutex bulk_import_mutex_;
     log::Logger logger_;
   };
 
@@ -91,6 +122,7 @@ namespace kagome::storage {
 
     RocksDbSpace(std::weak_ptr<RocksDb> storage,
                  const RocksDb::ColumnFamilyHandlePtr &column,
+                 rocksdb::ReadOptions read_options,
                  log::Logger logger);
 
     std::unique_ptr<BufferBatch> batch() override;
@@ -108,6 +140,13 @@ namespace kagome::storage {
     outcome::result<std::optional<BufferOrView>> tryGet(
         const BufferView &key) const override;
 
+    /**
+     * Serves all the keys with single MultiGet call, values are pinned
+     * without copying
+     */
+    outcome::result<std::vector<std::optional<BufferOrView>>> multiGet(
+        gsl::span<const BufferView> keys) const override;
+
     outcome::result<void> put(const BufferView &key,
                               BufferOrView &&value) override;
 
@@ -115,14 +154,28 @@ namespace kagome::storage {
 
     void compact(const Buffer &first, const Buffer &last);
 
+    /**
+     * Pins current state of the space with RocksDB snapshot.
+     * Snapshot shares block cache with the space, writes to it fail with
+     * NOT_SUPPORTED.
+     */
+    std::shared_ptr<BufferStorage> snapshot() override;
+
     friend class RocksDbBatch;
 
    private:
     // gather storage instance from weak ptr
     outcome::result<std::shared_ptr<RocksDb>> use() const;
 
+    // read options of iterators, pinned to snapshot if any
+    rocksdb::ReadOptions iteratorOptions(const RocksDb &rocks) const;
+
     std::weak_ptr<RocksDb> storage_;
     const RocksDb::ColumnFamilyHandlePtr &column_;
+    /// options of point reads, iterators use RocksDb::ro_
+    rocksdb::ReadOptions ro_;
+    /// set for read-only snapshot of the space, released with the last view
+    std::shared_ptr<const rocksdb::Snapshot> snapshot_;
     log::Logger logger_;
   };
 }  // namespace kagome::storage
@@ -24,11 +24,15 @@ namespace kagome::storage {
   }
 
   outcome::result<void> RocksDbBatch::commit() {
+    if (db_.snapshot_ != nullptr) {
+      return DatabaseError::NOT_SUPPORTED;
+    }
     auto rocks = db_.storage_.lock();
     if (!rocks) {
       return DatabaseError::STORAGE_GONE;
     }
-    auto status = rocks->db_->Write(rocks->wo_, &batch_);
+    std::shared_lock lock{rocks->bulk_import_mutex_};
+    auto status = rocks->db_->Write(rocks->writeOptions(), &batch_);
     if (status.ok()) {
       return outcome::success();
     }
@@ -39,4 +43,11 @@ namespace kagome::storage {
   void RocksDbBatch::clear() {
     batch_.Clear();
   }
+
+  void RocksDbBatch::reserve(size_t bytes) {
+    // write batch can be only constructed with reserved memory
+    if (batch_.Count() == 0) {
+      batch_ = rocksdb::WriteBatch{bytes};
+    }
+  }
 }  // namespace kagome::storage
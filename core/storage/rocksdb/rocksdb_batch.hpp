@@ -21,6 +21,8 @@ namespace kagome::storage {
 
     void clear() override;
 
+    void reserve(size_t bytes) override;
+
     outcome::result<void> put(const BufferView &key,
                               BufferOrView &&value) override;
 
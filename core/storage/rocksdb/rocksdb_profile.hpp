@@ -0,0 +1,74 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_ROCKSDB_PROFILE_HPP
+#define KAGOME_ROCKSDB_PROFILE_HPP
+
+#include "storage/spaces.hpp"
+
+#include <array>
+#include <optional>
+#include <string_view>
+
+namespace kagome::storage {
+
+  /**
+   * RocksDB column family tuning suited for particular access pattern
+   */
+  enum class RocksDbProfile : uint8_t {
+    /// the same options for every space, as before profiles were introduced
+    kLegacy,
+    /// random hash keys of immutable values, read one by one (trie nodes,
+    /// headers): whole-key ribbon filters, partitioned index and filters,
+    /// pinned L0 filter blocks and hash index of data blocks
+    kPointLookup,
+    /// keys growing monotonically (block numbers), read in order: bloom
+    /// filters and small blocks
+    kSequential,
+    /// large rarely read values (block bodies, justifications): ZSTD with
+    /// dictionary compression and blob files
+    kLargeValues,
+  };
+
+  /// profile of each space, indexed by Space
+  using RocksDbProfiles = std::array<RocksDbProfile, Space::kTotal>;
+
+  inline RocksDbProfiles legacyRocksDbProfiles() {
+    RocksDbProfiles profiles;
+    profiles.fill(RocksDbProfile::kLegacy);
+    return profiles;
+  }
+
+  /// profiles matching access patterns of spaces
+  inline RocksDbProfiles tunedRocksDbProfiles() {
+    auto profiles = legacyRocksDbProfiles();
+    profiles[Space::kLookupKey] = RocksDbProfile::kSequential;
+    profiles[Space::kHeader] = RocksDbProfile::kPointLookup;
+    profiles[Space::kBlockBody] = RocksDbProfile::kLargeValues;
+    profiles[Space::kJustification] = RocksDbProfile::kLargeValues;
+    profiles[Space::kTrieNode] = RocksDbProfile::kPointLookup;
+    return profiles;
+  }
+
+  inline std::optional<RocksDbProfile> rocksDbProfileFromString(
+      std::string_view str) {
+    if (str == "legacy") {
+      return RocksDbProfile::kLegacy;
+    }
+    if (str == "point-lookup") {
+      return RocksDbProfile::kPointLookup;
+    }
+    if (str == "sequential") {
+      return RocksDbProfile::kSequential;
+    }
+    if (str == "large-values") {
+      return RocksDbProfile::kLargeValues;
+    }
+    return std::nullopt;
+  }
+
+}  // namespace kagome::storage
+
+#endif  // KAGOME_ROCKSDB_PROFILE_HPP
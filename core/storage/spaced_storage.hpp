@@ -25,6 +25,19 @@ namespace kagome::storage {
      * @return a pointer buffer storage for a space
      */
     virtual std::shared_ptr<BufferStorage> getSpace(Space space) = 0;
+
+    /**
+     * Bulk import mode speeds up catching up with the chain. Writes are not
+     * logged and become durable only by `flushBulkImport` or disabling the
+     * mode, so crash loses writes made since the last flush.
+     * Storage is left consistent, as every flush persists all the writes made
+     * before it.
+     * @param enabled - enable or disable the mode, disabling flushes writes
+     */
+    virtual outcome::result<void> setBulkImport(bool enabled) = 0;
+
+    /// Persists writes made in bulk import mode
+    virtual outcome::result<void> flushBulkImport() = 0;
   };
 
 }  // namespace kagome::storage
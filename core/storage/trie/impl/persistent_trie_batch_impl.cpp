@@ -7,6 +7,8 @@
 
 #include <memory>
 
+#include <scale/encode_append.hpp>
+
 #include "storage/trie/impl/topper_trie_batch_impl.hpp"
 #include "storage/trie/polkadot_trie/polkadot_trie_cursor_impl.hpp"
 #include "storage/trie/polkadot_trie/trie_error.hpp"
@@ -36,8 +38,44 @@ namespace kagome::storage::trie {
                  or not changes_.has_value());
   }
 
+  outcome::result<BufferOrView> PersistentTrieBatchImpl::get(
+      const BufferView &key) const {
+    if (auto it = appended_.find(key); it != appended_.end()) {
+      return BufferView{it->second};
+    }
+    return TrieBatchBase::get(key);
+  }
+
+  outcome::result<std::optional<BufferOrView>> PersistentTrieBatchImpl::tryGet(
+      const BufferView &key) const {
+    if (auto it = appended_.find(key); it != appended_.end()) {
+      return BufferView{it->second};
+    }
+    return TrieBatchBase::tryGet(key);
+  }
+
+  std::unique_ptr<PolkadotTrieCursor> PersistentTrieBatchImpl::trieCursor() {
+    if (auto res = flushAppended(); res.has_error()) {
+      SL_ERROR(logger_, "Failed to write appended values: {}", res.error());
+    }
+    return TrieBatchBase::trieCursor();
+  }
+
+  outcome::result<bool> PersistentTrieBatchImpl::contains(
+      const BufferView &key) const {
+    if (appended_.find(key) != appended_.end()) {
+      return true;
+    }
+    return TrieBatchBase::contains(key);
+  }
+
+  bool PersistentTrieBatchImpl::empty() const {
+    return appended_.empty() and TrieBatchBase::empty();
+  }
+
   outcome::result<RootHash> PersistentTrieBatchImpl::commit(
       StateVersion version) {
+    OUTCOME_TRY(flushAppended());
     OUTCOME_TRY(commitChildren(version));
     OUTCOME_TRY(root, serializer_->storeTrie(*trie_, version));
     SL_TRACE_FUNC_CALL(logger_, root);
@@ -48,6 +86,7 @@ namespace kagome::storage::trie {
   PersistentTrieBatchImpl::clearPrefix(const BufferView &prefix,
                                        std::optional<uint64_t> limit) {
     SL_TRACE_VOID_FUNC_CALL(logger_, prefix);
+    OUTCOME_TRY(flushAppended());
     return trie_->clearPrefix(
         prefix, limit, [&](const auto &key, auto &&) -> outcome::result<void> {
           if (changes_.has_value()) {
@@ -59,6 +98,14 @@ namespace kagome::storage::trie {
 
   outcome::result<void> PersistentTrieBatchImpl::put(const BufferView &key,
                                                      BufferOrView &&value) {
+    if (auto it = appended_.find(key); it != appended_.end()) {
+      appended_.erase(it);
+    }
+    return putToTrie(key, std::move(value));
+  }
+
+  outcome::result<void> PersistentTrieBatchImpl::putToTrie(
+      const BufferView &key, BufferOrView &&value) {
     OUTCOME_TRY(contains, trie_->contains(key));
     bool is_new_entry = not contains;
     auto value_copy = value.mut();
@@ -72,6 +119,9 @@ namespace kagome::storage::trie {
   }
 
   outcome::result<void> PersistentTrieBatchImpl::remove(const BufferView &key) {
+    if (auto it = appended_.find(key); it != appended_.end()) {
+      appended_.erase(it);
+    }
     OUTCOME_TRY(trie_->remove(key));
     if (changes_.has_value()) {
       SL_TRACE_VOID_FUNC_CALL(logger_, key);
@@ -80,6 +130,30 @@ namespace kagome::storage::trie {
     return outcome::success();
   }
 
+  outcome::result<void> PersistentTrieBatchImpl::append(
+      const BufferView &key, const BufferView &item) {
+    if (auto it = appended_.find(key); it != appended_.end()) {
+      // amortized by growth of the buffer, unless length prefix grows
+      std::ignore = scale::append_or_new_vec(it->second.asVector(), item);
+      return outcome::success();
+    }
+    OUTCOME_TRY(value_opt, trie_->tryGet(key));
+    auto value = value_opt ? value_opt->into() : Buffer{};
+    if (scale::append_or_new_vec(value.asVector(), item).has_error()) {
+      return outcome::success();
+    }
+    appended_.emplace(key, std::move(value));
+    return outcome::success();
+  }
+
+  outcome::result<void> PersistentTrieBatchImpl::flushAppended() {
+    while (not appended_.empty()) {
+      auto node = appended_.extract(appended_.begin());
+      OUTCOME_TRY(putToTrie(node.key(), std::move(node.mapped())));
+    }
+    return outcome::success();
+  }
+
   outcome::result<std::unique_ptr<TrieBatch>>
   PersistentTrieBatchImpl::createFromTrieHash(const RootHash &trie_hash) {
     OUTCOME_TRY(trie, serializer_->retrieveTrie(trie_hash, nullptr));
@@ -6,6 +6,7 @@
 #ifndef KAGOME_STORAGE_TRIE_IMPL_PERSISTENT_TRIE_BATCH
 #define KAGOME_STORAGE_TRIE_IMPL_PERSISTENT_TRIE_BATCH
 
+#include <map>
 #include <memory>
 
 #include "storage/trie/impl/trie_batch_base.hpp"
@@ -32,6 +33,13 @@ namespace kagome::storage::trie {
 
     ~PersistentTrieBatchImpl() override = default;
 
+    outcome::result<BufferOrView> get(const BufferView &key) const override;
+    outcome::result<std::optional<BufferOrView>> tryGet(
+        const BufferView &key) const override;
+    std::unique_ptr<PolkadotTrieCursor> trieCursor() override;
+    outcome::result<bool> contains(const BufferView &key) const override;
+    bool empty() const override;
+
     outcome::result<RootHash> commit(StateVersion version) override;
 
     outcome::result<std::tuple<bool, uint32_t>> clearPrefix(
@@ -41,12 +49,26 @@ namespace kagome::storage::trie {
                               BufferOrView &&value) override;
     outcome::result<void> remove(const BufferView &key) override;
 
+    /**
+     * Appended value is kept apart from the trie and extended in place, it
+     * is written to the trie before iteration, clearing prefixes or commit
+     */
+    outcome::result<void> append(const BufferView &key,
+                                 const BufferView &item) override;
+
    protected:
     virtual outcome::result<std::unique_ptr<TrieBatch>> createFromTrieHash(
         const RootHash &trie_hash) override;
 
    private:
+    outcome::result<void> putToTrie(const BufferView &key,
+                                    BufferOrView &&value);
+
+    // writes appended values to the trie
+    outcome::result<void> flushAppended();
+
     TrieChangesTrackerOpt changes_;
+    std::map<Buffer, Buffer, std::less<>> appended_;
   };
 
 }  // namespace kagome::storage::trie
@@ -6,6 +6,7 @@
 #include "storage/trie/impl/topper_trie_batch_impl.hpp"
 
 #include <boost/algorithm/string/predicate.hpp>
+#include <scale/encode_append.hpp>
 
 #include "common/buffer.hpp"
 #include "storage/trie/polkadot_trie/polkadot_trie_cursor.hpp"
@@ -50,6 +51,7 @@ namespace kagome::storage::trie {
 
   outcome::result<std::optional<BufferOrView>> TopperTrieBatchImpl::tryGet(
       const BufferView &key) const {
+    OUTCOME_TRY(applyAppended(key));
     if (auto it = cache_.find(key); it != cache_.end()) {
       if (it->second.has_value()) {
         return BufferView{it->second.value()};
@@ -66,6 +68,9 @@ namespace kagome::storage::trie {
   }
 
   std::unique_ptr<PolkadotTrieCursor> TopperTrieBatchImpl::trieCursor() {
+    if (applyAppended().has_error()) {
+      return nullptr;
+    }
     if (auto p = parent_.lock(); p != nullptr) {
       return std::make_unique<TopperTrieCursor>(shared_from_this(),
                                                 p->trieCursor());
@@ -75,6 +80,7 @@ namespace kagome::storage::trie {
 
   outcome::result<bool> TopperTrieBatchImpl::contains(
       const BufferView &key) const {
+    OUTCOME_TRY(applyAppended(key));
     if (auto it = cache_.find(key); it != cache_.end()) {
       return it->second.has_value();
     }
@@ -88,6 +94,10 @@ namespace kagome::storage::trie {
   }
 
   bool TopperTrieBatchImpl::empty() const {
+    // appended value is never absent
+    if (not appended_.empty()) {
+      return false;
+    }
     if (not cache_.empty()
         and std::any_of(cache_.begin(), cache_.end(), [](auto &p) {
               return p.second.has_value();
@@ -104,11 +114,17 @@ namespace kagome::storage::trie {
 
   outcome::result<void> TopperTrieBatchImpl::put(const BufferView &key,
                                                  BufferOrView &&value) {
+    if (auto it = appended_.find(key); it != appended_.end()) {
+      appended_.erase(it);
+    }
     cache_.insert_or_assign(Buffer{key}, value.into());
     return outcome::success();
   }
 
   outcome::result<void> TopperTrieBatchImpl::remove(const BufferView &key) {
+    if (auto it = appended_.find(key); it != appended_.end()) {
+      appended_.erase(it);
+    }
     cache_.insert_or_assign(Buffer{key}, std::nullopt);
 
     return outcome::success();
@@ -121,6 +137,10 @@ namespace kagome::storage::trie {
          ++it) {
       it->second = std::nullopt;
     }
+    for (auto it = appended_.lower_bound(prefix);
+         it != appended_.end() && boost::starts_with(it->first, prefix);) {
+      it = appended_.erase(it);
+    }
 
     cleared_prefixes_.emplace_back(prefix);
     if (parent_.lock() != nullptr) {
@@ -136,11 +156,19 @@ namespace kagome::storage::trie {
       }
       for (auto it = cache_.begin(); it != cache_.end(); it++) {
         if (it->second.has_value()) {
-          OUTCOME_TRY(p->put(it->first, BufferView{it->second.value()}));
+          OUTCOME_TRY(p->put(it->first, std::move(it->second.value())));
         } else {
           OUTCOME_TRY(p->remove(it->first));
         }
       }
+      for (auto &[key, items] : appended_) {
+        for (auto &item : items) {
+          OUTCOME_TRY(p->append(key, item));
+        }
+      }
+      cleared_prefixes_.clear();
+      cache_.clear();
+      appended_.clear();
       return outcome::success();
     }
     return Error::PARENT_EXPIRED;
@@ -155,6 +183,56 @@ namespace kagome::storage::trie {
     return Error::CHILD_BATCH_NOT_SUPPORTED;
   }
 
+  outcome::result<void> TopperTrieBatchImpl::append(const BufferView &key,
+                                                    const BufferView &item) {
+    if (auto it = cache_.find(key); it != cache_.end()) {
+      if (not it->second.has_value()) {
+        it->second.emplace();
+      }
+      std::ignore = scale::append_or_new_vec(it->second->asVector(), item);
+      return outcome::success();
+    }
+    if (wasClearedByPrefix(key)) {
+      Buffer value;
+      std::ignore = scale::append_or_new_vec(value.asVector(), item);
+      cache_.emplace(key, std::move(value));
+      return outcome::success();
+    }
+    appended_[Buffer{key}].emplace_back(item);
+    return outcome::success();
+  }
+
+  outcome::result<void> TopperTrieBatchImpl::applyAppended(
+      const BufferView &key) const {
+    auto it = appended_.find(key);
+    if (it == appended_.end()) {
+      return outcome::success();
+    }
+    auto p = parent_.lock();
+    if (p == nullptr) {
+      return Error::PARENT_EXPIRED;
+    }
+    OUTCOME_TRY(value_opt, p->tryGet(key));
+    auto value = value_opt ? value_opt->into() : Buffer{};
+    bool changed = false;
+    for (auto &item : it->second) {
+      changed |= scale::append_or_new_vec(value.asVector(), item).has_value();
+    }
+    // value which is not a vector stays in the parent
+    if (changed) {
+      cache_.insert_or_assign(it->first, std::move(value));
+    }
+    appended_.erase(it);
+    return outcome::success();
+  }
+
+  outcome::result<void> TopperTrieBatchImpl::applyAppended() const {
+    while (not appended_.empty()) {
+      OUTCOME_TRY(applyAppended(appended_.begin()->first));
+    }
+    return outcome::success();
+  }
+
   bool TopperTrieBatchImpl::wasClearedByPrefix(const BufferView &key) const {
     for (const auto &prefix : cleared_prefixes_) {
       if (boost::starts_with(key, prefix)) {
@@ -42,6 +42,13 @@ namespace kagome::storage::trie {
     outcome::result<std::tuple<bool, uint32_t>> clearPrefix(
         const BufferView &prefix, std::optional<uint64_t> limit) override;
 
+    /**
+     * Items appended to value of the parent are collected in a list, the
+     * value is read and concatenated only when it is read from this batch
+     */
+    outcome::result<void> append(const BufferView &key,
+                                 const BufferView &item) override;
+
     outcome::result<void> writeBack() override;
 
     virtual outcome::result<RootHash> commit(StateVersion version) override;
@@ -52,7 +59,13 @@ namespace kagome::storage::trie {
    private:
     bool wasClearedByPrefix(const BufferView &key) const;
 
-    std::map<Buffer, std::optional<Buffer>, std::less<>> cache_;
+    // concatenates items appended to the value of the parent
+    outcome::result<void> applyAppended(const BufferView &key) const;
+    outcome::result<void> applyAppended() const;
+
+    mutable std::map<Buffer, std::optional<Buffer>, std::less<>> cache_;
+    /// items appended to values of the parent, which were not read yet
+    mutable std::map<Buffer, std::vector<Buffer>, std::less<>> appended_;
     std::deque<Buffer> cleared_prefixes_;
     std::weak_ptr<TrieBatch> parent_;
 
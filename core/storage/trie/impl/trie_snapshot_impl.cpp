@@ -0,0 +1,37 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/impl/trie_snapshot_impl.hpp"
+
+#include "storage/trie/impl/ephemeral_trie_batch_impl.hpp"
+
+namespace kagome::storage::trie {
+
+  TrieSnapshotImpl::TrieSnapshotImpl(RootHash root,
+                                     std::shared_ptr<Codec> codec,
+                                     std::shared_ptr<TrieSerializer> serializer)
+      : root_{root},
+        codec_{std::move(codec)},
+        serializer_{std::move(serializer)} {
+    BOOST_ASSERT(codec_ != nullptr);
+    BOOST_ASSERT(serializer_ != nullptr);
+  }
+
+  const RootHash &TrieSnapshotImpl::root() const {
+    return root_;
+  }
+
+  outcome::result<std::unique_ptr<TrieBatch>> TrieSnapshotImpl::batch() const {
+    return batchAt(root_);
+  }
+
+  outcome::result<std::unique_ptr<TrieBatch>> TrieSnapshotImpl::batchAt(
+      const RootHash &root) const {
+    OUTCOME_TRY(trie, serializer_->retrieveTrie(Buffer{root}, nullptr));
+    return std::make_unique<EphemeralTrieBatchImpl>(
+        codec_, std::move(trie), serializer_, nullptr);
+  }
+
+}  // namespace kagome::storage::trie
@@ -0,0 +1,41 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_STORAGE_TRIE_IMPL_TRIE_SNAPSHOT_IMPL
+#define KAGOME_STORAGE_TRIE_IMPL_TRIE_SNAPSHOT_IMPL
+
+#include "storage/trie/trie_snapshot.hpp"
+
+#include "storage/trie/codec.hpp"
+#include "storage/trie/serialization/trie_serializer.hpp"
+
+namespace kagome::storage::trie {
+
+  class TrieSnapshotImpl final : public TrieSnapshot {
+   public:
+    /**
+     * @param serializer - serializer reading nodes from snapshot of the
+     * storage
+     */
+    TrieSnapshotImpl(RootHash root,
+                     std::shared_ptr<Codec> codec,
+                     std::shared_ptr<TrieSerializer> serializer);
+
+    const RootHash &root() const override;
+
+    outcome::result<std::unique_ptr<TrieBatch>> batch() const override;
+
+    outcome::result<std::unique_ptr<TrieBatch>> batchAt(
+        const RootHash &root) const override;
+
+   private:
+    RootHash root_;
+    std::shared_ptr<Codec> codec_;
+    std::shared_ptr<TrieSerializer> serializer_;
+  };
+
+}  // namespace kagome::storage::trie
+
+#endif  // KAGOME_STORAGE_TRIE_IMPL_TRIE_SNAPSHOT_IMPL
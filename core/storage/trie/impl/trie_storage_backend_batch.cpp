@@ -7,27 +7,106 @@
 
 namespace kagome::storage::trie {
 
+  namespace {
+    /// Only nodes stored by hash are filtered, other keys are written as is
+    std::optional<common::Hash256> nodeHash(const common::BufferView &key) {
+      if (key.size() != common::Hash256::size()) {
+        return std::nullopt;
+      }
+      return common::Hash256::fromSpan(key).value();
+    }
+  }  // namespace
+
+  WrittenNodesFilter::WrittenNodesFilter(size_t capacity)
+      : capacity_{capacity} {}
+
+  bool WrittenNodesFilter::contains(const common::BufferView &key) const {
+    auto hash = nodeHash(key);
+    if (not hash) {
+      return false;
+    }
+    std::lock_guard lock{mutex_};
+    return keys_.count(*hash) != 0;
+  }
+
+  void WrittenNodesFilter::add(const common::BufferView &key) {
+    auto hash = nodeHash(key);
+    if (not hash or capacity_ == 0) {
+      return;
+    }
+    std::lock_guard lock{mutex_};
+    if (keys_.count(*hash) != 0) {
+      return;
+    }
+    keys_.emplace(*hash, order_.emplace(order_.end(), *hash));
+    while (keys_.size() > capacity_) {
+      keys_.erase(order_.front());
+      order_.pop_front();
+    }
+  }
+
+  void WrittenNodesFilter::remove(const common::BufferView &key) {
+    auto hash = nodeHash(key);
+    if (not hash) {
+      return;
+    }
+    std::lock_guard lock{mutex_};
+    if (auto it = keys_.find(*hash); it != keys_.end()) {
+      order_.erase(it->second);
+      keys_.erase(it);
+    }
+  }
+
   TrieStorageBackendBatch::TrieStorageBackendBatch(
-      std::unique_ptr<BufferBatch> storage_batch)
-      : storage_batch_{std::move(storage_batch)} {
+      std::unique_ptr<BufferBatch> storage_batch,
+      std::shared_ptr<WrittenNodesFilter> written_nodes)
+      : storage_batch_{std::move(storage_batch)},
+        written_nodes_{std::move(written_nodes)} {
     BOOST_ASSERT(storage_batch_ != nullptr);
+    BOOST_ASSERT(written_nodes_ != nullptr);
   }
 
   outcome::result<void> TrieStorageBackendBatch::commit() {
-    return storage_batch_->commit();
+    // removed nodes are forgotten before they are actually removed, so
+    // concurrent batches do not skip them
+    for (auto &key : removed_keys_) {
+      written_nodes_->remove(key);
+    }
+    OUTCOME_TRY(storage_batch_->commit());
+    for (auto &key : put_keys_) {
+      written_nodes_->add(key);
+    }
+    return outcome::success();
   }
 
   void TrieStorageBackendBatch::clear() {
     storage_batch_->clear();
+    put_keys_.clear();
+    removed_keys_.clear();
+  }
+
+  void TrieStorageBackendBatch::reserve(size_t bytes) {
+    storage_batch_->reserve(bytes);
   }
 
   outcome::result<void> TrieStorageBackendBatch::put(
       const common::BufferView &key, BufferOrView &&value) {
+    if (auto hash = nodeHash(key)) {
+      const bool written = removed_keys_.count(*hash) == 0
+                       and written_nodes_->contains(key);
+      if (written or not put_keys_.emplace(*hash).second) {
+        return outcome::success();
+      }
+    }
     return storage_batch_->put(key, std::move(value));
   }
 
   outcome::result<void> TrieStorageBackendBatch::remove(
       const common::BufferView &key) {
+    if (auto hash = nodeHash(key)) {
+      put_keys_.erase(*hash);
+      removed_keys_.emplace(*hash);
+    }
     return storage_batch_->remove(key);
   }
 
@@ -8,15 +8,49 @@
 
 #include "storage/buffer_map_types.hpp"
 
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "common/blob.hpp"
+
 namespace kagome::storage::trie {
 
+  /**
+   * Keys of recently written trie nodes.
+   * Nodes are addressed by hash of their content, so writing a node again is
+   * redundant until it is removed. Oldest keys are forgotten when capacity
+   * is reached.
+   */
+  class WrittenNodesFilter {
+   public:
+    explicit WrittenNodesFilter(size_t capacity);
+
+    bool contains(const common::BufferView &key) const;
+
+    void add(const common::BufferView &key);
+
+    void remove(const common::BufferView &key);
+
+   private:
+    const size_t capacity_;
+    mutable std::mutex mutex_;
+    /// oldest keys first
+    std::list<common::Hash256> order_;
+    std::unordered_map<common::Hash256, std::list<common::Hash256>::iterator>
+        keys_;
+  };
+
   /**
    * Batch implementation for TrieStorageBackend
+   * Skips puts of nodes, which were recently written
    * @see TrieStorageBackend
    */
   class TrieStorageBackendBatch : public BufferBatch {
    public:
-    TrieStorageBackendBatch(std::unique_ptr<BufferBatch> storage_batch);
+    TrieStorageBackendBatch(std::unique_ptr<BufferBatch> storage_batch,
+                            std::shared_ptr<WrittenNodesFilter> written_nodes);
     ~TrieStorageBackendBatch() override = default;
 
     outcome::result<void> commit() override;
@@ -27,8 +61,15 @@ namespace kagome::storage::trie {
     outcome::result<void> remove(const common::BufferView &key) override;
     void clear() override;
 
+    void reserve(size_t bytes) override;
+
    private:
     std::unique_ptr<BufferBatch> storage_batch_;
+    std::shared_ptr<WrittenNodesFilter> written_nodes_;
+    /// keys put into the batch, they are known to exist after commit
+    std::unordered_set<common::Hash256> put_keys_;
+    /// keys removed by the batch, their puts are never skipped
+    std::unordered_set<common::Hash256> removed_keys_;
   };
 
 }  // namespace kagome::storage::trie
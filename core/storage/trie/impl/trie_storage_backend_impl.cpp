@@ -7,13 +7,14 @@
 
 #include <utility>
 
-#include "storage/trie/impl/trie_storage_backend_batch.hpp"
 
 namespace kagome::storage::trie {
 
   TrieStorageBackendImpl::TrieStorageBackendImpl(
       std::shared_ptr<BufferStorage> storage)
-      : storage_{std::move(storage)} {
+      : storage_{std::move(storage)},
+        written_nodes_{std::make_shared<WrittenNodesFilter>(
+            kWrittenNodesFilterCapacity)} {
     BOOST_ASSERT(storage_ != nullptr);
   }
 
@@ -24,7 +25,8 @@ namespace kagome::storage::trie {
   }
 
   std::unique_ptr<BufferBatch> TrieStorageBackendImpl::batch() {
-    return std::make_unique<TrieStorageBackendBatch>(storage_->batch());
+    return std::make_unique<TrieStorageBackendBatch>(storage_->batch(),
+                                                     written_nodes_);
   }
 
   outcome::result<BufferOrView> TrieStorageBackendImpl::get(
@@ -37,6 +39,11 @@ namespace kagome::storage::trie {
     return storage_->tryGet(key);
   }
 
+  outcome::result<std::vector<std::optional<BufferOrView>>>
+  TrieStorageBackendImpl::multiGet(gsl::span<const BufferView> keys) const {
+    return storage_->multiGet(keys);
+  }
+
   outcome::result<bool> TrieStorageBackendImpl::contains(
       const BufferView &key) const {
     return storage_->contains(key);
@@ -46,12 +53,19 @@ namespace kagome::storage::trie {
     return storage_->empty();
   }
 
+  std::shared_ptr<BufferStorage> TrieStorageBackendImpl::snapshot() {
+    return storage_->snapshot();
+  }
+
   outcome::result<void> TrieStorageBackendImpl::put(const BufferView &key,
                                                     BufferOrView &&value) {
-    return storage_->put(key, std::move(value));
+    OUTCOME_TRY(storage_->put(key, std::move(value)));
+    written_nodes_->add(key);
+    return outcome::success();
   }
 
   outcome::result<void> TrieStorageBackendImpl::remove(const BufferView &key) {
+    written_nodes_->remove(key);
     return storage_->remove(key);
   }
 }  // namespace kagome::storage::trie
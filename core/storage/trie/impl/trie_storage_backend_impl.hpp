@@ -8,12 +8,16 @@
 
 #include "common/buffer.hpp"
 #include "outcome/outcome.hpp"
+#include "storage/trie/impl/trie_storage_backend_batch.hpp"
 #include "storage/trie/trie_storage_backend.hpp"
 
 namespace kagome::storage::trie {
 
   class TrieStorageBackendImpl : public TrieStorageBackend {
    public:
+    /// Number of recently written nodes, which are not written again
+    static constexpr size_t kWrittenNodesFilterCapacity = 1 << 16;
+
     TrieStorageBackendImpl(std::shared_ptr<BufferStorage> storage);
 
     ~TrieStorageBackendImpl() override = default;
@@ -24,15 +28,21 @@ namespace kagome::storage::trie {
     outcome::result<BufferOrView> get(const BufferView &key) const override;
     outcome::result<std::optional<BufferOrView>> tryGet(
         const BufferView &key) const override;
+    outcome::result<std::vector<std::optional<BufferOrView>>> multiGet(
+        gsl::span<const BufferView> keys) const override;
     outcome::result<bool> contains(const BufferView &key) const override;
     bool empty() const override;
 
+    /// Snapshot of underlying storage
+    std::shared_ptr<BufferStorage> snapshot() override;
+
     outcome::result<void> put(const BufferView &key,
                               BufferOrView &&value) override;
     outcome::result<void> remove(const common::BufferView &key) override;
 
    private:
     std::shared_ptr<BufferStorage> storage_;
+    std::shared_ptr<WrittenNodesFilter> written_nodes_;
   };
 
 }  // namespace kagome::storage::trie
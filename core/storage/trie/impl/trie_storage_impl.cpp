@@ -10,6 +10,7 @@
 #include "outcome/outcome.hpp"
 #include "storage/trie/impl/ephemeral_trie_batch_impl.hpp"
 #include "storage/trie/impl/persistent_trie_batch_impl.hpp"
+#include "storage/trie/impl/trie_snapshot_impl.hpp"
 
 namespace kagome::storage::trie {
 
@@ -73,4 +74,19 @@ namespace kagome::storage::trie {
         codec_, std::move(trie), serializer_, on_node_loaded);
   }
 
+  outcome::result<std::shared_ptr<TrieSnapshot>> TrieStorageImpl::getSnapshotAt(
+      const RootHash &root) const {
+    SL_DEBUG(logger_, "Initialize trie snapshot with root: {}", root);
+    auto serializer = serializer_->snapshot();
+    if (serializer == nullptr) {
+      // nodes are never overwritten, so live storage is read, but it is not
+      // protected from removal of nodes
+      serializer = serializer_;
+    }
+    // ensure the root exists
+    OUTCOME_TRY(serializer->retrieveTrie(Buffer{root}, nullptr));
+    return std::make_shared<TrieSnapshotImpl>(
+        root, codec_, std::move(serializer));
+  }
+
 }  // namespace kagome::storage::trie
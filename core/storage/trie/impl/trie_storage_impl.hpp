@@ -44,6 +44,8 @@ namespace kagome::storage::trie {
     outcome::result<std::unique_ptr<TrieBatch>> getProofReaderBatchAt(
         const RootHash &root,
         const OnNodeLoaded &on_node_loaded) const override;
+    outcome::result<std::shared_ptr<TrieSnapshot>> getSnapshotAt(
+        const RootHash &root) const override;
 
    protected:
     TrieStorageImpl(std::shared_ptr<Codec> codec,
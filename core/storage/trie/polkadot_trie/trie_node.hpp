@@ -171,6 +171,9 @@ namespace kagome::storage::trie {
     ~LeafNode() override = default;
   };
 
+  /// Dummy children of one branch, @see TrieSerializerImpl
+  struct DummySiblings;
+
   /**
    * Used in branch nodes to indicate that there is a node, but this node is not
    * interesting at the moment and need not be retrieved from the storage.
@@ -184,6 +187,10 @@ namespace kagome::storage::trie {
     explicit DummyNode(common::Buffer key) : db_key{std::move(key)} {}
 
     common::Buffer db_key;
+
+    /// other dummy children of the same branch, which could be retrieved
+    /// together with this one
+    std::shared_ptr<DummySiblings> siblings;
   };
 
   // TODO(turuslan): #1470, refactor retrieve
@@ -5,6 +5,8 @@
 
 #include "storage/trie/serialization/polkadot_codec.hpp"
 
+#include <array>
+
 #include "crypto/blake2/blake2b.h"
 #include "scale/scale.hpp"
 #include "scale/scale_decoder_stream.hpp"
@@ -231,26 +233,60 @@ namespace kagome::storage::trie {
 
     OUTCOME_TRY(encodeValue(encoding, node, version, store_children));
 
-    // encode each child
-    for (auto &child : node.children) {
-      if (child) {
-        if (auto dummy = std::dynamic_pointer_cast<DummyNode>(child);
-            dummy != nullptr) {
-          auto merkle_value = dummy->db_key;
-          OUTCOME_TRY(scale_enc, scale::encode(std::move(merkle_value)));
-          encoding.put(scale_enc);
-        } else {
-          OUTCOME_TRY(enc, encodeNode(*child, version, store_children));
-          auto merkle = merkleValue(enc);
-          if (isMerkleHash(merkle) && store_children) {
-            auto ptr = dynamic_cast<const TrieNode *>(child.get());
-            OUTCOME_TRY(store_children(ptr, merkle, std::move(enc)));
-          }
-          OUTCOME_TRY(scale_enc, scale::encode(merkle));
-          encoding.put(scale_enc);
+    // encode each child, children which have to be hashed are hashed
+    // together in SIMD lanes
+    std::array<Buffer, BranchNode::kMaxChildren> merkle_values;
+    std::array<Buffer, BranchNode::kMaxChildren> hashed_encodings;
+    std::array<size_t, BranchNode::kMaxChildren> hashed;
+    size_t hashed_count = 0;
+    for (size_t i = 0; i < BranchNode::kMaxChildren; ++i) {
+      auto &child = node.children[i];
+      if (not child) {
+        continue;
+      }
+      if (auto dummy = std::dynamic_pointer_cast<DummyNode>(child);
+          dummy != nullptr) {
+        merkle_values[i] = dummy->db_key;
+        continue;
+      }
+      OUTCOME_TRY(enc, encodeNode(*child, version, store_children));
+      if (enc.size() < common::Hash256::size()) {
+        merkle_values[i] = std::move(enc);
+      } else {
+        hashed_encodings[i] = std::move(enc);
+        hashed[hashed_count++] = i;
+      }
+    }
+    if (hashed_count != 0) {
+      std::array<const void *, BranchNode::kMaxChildren> in;
+      std::array<size_t, BranchNode::kMaxChildren> inlen;
+      std::array<common::Hash256, BranchNode::kMaxChildren> hashes;
+      for (size_t j = 0; j < hashed_count; ++j) {
+        in[j] = hashed_encodings[hashed[j]].data();
+        inlen[j] = hashed_encodings[hashed[j]].size();
+      }
+      BOOST_VERIFY(crypto::blake2b_multi(hashes.data(),
+                                         common::Hash256::size(),
+                                         in.data(),
+                                         inlen.data(),
+                                         hashed_count)
+                   == EXIT_SUCCESS);
+      for (size_t j = 0; j < hashed_count; ++j) {
+        auto i = hashed[j];
+        merkle_values[i] = Buffer{hashes[j]};
+        if (store_children) {
+          auto ptr = dynamic_cast<const TrieNode *>(node.children[i].get());
+          OUTCOME_TRY(store_children(
+              ptr, merkle_values[i], std::move(hashed_encodings[i])));
         }
       }
     }
+    for (size_t i = 0; i < BranchNode::kMaxChildren; ++i) {
+      if (node.children[i]) {
+        OUTCOME_TRY(scale_enc, scale::encode(merkle_values[i]));
+        encoding.put(scale_enc);
+      }
+    }
 
     return outcome::success(std::move(encoding));
   }
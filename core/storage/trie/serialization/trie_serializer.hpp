@@ -41,6 +41,12 @@ namespace kagome::storage::trie {
     virtual outcome::result<std::shared_ptr<PolkadotTrie>> retrieveTrie(
         const common::Buffer &db_key,
         OnNodeLoaded on_node_loaded) const = 0;
+
+    /**
+     * Serializer reading snapshot of current content of the storage.
+     * @return nullptr if storage does not support snapshots
+     */
+    virtual std::shared_ptr<TrieSerializer> snapshot() const = 0;
   };
 
 }  // namespace kagome::storage::trie
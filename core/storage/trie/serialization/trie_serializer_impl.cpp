@@ -5,13 +5,39 @@
 
 #include "storage/trie/serialization/trie_serializer_impl.hpp"
 
+#include <algorithm>
+
 #include "outcome/outcome.hpp"
 #include "storage/trie/codec.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
 #include "storage/trie/polkadot_trie/polkadot_trie_factory.hpp"
 #include "storage/trie/polkadot_trie/trie_node.hpp"
 #include "storage/trie/trie_storage_backend.hpp"
 
 namespace kagome::storage::trie {
+  /// minimal number of hashed dummy children of a branch to prefetch together
+  constexpr size_t kMinPrefetchedSiblings = 3;
+
+  /// estimated bytes of batch entry besides key and value: type tag, column
+  /// family id and lengths of key and value
+  constexpr size_t kBatchEntryOverhead = 8;
+
+  /// Prefetch state of dummy children of one decoded branch. It belongs to
+  /// the nodes of a single trie, which is used by one thread at a time like
+  /// the rest of the trie (retrieval replaces dummy children in place), so it
+  /// is not synchronized even though the serializer is shared.
+  struct DummySiblings {
+    struct Sibling {
+      common::Buffer db_key;
+      std::optional<common::Buffer> value;
+      bool retrieved = false;
+    };
+
+    std::vector<Sibling> siblings;
+    size_t retrieved = 0;
+    bool fetched = false;
+  };
+
   TrieSerializerImpl::TrieSerializerImpl(
       std::shared_ptr<PolkadotTrieFactory> factory,
       std::shared_ptr<Codec> codec,
@@ -54,24 +80,47 @@ namespace kagome::storage::trie {
 
   outcome::result<RootHash> TrieSerializerImpl::storeRootNode(
       TrieNode &node, StateVersion version) {
-    auto batch = backend_->batch();
-
+    // nodes are collected first to allocate the batch at once
+    std::vector<std::pair<common::Buffer, common::Buffer>> nodes;
+    size_t bytes = 0;
     OUTCOME_TRY(enc,
                 codec_->encodeNode(node,
                                    version,
                                    [&](const TrieNode *,
                                        common::BufferView hash,
                                        common::Buffer &&encoded) {
-                                     return batch->put(hash,
-                                                       std::move(encoded));
+                                     bytes += kBatchEntryOverhead + hash.size()
+                                            + encoded.size();
+                                     nodes.emplace_back(
+                                         common::Buffer{hash},
+                                         std::move(encoded));
+                                     return outcome::success();
                                    }));
     auto key = codec_->hash256(enc);
+    bytes += kBatchEntryOverhead + key.size() + enc.size();
+
+    auto batch = backend_->batch();
+    batch->reserve(bytes);
+    for (auto &[hash, encoded] : nodes) {
+      OUTCOME_TRY(batch->put(hash, std::move(encoded)));
+    }
     OUTCOME_TRY(batch->put(key, std::move(enc)));
     OUTCOME_TRY(batch->commit());
 
     return key;
   }
 
+  std::shared_ptr<TrieSerializer> TrieSerializerImpl::snapshot() const {
+    auto storage = backend_->snapshot();
+    if (storage == nullptr) {
+      return nullptr;
+    }
+    return std::make_shared<TrieSerializerImpl>(
+        trie_factory_,
+        codec_,
+        std::make_shared<TrieStorageBackendImpl>(std::move(storage)));
+  }
+
   outcome::result<PolkadotTrie::NodePtr> TrieSerializerImpl::retrieveNode(
       const std::shared_ptr<OpaqueTrieNode> &parent,
       const OnNodeLoaded &on_node_loaded) const {
@@ -84,6 +133,15 @@ namespace kagome::storage::trie {
       return nullptr;
     }
     if (auto p = std::dynamic_pointer_cast<DummyNode>(parent); p != nullptr) {
+      if (p->siblings != nullptr) {
+        OUTCOME_TRY(enc, takePrefetched(*p));
+        if (enc) {
+          if (on_node_loaded) {
+            on_node_loaded(*enc);
+          }
+          return decodeNode(*enc);
+        }
+      }
       OUTCOME_TRY(n, retrieveNode(p->db_key, on_node_loaded));
       return std::move(n);
     }
@@ -106,8 +164,66 @@ namespace kagome::storage::trie {
       // `isMerkleHash(db_key) == false` means `db_key` is value itself
       enc = db_key;
     }
+    return decodeNode(enc);
+  }
+
+  outcome::result<PolkadotTrie::NodePtr> TrieSerializerImpl::decodeNode(
+      const common::Buffer &enc) const {
     OUTCOME_TRY(n, codec_->decodeNode(enc));
-    return std::dynamic_pointer_cast<TrieNode>(n);
+    auto node = std::dynamic_pointer_cast<TrieNode>(n);
+    auto branch = std::dynamic_pointer_cast<BranchNode>(node);
+    if (branch == nullptr) {
+      return node;
+    }
+    std::vector<DummyNode *> dummies;
+    for (auto &child : branch->children) {
+      auto dummy = dynamic_cast<DummyNode *>(child.get());
+      if (dummy != nullptr and codec_->isMerkleHash(dummy->db_key)) {
+        dummies.emplace_back(dummy);
+      }
+    }
+    if (dummies.size() < kMinPrefetchedSiblings) {
+      return node;
+    }
+    auto siblings = std::make_shared<DummySiblings>();
+    siblings->siblings.reserve(dummies.size());
+    for (auto dummy : dummies) {
+      siblings->siblings.emplace_back(DummySiblings::Sibling{dummy->db_key});
+      dummy->siblings = siblings;
+    }
+    return node;
+  }
+
+  outcome::result<std::optional<common::Buffer>>
+  TrieSerializerImpl::takePrefetched(const DummyNode &node) const {
+    auto &group = *node.siblings;
+    auto it = std::find_if(
+        group.siblings.begin(), group.siblings.end(), [&](auto &sibling) {
+          return not sibling.retrieved and sibling.db_key == node.db_key;
+        });
+    if (it == group.siblings.end()) {
+      return std::nullopt;
+    }
+    it->retrieved = true;
+    ++group.retrieved;
+    if (not group.fetched and group.retrieved > 1) {
+      group.fetched = true;
+      std::vector<DummySiblings::Sibling *> pending;
+      std::vector<common::BufferView> keys;
+      for (auto &sibling : group.siblings) {
+        if (not sibling.retrieved or &sibling == &*it) {
+          pending.emplace_back(&sibling);
+          keys.emplace_back(sibling.db_key);
+        }
+      }
+      OUTCOME_TRY(values, backend_->multiGet(keys));
+      for (size_t i = 0; i < pending.size(); ++i) {
+        if (values[i]) {
+          pending[i]->value = values[i]->into();
+        }
+      }
+    }
+    return std::exchange(it->value, std::nullopt);
   }
 
 }  // namespace kagome::storage::trie
@@ -15,6 +15,7 @@ namespace kagome::storage::trie {
   class PolkadotTrieFactory;
   class TrieStorageBackend;
   struct BranchNode;
+  struct DummyNode;
   struct TrieNode;
 }  // namespace kagome::storage::trie
 
@@ -36,6 +37,8 @@ namespace kagome::storage::trie {
         const common::Buffer &db_key,
         OnNodeLoaded on_node_loaded) const override;
 
+    std::shared_ptr<TrieSerializer> snapshot() const override;
+
    private:
     /**
      * Writes a node to a persistent storage, recursively storing its
@@ -60,6 +63,25 @@ namespace kagome::storage::trie {
         const std::shared_ptr<OpaqueTrieNode> &node,
         const OnNodeLoaded &on_node_loaded) const;
 
+    /**
+     * Decodes a node and links hashed dummy children of a branch, so they
+     * could be fetched from the storage together
+     */
+    outcome::result<PolkadotTrie::NodePtr> decodeNode(
+        const common::Buffer &enc) const;
+
+    /**
+     * Returns encoded node prefetched with its siblings. When the second
+     * sibling of a branch is requested, the traversal is likely to visit the
+     * rest of them too, so all of the remaining siblings are read from the
+     * storage with a single multiGet. std::nullopt means the node has to be
+     * read on its own.
+     * Updates the unsynchronized sibling group of `node`, so it must not be
+     * called concurrently for nodes of the same trie.
+     */
+    outcome::result<std::optional<common::Buffer>> takePrefetched(
+        const DummyNode &node) const;
+
     std::shared_ptr<PolkadotTrieFactory> trie_factory_;
     std::shared_ptr<Codec> codec_;
     std::shared_ptr<TrieStorageBackend> backend_;
@@ -0,0 +1,22 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/trie_batches.hpp"
+
+#include <scale/encode_append.hpp>
+
+namespace kagome::storage::trie {
+
+  outcome::result<void> TrieBatch::append(const BufferView &key,
+                                          const BufferView &item) {
+    OUTCOME_TRY(value_opt, tryGet(key));
+    auto value = value_opt ? value_opt->into() : Buffer{};
+    if (scale::append_or_new_vec(value.asVector(), item).has_error()) {
+      return outcome::success();
+    }
+    return put(key, std::move(value));
+  }
+
+}  // namespace kagome::storage::trie
@@ -39,6 +39,15 @@ namespace kagome::storage::trie {
 
     virtual outcome::result<std::optional<std::shared_ptr<TrieBatch>>>
     createChildBatch(common::BufferView path) = 0;
+
+    /**
+     * Append SCALE encoded item to SCALE encoded vector stored by the key,
+     * store vector of the item if there is no value. Value which is not a
+     * vector is left unchanged.
+     * Batches may defer concatenation until the value is read.
+     */
+    virtual outcome::result<void> append(const BufferView &key,
+                                         const BufferView &item);
   };
 
   class TopperTrieBatch;
@@ -50,7 +59,7 @@ namespace kagome::storage::trie {
   class TopperTrieBatch : public TrieBatch {
    public:
     /**
-     * Writes changes to the parent batch
+     * Writes changes to the parent batch, leaving this batch empty
      */
     virtual outcome::result<void> writeBack() = 0;
   };
@@ -0,0 +1,42 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_STORAGE_TRIE_TRIE_SNAPSHOT
+#define KAGOME_STORAGE_TRIE_TRIE_SNAPSHOT
+
+#include "storage/trie/trie_batches.hpp"
+#include "storage/trie/types.hpp"
+
+namespace kagome::storage::trie {
+
+  /**
+   * Immutable state pinned at some root.
+   * Later writes to the storage do not affect it, so it can be read by many
+   * threads in parallel while blocks are imported. State is kept while the
+   * snapshot is referenced.
+   */
+  class TrieSnapshot {
+   public:
+    virtual ~TrieSnapshot() = default;
+
+    virtual const RootHash &root() const = 0;
+
+    /**
+     * Creates a batch reading the snapshot. Batch is not thread-safe, so
+     * every reader thread creates its own batch.
+     */
+    virtual outcome::result<std::unique_ptr<TrieBatch>> batch() const = 0;
+
+    /**
+     * Creates a batch reading another trie stored in the snapshot, e.g. a
+     * child trie
+     */
+    virtual outcome::result<std::unique_ptr<TrieBatch>> batchAt(
+        const RootHash &root) const = 0;
+  };
+
+}  // namespace kagome::storage::trie
+
+#endif  // KAGOME_STORAGE_TRIE_TRIE_SNAPSHOT
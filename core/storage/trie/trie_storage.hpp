@@ -9,6 +9,7 @@
 #include "common/blob.hpp"
 #include "storage/changes_trie/changes_tracker.hpp"
 #include "storage/trie/trie_batches.hpp"
+#include "storage/trie/trie_snapshot.hpp"
 #include "storage/trie/types.hpp"
 
 namespace kagome::storage::trie {
@@ -40,6 +41,13 @@ namespace kagome::storage::trie {
 
     virtual outcome::result<std::unique_ptr<TrieBatch>> getProofReaderBatchAt(
         const RootHash &root, const OnNodeLoaded &on_node_loaded) const = 0;
+
+    /**
+     * Pins state at the provided root for parallel readers
+     * @see TrieSnapshot
+     */
+    virtual outcome::result<std::shared_ptr<TrieSnapshot>> getSnapshotAt(
+        const RootHash &root) const = 0;
   };
 
 }  // namespace kagome::storage::trie
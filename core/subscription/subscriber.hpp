@@ -7,10 +7,13 @@
 #define KAGOME_SUBSCRIPTION_SUBSCRIBER_HPP
 
 #include <atomic>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
 
+#include <boost/assert.hpp>
+
 #include "subscription/subscription_engine.hpp"
 
 namespace kagome::subscription {
@@ -48,10 +51,19 @@ namespace kagome::subscription {
                                               const EventType &,
                                               const Arguments &...)>;
 
+    /// Delivers event later, must own everything it needs
+    using DeferredFnType = std::function<void()>;
+    using AsyncCallbackFnType =
+        std::function<DeferredFnType(SubscriptionSetId,
+                                     ReceiverType &,
+                                     const EventType &,
+                                     const Arguments &...)>;
+    using ExecutorFnType = std::function<void(std::function<void()>)>;
+
    private:
     using SubscriptionsContainer =
         std::unordered_map<EventType,
-                           typename SubscriptionEngineType::IteratorType>;
+                           typename SubscriptionEngineType::TokenType>;
     using SubscriptionsSets =
         std::unordered_map<SubscriptionSetId, SubscriptionsContainer>;
     SubscriptionEnginePtr engine_;
@@ -62,6 +74,28 @@ namespace kagome::subscription {
 
     CallbackFnType on_notify_callback_;
 
+    AsyncCallbackFnType on_notify_async_callback_;
+    ExecutorFnType executor_;
+    std::function<void()> on_drop_;
+    size_t queue_limit_ = 0;
+
+    std::mutex queue_cs_;
+    std::deque<DeferredFnType> queue_;
+    bool draining_ = false;
+    std::atomic<size_t> dropped_{0};
+
+    void drain() {
+      std::unique_lock lock(queue_cs_);
+      while (not queue_.empty()) {
+        auto deferred = std::move(queue_.front());
+        queue_.pop_front();
+        lock.unlock();
+        deferred();
+        lock.lock();
+      }
+      draining_ = false;
+    }
+
    public:
     template <typename... SubscriberConstructorArgs>
     explicit Subscriber(SubscriptionEnginePtr ptr,
@@ -85,6 +119,34 @@ namespace kagome::subscription {
       on_notify_callback_ = std::move(f);
     }
 
+    /**
+     * Decouples event delivery from notifying thread.
+     * @param f -- called on notifying thread, returns function which delivers
+     * the event and is executed later by \arg executor in order of events
+     * @param executor -- schedules delivery of queued events
+     * @param queue_limit -- max number of undelivered events, newer events
+     * are dropped when reached
+     * @param on_drop -- called on each dropped event
+     */
+    void setAsyncCallback(AsyncCallbackFnType &&f,
+                          ExecutorFnType &&executor,
+                          size_t queue_limit,
+                          std::function<void()> &&on_drop = {}) {
+      BOOST_ASSERT(executor);
+      BOOST_ASSERT(queue_limit > 0);
+      on_notify_async_callback_ = std::move(f);
+      executor_ = std::move(executor);
+      queue_limit_ = queue_limit;
+      on_drop_ = std::move(on_drop);
+    }
+
+    /**
+     * @return number of events dropped because of full queue
+     */
+    size_t droppedEvents() const {
+      return dropped_.load(std::memory_order_relaxed);
+    }
+
     SubscriptionSetId generateSubscriptionSetId() {
       return generateNextId();
     }
@@ -92,7 +154,7 @@ namespace kagome::subscription {
     void subscribe(SubscriptionSetId id, const EventType &key) {
       std::lock_guard lock(subscriptions_cs_);
       auto &&[it, inserted] = subscriptions_sets_[id].emplace(
-          key, typename SubscriptionEngineType::IteratorType{});
+          key, typename SubscriptionEngineType::TokenType{});
 
       /// Here we check first local subscriptions because of strong connection
       /// with SubscriptionEngine.
@@ -150,6 +212,28 @@ namespace kagome::subscription {
                    const Arguments &...args) {
       if (nullptr != on_notify_callback_)
         on_notify_callback_(set_id, object_, key, args...);
+
+      if (nullptr != on_notify_async_callback_) {
+        std::unique_lock lock(queue_cs_);
+        if (queue_.size() >= queue_limit_) {
+          lock.unlock();
+          dropped_.fetch_add(1, std::memory_order_relaxed);
+          if (nullptr != on_drop_) on_drop_();
+          return;
+        }
+        auto deferred =
+            on_notify_async_callback_(set_id, object_, key, args...);
+        if (nullptr == deferred) return;
+
+        queue_.emplace_back(std::move(deferred));
+        if (draining_) return;
+
+        draining_ = true;
+        lock.unlock();
+        executor_([weak{this->weak_from_this()}] {
+          if (auto self = weak.lock()) self->drain();
+        });
+      }
     }
 
     ReceiverType &get() {
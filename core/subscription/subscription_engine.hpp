@@ -6,10 +6,10 @@
 #ifndef KAGOME_SUBSCRIPTION_ENGINE_HPP
 #define KAGOME_SUBSCRIPTION_ENGINE_HPP
 
-#include <list>
 #include <memory>
 #include <shared_mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace kagome::subscription {
 
@@ -37,13 +37,21 @@ namespace kagome::subscription {
         Subscriber<EventKeyType, ReceiverType, EventParams...>;
     using SubscriberWeakPtr = std::weak_ptr<SubscriberType>;
 
-    /// List is preferable here because this container iterators remain
-    /// alive after removal from the middle of the container
-    /// TODO(iceseer): PRE-476 remove processor cache penalty, while iterating,
-    /// using custom allocator
-    using SubscribersContainer =
-        std::list<std::pair<SubscriptionSetId, SubscriberWeakPtr>>;
-    using IteratorType = typename SubscribersContainer::iterator;
+    /// Identifies subscription of a subscriber to a key, used to unsubscribe
+    using TokenType = uint64_t;
+
+    struct SubscriberEntry {
+      TokenType token;
+      SubscriptionSetId set_id;
+      SubscriberWeakPtr subscriber;
+    };
+
+    /// Subscribers of a key are kept in immutable container, which is
+    /// replaced on every (un)subscription (copy-on-write). Notification only
+    /// takes a snapshot of it under shared lock and delivers events without
+    /// holding the lock, so subscribers may (un)subscribe meanwhile.
+    using SubscribersContainer = std::vector<SubscriberEntry>;
+    using SubscribersSnapshot = std::shared_ptr<const SubscribersContainer>;
 
    public:
     SubscriptionEngine() = default;
@@ -59,34 +67,54 @@ namespace kagome::subscription {
     template <typename KeyType, typename ValueType, typename... Args>
     friend class Subscriber;
     using KeyValueContainer =
-        std::unordered_map<EventKeyType, SubscribersContainer>;
+        std::unordered_map<EventKeyType, SubscribersSnapshot>;
 
     mutable std::shared_mutex subscribers_map_cs_;
     KeyValueContainer subscribers_map_;
+    TokenType last_token_ = 0;
 
-    IteratorType subscribe(SubscriptionSetId set_id,
-                           const EventKeyType &key,
-                           SubscriberWeakPtr ptr) {
+    TokenType subscribe(SubscriptionSetId set_id,
+                        const EventKeyType &key,
+                        SubscriberWeakPtr ptr) {
       std::unique_lock lock(subscribers_map_cs_);
-      auto &subscribers_list = subscribers_map_[key];
-      return subscribers_list.emplace(subscribers_list.end(),
-                                      std::make_pair(set_id, std::move(ptr)));
+      auto &snapshot = subscribers_map_[key];
+      auto subscribers =
+          snapshot ? std::make_shared<SubscribersContainer>(*snapshot)
+                   : std::make_shared<SubscribersContainer>();
+      const auto token = ++last_token_;
+      subscribers->emplace_back(SubscriberEntry{token, set_id, std::move(ptr)});
+      snapshot = std::move(subscribers);
+      return token;
     }
 
-    void unsubscribe(const EventKeyType &key, const IteratorType &it_remove) {
+    void unsubscribe(const EventKeyType &key, TokenType token) {
       std::unique_lock lock(subscribers_map_cs_);
       auto it = subscribers_map_.find(key);
-      if (subscribers_map_.end() != it) {
-        it->second.erase(it_remove);
-        if (it->second.empty()) subscribers_map_.erase(it);
+      if (subscribers_map_.end() == it) return;
+
+      auto subscribers = std::make_shared<SubscribersContainer>();
+      subscribers->reserve(it->second->size());
+      for (auto &entry : *it->second) {
+        if (entry.token != token) subscribers->emplace_back(entry);
+      }
+      if (subscribers->empty()) {
+        subscribers_map_.erase(it);
+      } else {
+        it->second = std::move(subscribers);
       }
     }
 
-   public:
-    size_t size(const EventKeyType &key) const {
+    SubscribersSnapshot snapshot(const EventKeyType &key) const {
       std::shared_lock lock(subscribers_map_cs_);
       if (auto it = subscribers_map_.find(key); it != subscribers_map_.end())
-        return it->second.size();
+        return it->second;
+
+      return nullptr;
+    }
+
+   public:
+    size_t size(const EventKeyType &key) const {
+      if (auto subscribers = snapshot(key)) return subscribers->size();
 
       return 0ull;
     }
@@ -94,23 +122,17 @@ namespace kagome::subscription {
     size_t size() const {
       std::shared_lock lock(subscribers_map_cs_);
       size_t count = 0ull;
-      for (auto &it : subscribers_map_) count += it.second.size();
+      for (auto &it : subscribers_map_) count += it.second->size();
       return count;
     }
 
     void notify(const EventKeyType &key, const EventParams &...args) {
-      std::shared_lock lock(subscribers_map_cs_);
-      auto it = subscribers_map_.find(key);
-      if (subscribers_map_.end() == it) return;
+      auto subscribers = snapshot(key);
+      if (not subscribers) return;
 
-      auto &subscribers_container = it->second;
-      for (auto it_sub = subscribers_container.begin();
-           it_sub != subscribers_container.end();) {
-        if (auto sub = it_sub->second.lock()) {
-          sub->on_notify(it_sub->first, key, args...);
-          ++it_sub;
-        } else {
-          it_sub = subscribers_container.erase(it_sub);
+      for (auto &entry : *subscribers) {
+        if (auto sub = entry.subscriber.lock()) {
+          sub->on_notify(entry.set_id, key, args...);
         }
       }
     }
@@ -5,24 +5,18 @@
 
 #include "telemetry/impl/message_pool.hpp"
 
-#include <mutex>  // for std::lock_guard
+#include <cstring>
 
 #include <boost/assert.hpp>
 
 namespace kagome::telemetry {
   MessagePool::MessagePool(std::size_t entry_size_bytes,
                            std::size_t entries_count)
-      : entry_size_{entry_size_bytes}, entries_count_{entries_count} {
-    // preallocate all the buffers
-    pool_.resize(entries_count);
-    for (auto &entry : pool_) {
-      entry.data.resize(entry_size_bytes, '\0');
-    }
-    free_slots_.reserve(entries_count);
-    for (size_t i = 0; i < entries_count; ++i) {
-      free_slots_.emplace(i);
-    }
-  }
+      : entry_size_{entry_size_bytes},
+        entries_count_{entries_count},
+        // preallocate all the buffers
+        storage_(entry_size_bytes * entries_count, 0),
+        records_(entries_count) {}
 
   std::optional<MessageHandle> MessagePool::push(const std::string &message,
                                                  int16_t ref_count) {
@@ -33,81 +27,103 @@ namespace kagome::telemetry {
     if (ref_count <= 0) {
       return std::nullopt;
     }
-    auto has_free_slot = nextFreeSlot();  // quick blocking lookup
-    if (not has_free_slot) {
+    auto slot = acquireSlot();  // quick lock-free lookup
+    if (not slot) {
       return std::nullopt;
     }
-
-    auto slot = has_free_slot.value();
-    auto &entry = pool_[slot];
-    entry.ref_count = ref_count;
-    entry.data_size = message.length();
-    memcpy(entry.data.data(), message.c_str(), message.length());
-    // presence of zero-terminating char is preserved by the way of memory
-    // (re-)initialization in constructor and release method, and also a
-    // boundary check here - at the first line of push method
+    memcpy(recordData(*slot), message.data(), message.length());
+    commitSlot(*slot, message.length(), ref_count);
     return slot;
   }
 
   MessagePool::RefCount MessagePool::add_ref(MessageHandle handle) {
-    bool handle_is_valid =
-        (handle < pool_.size()) and (free_slots_.count(handle) == 0);
-    if (not handle_is_valid) {
+    if (handle >= entries_count_) {
       return 0;  // zero references for bad handle
     }
-    std::lock_guard lock(mutex_);
+    auto &ref_count = records_[handle].ref_count;
+    auto current = ref_count.load(std::memory_order_relaxed);
     // allowed to call only over already occupied slots
-    BOOST_ASSERT(free_slots_.count(handle) == 0);
-    auto &entry = pool_[handle];
-    return ++entry.ref_count;
+    while (current > 0) {
+      if (ref_count.compare_exchange_weak(
+              current, current + 1, std::memory_order_relaxed)) {
+        return current + 1;
+      }
+    }
+    return 0;
   }
 
   MessagePool::RefCount MessagePool::release(MessageHandle handle) {
-    bool handle_is_valid =
-        (handle < pool_.size()) and (free_slots_.count(handle) == 0);
-    if (not handle_is_valid) {
+    if (handle >= entries_count_) {
       return 0;  // zero references for bad handle
     }
-    std::lock_guard lock(mutex_);
-    auto &entry = pool_[handle];
-    if (entry.ref_count > 0 and --entry.ref_count == 0) {
-      memset(entry.data.data(), '\0', entry.data.size());
-      entry.data_size = 0;
-      free_slots_.emplace(handle);
+    auto &ref_count = records_[handle].ref_count;
+    auto current = ref_count.load(std::memory_order_relaxed);
+    while (current > 0) {
+      // release order makes all reads of the record happen before the slot
+      // could be reused by a writer
+      if (ref_count.compare_exchange_weak(
+              current, current - 1, std::memory_order_release)) {
+        return current - 1;
+      }
     }
-    return entry.ref_count;
+    return 0;
   }
 
   boost::asio::mutable_buffer MessagePool::operator[](
       MessageHandle handle) const {
     bool handle_is_valid =
-        (handle < pool_.size()) and (free_slots_.count(handle) == 0);
+        handle < entries_count_
+        and records_[handle].ref_count.load(std::memory_order_acquire) > 0;
     if (not handle_is_valid) {
       throw std::runtime_error("Bad access through invalid handle");
     }
-    // No synchronization required due to the design of its use way.
-    // Read access might be requested only when a handle is already acquired.
-    // => There would be no race during initialization and read.
     // The buffer will remain valid till all holders request its release.
     // The handle cannot be reassigned prior to complete release.
     // => There is no chance to get dangling pointers inside boost buffers.
-    auto &entry = pool_[handle];
-    return boost::asio::buffer(const_cast<uint8_t *>(entry.data.data()),
-                               entry.data_size);
+    return boost::asio::buffer(
+        const_cast<uint8_t *>(storage_.data() + handle * entry_size_),
+        records_[handle].data_size);
   }
 
   std::size_t MessagePool::capacity() const {
     return entries_count_;
   }
 
-  std::optional<MessageHandle> MessagePool::nextFreeSlot() {
-    std::lock_guard lock(mutex_);
-    if (free_slots_.empty()) {
+  std::optional<MessageHandle> MessagePool::acquireSlot() {
+    if (entries_count_ == 0) {
       return std::nullopt;
     }
-    auto free_slot = free_slots_.begin();
-    auto slot = *free_slot;
-    free_slots_.erase(free_slot);
-    return slot;
+    auto start = cursor_.fetch_add(1, std::memory_order_relaxed);
+    for (size_t i = 0; i < entries_count_; ++i) {
+      auto slot = (start + i) % entries_count_;
+      RefCount expected = 0;
+      if (records_[slot].ref_count.compare_exchange_strong(
+              expected, kWriting, std::memory_order_acquire)) {
+        if (i != 0) {
+          // continue from the found slot next time
+          cursor_.store(slot + 1, std::memory_order_relaxed);
+        }
+        return slot;
+      }
+    }
+    return std::nullopt;
+  }
+
+  void MessagePool::commitSlot(MessageHandle slot,
+                               std::size_t data_size,
+                               RefCount ref_count) {
+    BOOST_ASSERT(records_[slot].ref_count == kWriting);
+    records_[slot].data_size = data_size;
+    records_[slot].ref_count.store(ref_count, std::memory_order_release);
+  }
+
+  void MessagePool::releaseSlot(MessageHandle slot) {
+    BOOST_ASSERT(records_[slot].ref_count == kWriting);
+    records_[slot].data_size = 0;
+    records_[slot].ref_count.store(0, std::memory_order_release);
+  }
+
+  uint8_t *MessagePool::recordData(MessageHandle slot) {
+    return storage_.data() + slot * entry_size_;
   }
 }  // namespace kagome::telemetry
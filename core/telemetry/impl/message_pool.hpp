@@ -6,14 +6,14 @@
 #ifndef KAGOME_MESSAGE_POOL_HPP
 #define KAGOME_MESSAGE_POOL_HPP
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <string>
-#include <unordered_set>
+#include <vector>
 
 #include <boost/asio/buffer.hpp>
-#include "common/spin_lock.hpp"
 
 namespace kagome::telemetry {
 
@@ -24,14 +24,13 @@ namespace kagome::telemetry {
    * operations are in progress.
    *
    * The pool is designed to be extremely fast against data-copy operations.
-   * That is why all the storage buffers are pre-allocated during the
-   * construction.
-   * All the copy operations are performed in a fastest manner via memcpy.
+   * That is why all the storage is pre-allocated as a single buffer during the
+   * construction, and messages could be serialized directly into it.
    *
-   * Access operations to shared data where data race is possible are
-   * synchronized via spin locks. Locking is performed for a smallest possible
-   * set of lines of code. Spin locks let us avoid expensive context switches
-   * and performance degradation.
+   * Slots are organized as a ring. Each slot is guarded by its own atomic
+   * reference counter, so no locks are taken neither to acquire nor to release
+   * a slot. Since messages are released mostly in order of pushing, the slot
+   * next to the last acquired one is usually free.
    */
   class MessagePool {
    public:
@@ -43,6 +42,44 @@ namespace kagome::telemetry {
      * overflow).
      */
     using RefCount = int16_t;
+
+    /**
+     * Output stream over the memory of a pool record, compatible with
+     * rapidjson writers.
+     * Data exceeding the record size is dropped and overflow is reported.
+     */
+    class RecordStream {
+     public:
+      using Ch = char;
+
+      RecordStream(uint8_t *data, std::size_t capacity)
+          : data_{data}, capacity_{capacity} {}
+
+      void Put(Ch c) {
+        if (size_ < capacity_) {
+          data_[size_++] = static_cast<uint8_t>(c);
+        } else {
+          overflow_ = true;
+        }
+      }
+
+      void Flush() {}
+
+      std::size_t size() const {
+        return size_;
+      }
+
+      bool overflow() const {
+        return overflow_;
+      }
+
+     private:
+      uint8_t *data_;
+      std::size_t capacity_;
+      std::size_t size_ = 0;
+      bool overflow_ = false;
+    };
+
     /**
      * Contruct the pool
      * @param entry_size_bytes - max size of a single record
@@ -62,6 +99,32 @@ namespace kagome::telemetry {
     std::optional<MessageHandle> push(const std::string &message,
                                       int16_t ref_count);
 
+    /**
+     * Serialize a message directly into the pool memory
+     * @param ref_count - initial reference counter value for the record
+     * @param write - functor accepting RecordStream & to write the message to
+     * @return - handle to the record or std::nullopt when the pool is full or
+     * the message exceeds max record size
+     */
+    template <typename F>
+    std::optional<MessageHandle> emplace(RefCount ref_count, F &&write) {
+      if (ref_count <= 0) {
+        return std::nullopt;
+      }
+      auto slot = acquireSlot();
+      if (not slot) {
+        return std::nullopt;
+      }
+      RecordStream stream{recordData(*slot), entry_size_};
+      std::forward<F>(write)(stream);
+      if (stream.overflow()) {
+        releaseSlot(*slot);
+        return std::nullopt;
+      }
+      commitSlot(*slot, stream.size(), ref_count);
+      return slot;
+    }
+
     /**
      * Increase reference counter for the specified handle
      * @param handle - handle to the record
@@ -93,20 +156,33 @@ namespace kagome::telemetry {
     std::size_t capacity() const;
 
    private:
-    /// performs quick lookup for a free slot
-    std::optional<MessageHandle> nextFreeSlot();
+    /// reference counter value of a slot being written
+    static constexpr RefCount kWriting = -1;
 
     struct Record {
-      std::vector<uint8_t> data;
+      std::atomic<RefCount> ref_count = 0;
       std::size_t data_size = 0;
-      std::size_t ref_count = 0;
     };
 
+    /// finds a free slot starting from the ring cursor and marks it as being
+    /// written
+    std::optional<MessageHandle> acquireSlot();
+
+    /// publishes written slot to readers
+    void commitSlot(MessageHandle slot,
+                    std::size_t data_size,
+                    RefCount ref_count);
+
+    /// frees acquired slot without publishing
+    void releaseSlot(MessageHandle slot);
+
+    uint8_t *recordData(MessageHandle slot);
+
     const std::size_t entry_size_;
     const std::size_t entries_count_;
-    std::vector<Record> pool_;
-    std::unordered_set<std::size_t> free_slots_;
-    common::spin_lock mutex_;
+    std::vector<uint8_t> storage_;
+    std::vector<Record> records_;
+    std::atomic_size_t cursor_ = 0;
   };
 
 }  // namespace kagome::telemetry
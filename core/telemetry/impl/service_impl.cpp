@@ -26,12 +26,39 @@ namespace rapidjson {
 #include "telemetry/impl/connection_impl.hpp"
 
 namespace {
+  using JsonWriter =
+      rapidjson::Writer<kagome::telemetry::MessagePool::RecordStream>;
+
   std::string json2string(rapidjson::Document &document) {
     rapidjson::StringBuffer buffer;
     rapidjson::Writer writer(buffer);
     document.Accept(writer);
     return buffer.GetString();
   }
+
+  void writeString(JsonWriter &writer, std::string_view str) {
+    writer.String(str.data(), static_cast<rapidjson::SizeType>(str.size()));
+  }
+
+  /**
+   * Writes telemetry message envelope
+   * @param payload - functor writing members of the payload object
+   */
+  template <typename F>
+  void writeMessage(JsonWriter &writer,
+                    std::string_view timestamp,
+                    F &&payload) {
+    writer.StartObject();
+    writer.Key("id");
+    writer.Int(1);
+    writer.Key("payload");
+    writer.StartObject();
+    std::forward<F>(payload)();
+    writer.EndObject();
+    writer.Key("ts");
+    writeString(writer, timestamp);
+    writer.EndObject();
+  }
 }  // namespace
 
 namespace kagome::telemetry {
@@ -188,24 +215,32 @@ namespace kagome::telemetry {
       return;
     }
     std::optional<MessageHandle> last_imported_msg, last_finalized_msg;
-    auto refs = connections_.size();
+    auto refs = static_cast<MessagePool::RefCount>(connections_.size());
+    std::optional<std::pair<primitives::BlockInfo, BlockOrigin>> last_imported;
+    std::optional<primitives::BlockInfo> last_finalized;
     {
-      // do quick information retrieval under spin lock
+      // do quick information retrieval under spin lock, messages are
+      // serialized after, so block import is never blocked by telemetry
       std::lock_guard lock(cache_mutex_);
-      // prepare last imported block message
       if (last_imported_.is_set) {
         last_imported_.is_set = false;
-        auto msg =
-            blockNotification(last_imported_.block, last_imported_.origin);
-        last_imported_msg = message_pool_->push(msg, refs);
+        last_imported.emplace(last_imported_.block, last_imported_.origin);
       }
-      // prepare last finalized message if there is a need to
       if (last_finalized_.reported < last_finalized_.block.number) {
-        auto msg = blockNotification(last_finalized_.block, std::nullopt);
-        last_finalized_msg = message_pool_->push(msg, refs);
+        last_finalized = last_finalized_.block;
         last_finalized_.reported = last_finalized_.block.number;
       }
     }
+    // prepare last imported block message
+    if (last_imported) {
+      last_imported_msg = blockNotification(
+          last_imported->first, last_imported->second, refs);
+    }
+    // prepare last finalized message if there is a need to
+    if (last_finalized) {
+      last_finalized_msg =
+          blockNotification(*last_finalized, std::nullopt, refs);
+    }
     for (auto &conn : connections_) {
       if (last_imported_msg) {
         conn->send(*last_imported_msg);
@@ -223,10 +258,9 @@ namespace kagome::telemetry {
     if (shutdown_requested_) {
       return;
     }
-    std::optional<MessageHandle> system_msg_1, system_msg_2;
-    auto refs = connections_.size();
-    system_msg_1 = message_pool_->push(systemIntervalMessage1(), refs);
-    system_msg_2 = message_pool_->push(systemIntervalMessage2(), refs);
+    auto refs = static_cast<MessagePool::RefCount>(connections_.size());
+    auto system_msg_1 = systemIntervalMessage1(refs);
+    auto system_msg_2 = systemIntervalMessage2(refs);
 
     for (auto &conn : connections_) {
       if (system_msg_1) {
@@ -311,152 +345,127 @@ namespace kagome::telemetry {
     if (not enabled_ or shutdown_requested_) {
       return;
     }
+    std::lock_guard lock(cache_mutex_);
     if (info.number > last_finalized_.block.number) {
-      std::lock_guard lock(cache_mutex_);
       last_finalized_.block = info;
     }
   }
 
-  std::string TelemetryServiceImpl::blockNotification(
-      const primitives::BlockInfo &info, std::optional<BlockOrigin> origin) {
-    std::string event_name =
+  std::optional<MessageHandle> TelemetryServiceImpl::blockNotification(
+      const primitives::BlockInfo &info,
+      std::optional<BlockOrigin> origin,
+      MessagePool::RefCount refs) {
+    std::string_view event_name =
         origin.has_value() ? "block.import" : "notify.finalized";
-
-    rapidjson::Document document;
-    document.SetObject();
-    auto &allocator = document.GetAllocator();
-    auto str_val = [&allocator](const std::string &str) -> rapidjson::Value & {
-      static rapidjson::Value val;
-      val.SetString(str.c_str(),
-                    static_cast<rapidjson::SizeType>(str.length()),
-                    allocator);
-      return val;
-    };
-
-    rapidjson::Value payload(rapidjson::kObjectType), height;
-
-    payload.AddMember(
-        "best", str_val(fmt::format("{:l}", info.hash)), allocator);
-
+    std::string_view origin_name;
     if (origin.has_value()) {
-      height.SetInt(info.number);
-      rapidjson::Value origin_val;
       using o = BlockOrigin;
       switch (origin.value()) {
         case o::kGenesis:
-          origin_val = str_val("Genesis");
+          origin_name = "Genesis";
           break;
         case o::kNetworkInitialSync:
-          origin_val = was_synchronized_ ? str_val("NetworkBroadcast")
-                                         : str_val("NetworkInitialSync");
+          origin_name =
+              was_synchronized_ ? "NetworkBroadcast" : "NetworkInitialSync";
           break;
         case o::kNetworkBroadcast:
-          origin_val = str_val("NetworkBroadcast");
+          origin_name = "NetworkBroadcast";
           break;
         case o::kConsensusBroadcast:
-          origin_val = str_val("ConsensusBroadcast");
+          origin_name = "ConsensusBroadcast";
           break;
         case o::kOwn:
-          origin_val = str_val("Own");
+          origin_name = "Own";
           break;
         case o::kFile:
         default:
-          origin_val = str_val("File");
+          origin_name = "File";
       }
-      payload.AddMember("origin", origin_val, allocator);
-    } else {
-      auto finalized_height_str = std::to_string(info.number);
-      height.SetString(
-          finalized_height_str.c_str(),
-          static_cast<rapidjson::SizeType>(finalized_height_str.length()),
-          allocator);
     }
-    payload.AddMember("height", height, allocator)
-        .AddMember("msg", str_val(event_name), allocator);
-
-    document.AddMember("id", 1, allocator)
-        .AddMember("payload", payload, allocator)
-        .AddMember("ts", str_val(currentTimestamp()), allocator);
-
-    return json2string(document);
+    auto best = fmt::format("{:l}", info.hash);
+    auto timestamp = currentTimestamp();
+
+    return message_pool_->emplace(
+        refs, [&](MessagePool::RecordStream &stream) {
+          JsonWriter writer{stream};
+          writeMessage(writer, timestamp, [&] {
+            writer.Key("best");
+            writeString(writer, best);
+            if (origin.has_value()) {
+              writer.Key("origin");
+              writeString(writer, origin_name);
+              writer.Key("height");
+              writer.Uint(info.number);
+            } else {
+              writer.Key("height");
+              writeString(writer, std::to_string(info.number));
+            }
+            writer.Key("msg");
+            writeString(writer, event_name);
+          });
+        });
   }
 
-  std::string TelemetryServiceImpl::systemIntervalMessage1() {
-    rapidjson::Document document;
-    document.SetObject();
-    auto &allocator = document.GetAllocator();
-    auto str_val = [&allocator](const std::string &str) -> rapidjson::Value & {
-      static rapidjson::Value val;
-      val.SetString(str.c_str(),
-                    static_cast<rapidjson::SizeType>(str.length()),
-                    allocator);
-      return val;
-    };
-
-    rapidjson::Value payload(rapidjson::kObjectType);
-
-    rapidjson::Value height, finalized_height, tx_count, state_size, best_hash,
-        finalized_hash;
+  std::optional<MessageHandle> TelemetryServiceImpl::systemIntervalMessage1(
+      MessagePool::RefCount refs) {
+    primitives::BlockInfo best, finalized;
     {
       std::lock_guard lock(cache_mutex_);
-      height.SetInt(last_imported_.block.number);
-      finalized_height.SetInt(last_finalized_.block.number);
-      tx_count.SetInt(tx_pool_->getStatus().ready_num);
-      state_size.SetInt(buffer_storage_->size());
-      best_hash = str_val(fmt::format("{:l}", last_imported_.block.hash));
-      finalized_hash = str_val(fmt::format("{:l}", last_finalized_.block.hash));
+      best = last_imported_.block;
+      finalized = last_finalized_.block;
     }
-
-    // fields order is preserved the same way substrate orders it
-    payload.AddMember("best", best_hash, allocator)
-        .AddMember("finalized_hash", finalized_hash, allocator)
-        .AddMember("finalized_height", finalized_height, allocator)
-        .AddMember("height", height, allocator)
-        .AddMember("msg", str_val("system.interval"), allocator)
-        .AddMember("txcount", tx_count, allocator)
-        .AddMember("used_state_cache_size", state_size, allocator);
-
-    document.AddMember("id", 1, allocator)
-        .AddMember("payload", payload, allocator)
-        .AddMember("ts", str_val(currentTimestamp()), allocator);
-
-    return json2string(document);
+    auto tx_count = tx_pool_->getStatus().ready_num;
+    auto state_size = buffer_storage_->size();
+    auto best_hash = fmt::format("{:l}", best.hash);
+    auto finalized_hash = fmt::format("{:l}", finalized.hash);
+    auto timestamp = currentTimestamp();
+
+    return message_pool_->emplace(
+        refs, [&](MessagePool::RecordStream &stream) {
+          JsonWriter writer{stream};
+          writeMessage(writer, timestamp, [&] {
+            // fields order is preserved the same way substrate orders it
+            writer.Key("best");
+            writeString(writer, best_hash);
+            writer.Key("finalized_hash");
+            writeString(writer, finalized_hash);
+            writer.Key("finalized_height");
+            writer.Uint(finalized.number);
+            writer.Key("height");
+            writer.Uint(best.number);
+            writer.Key("msg");
+            writeString(writer, "system.interval");
+            writer.Key("txcount");
+            writer.Uint64(tx_count);
+            writer.Key("used_state_cache_size");
+            writer.Uint64(state_size);
+          });
+        });
   }
 
-  std::string TelemetryServiceImpl::systemIntervalMessage2() {
-    rapidjson::Document document;
-    document.SetObject();
-    auto &allocator = document.GetAllocator();
-    auto str_val = [&allocator](const std::string &str) -> rapidjson::Value & {
-      static rapidjson::Value val;
-      val.SetString(str.c_str(),
-                    static_cast<rapidjson::SizeType>(str.length()),
-                    allocator);
-      return val;
-    };
-
-    rapidjson::Value payload(rapidjson::kObjectType);
-
-    rapidjson::Value bandwidth_down, bandwidth_up, peers_count;
+  std::optional<MessageHandle> TelemetryServiceImpl::systemIntervalMessage2(
+      MessagePool::RefCount refs) {
     auto active_peers = peer_manager_->activePeersNumber();
     // we are not actually measuring bandwidth. the following will just let us
     // see the history of active peers count change in the telemetry UI
     auto peers_to_bandwidth = active_peers * 1'000'000;
-    bandwidth_down.SetInt(peers_to_bandwidth);
-    bandwidth_up.SetInt(peers_to_bandwidth);
-    peers_count.SetInt(active_peers);
-
-    // fields order is preserved the same way substrate orders it
-    payload.AddMember("bandwidth_download", bandwidth_down, allocator)
-        .AddMember("bandwidth_upload", bandwidth_up, allocator)
-        .AddMember("msg", str_val("system.interval"), allocator)
-        .AddMember("peers", peers_count, allocator);
-
-    document.AddMember("id", 1, allocator)
-        .AddMember("payload", payload, allocator)
-        .AddMember("ts", str_val(currentTimestamp()), allocator);
-
-    return json2string(document);
+    auto timestamp = currentTimestamp();
+
+    return message_pool_->emplace(
+        refs, [&](MessagePool::RecordStream &stream) {
+          JsonWriter writer{stream};
+          writeMessage(writer, timestamp, [&] {
+            // fields order is preserved the same way substrate orders it
+            writer.Key("bandwidth_download");
+            writer.Uint64(peers_to_bandwidth);
+            writer.Key("bandwidth_upload");
+            writer.Uint64(peers_to_bandwidth);
+            writer.Key("msg");
+            writeString(writer, "system.interval");
+            writer.Key("peers");
+            writer.Uint64(active_peers);
+          });
+        });
   }
 
   void TelemetryServiceImpl::setGenesisBlockHash(
@@ -96,20 +96,26 @@ namespace kagome::telemetry {
     void prepareGreetingMessage();
 
     /**
-     * Produces "block.imported" or "notify.finalized" JSON telemetry messages
+     * Serializes "block.imported" or "notify.finalized" JSON telemetry
+     * messages directly into the message pool
      * @param info - block info to notify about
      * @param origin - if set, then "block.imported" event produced, otherwise
      * "notify.finalized"
-     * @return string with event JSON
+     * @param refs - number of connections to send the message to
+     * @return handle of the message in the pool
      */
-    std::string blockNotification(const primitives::BlockInfo &info,
-                                  std::optional<BlockOrigin> origin);
+    std::optional<MessageHandle> blockNotification(
+        const primitives::BlockInfo &info,
+        std::optional<BlockOrigin> origin,
+        MessagePool::RefCount refs);
 
     /// compose system health notification of the first format
-    std::string systemIntervalMessage1();
+    std::optional<MessageHandle> systemIntervalMessage1(
+        MessagePool::RefCount refs);
 
     /// compose system health notification of the second format
-    std::string systemIntervalMessage2();
+    std::optional<MessageHandle> systemIntervalMessage2(
+        MessagePool::RefCount refs);
 
     /// @return RFC3339 formatted current timestamp string
     std::string currentTimestamp() const;
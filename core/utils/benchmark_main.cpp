@@ -5,6 +5,7 @@
 
 #include "application/impl/app_configuration_impl.hpp"
 #include "benchmark/block_execution_benchmark.hpp"
+#include "benchmark/component_benchmark.hpp"
 #include "injector/application_injector.hpp"
 #include "runtime/runtime_api/impl/core.hpp"
 
@@ -15,7 +16,7 @@ namespace kagome {
     if (argc == 1) {
       SL_ERROR(config_logger,
                "Usage: kagome benchmark BENCHMARK-TYPE BENCHMARK-OPTIONS\n"
-               "Available benchmark types are: block");
+               "Available benchmark types are: block, components");
       return -1;
     }
 
@@ -36,19 +37,30 @@ namespace kagome {
     }
     auto &benchmark_config = *config_opt;
 
-    auto block_benchmark = injector.injectBlockBenchmark();
-
     auto res = visit_in_place(
         benchmark_config,
-        [&block_benchmark](
+        [&injector](
             application::BlockBenchmarkConfig config) -> outcome::result<void> {
+          auto block_benchmark = injector.injectBlockBenchmark();
           benchmark::BlockExecutionBenchmark::Config config_{
               .start = config.from,
               .end = config.to,
               .times = config.times,
+              .trace_dir = std::move(config.trace_dir),
           };
           OUTCOME_TRY(block_benchmark->run(config_));
 
+          return outcome::success();
+        },
+        [&injector](application::ComponentBenchmarkConfig config)
+            -> outcome::result<void> {
+          auto component_benchmark = injector.injectComponentBenchmark();
+          benchmark::ComponentBenchmark::Config config_{
+              .filter = std::move(config.filter),
+              .out = std::move(config.out),
+          };
+          OUTCOME_TRY(component_benchmark->run(config_));
+
           return outcome::success();
         });
 
@@ -14,6 +14,7 @@
 #include "mock/core/runtime/metadata_mock.hpp"
 #include "mock/core/storage/trie/polkadot_trie_cursor_mock.h"
 #include "mock/core/storage/trie/trie_batches_mock.hpp"
+#include "mock/core/storage/trie/trie_snapshot_mock.hpp"
 #include "mock/core/storage/trie/trie_storage_mock.hpp"
 #include "primitives/block_header.hpp"
 #include "testutil/literals.hpp"
@@ -30,6 +31,7 @@ using kagome::runtime::CoreMock;
 using kagome::runtime::MetadataMock;
 using kagome::storage::trie::PolkadotTrieCursorMock;
 using kagome::storage::trie::TrieBatchMock;
+using kagome::storage::trie::TrieSnapshotMock;
 using kagome::storage::trie::TrieStorageMock;
 using testing::_;
 using testing::ElementsAre;
@@ -69,16 +71,18 @@ namespace kagome::api {
 
     EXPECT_CALL(*block_header_repo_, getBlockHeader("D"_hash256))
         .WillOnce(testing::Return(BlockHeader{.state_root = "CDE"_hash256}));
-    EXPECT_CALL(*storage_, getEphemeralBatchAt("CDE"_hash256))
-        .WillOnce(testing::Invoke([](auto &root) {
-          auto batch = std::make_unique<TrieBatchMock>();
-          static const auto key = "a"_buf;
-          static const common::Buffer value{"1"_hash256};
-          EXPECT_CALL(*batch, getMock(key.view()))
-              .WillRepeatedly(testing::Return(value));
-          return batch;
-        }));
-    EXPECT_CALL(*storage_, getEphemeralBatchAt("1"_hash256))
+    auto snapshot = std::make_shared<TrieSnapshotMock>();
+    EXPECT_CALL(*storage_, getSnapshotAt("CDE"_hash256))
+        .WillOnce(Return(snapshot));
+    EXPECT_CALL(*snapshot, batch()).WillOnce(testing::Invoke([]() {
+      auto batch = std::make_unique<TrieBatchMock>();
+      static const auto key = "a"_buf;
+      static const common::Buffer value{"1"_hash256};
+      EXPECT_CALL(*batch, getMock(key.view()))
+          .WillRepeatedly(testing::Return(value));
+      return batch;
+    }));
+    EXPECT_CALL(*snapshot, batchAt("1"_hash256))
         .WillOnce(testing::Invoke([](auto &root) {
           auto batch = std::make_unique<TrieBatchMock>();
           static const auto key = "b"_buf;
@@ -96,16 +100,18 @@ namespace kagome::api {
   TEST_F(ChildStateApiTest, GetStorageAt) {
     EXPECT_CALL(*block_header_repo_, getBlockHeader("B"_hash256))
         .WillOnce(testing::Return(BlockHeader{.state_root = "ABC"_hash256}));
-    EXPECT_CALL(*storage_, getEphemeralBatchAt("ABC"_hash256))
-        .WillOnce(testing::Invoke([](auto &root) {
-          auto batch = std::make_unique<TrieBatchMock>();
-          static const auto key = "c"_buf;
-          static const common::Buffer value{"3"_hash256};
-          EXPECT_CALL(*batch, getMock(key.view()))
-              .WillRepeatedly(testing::Return(value));
-          return batch;
-        }));
-    EXPECT_CALL(*storage_, getEphemeralBatchAt("3"_hash256))
+    auto snapshot = std::make_shared<TrieSnapshotMock>();
+    EXPECT_CALL(*storage_, getSnapshotAt("ABC"_hash256))
+        .WillOnce(Return(snapshot));
+    EXPECT_CALL(*snapshot, batch()).WillOnce(testing::Invoke([]() {
+      auto batch = std::make_unique<TrieBatchMock>();
+      static const auto key = "c"_buf;
+      static const common::Buffer value{"3"_hash256};
+      EXPECT_CALL(*batch, getMock(key.view()))
+          .WillRepeatedly(testing::Return(value));
+      return batch;
+    }));
+    EXPECT_CALL(*snapshot, batchAt("3"_hash256))
         .WillOnce(testing::Invoke([](auto &root) {
           auto batch = std::make_unique<TrieBatchMock>();
           static const auto key = "d"_buf;
@@ -140,14 +146,16 @@ namespace kagome::api {
         .WillOnce(Return(BlockInfo(10, block_hash)));
     EXPECT_CALL(*block_header_repo_, getBlockHeader(block_hash))
         .WillOnce(Return(BlockHeader{.state_root = "6789"_hash256}));
-    EXPECT_CALL(*storage_, getEphemeralBatchAt("6789"_hash256))
-        .WillOnce(testing::Invoke([&](auto &root) {
-          auto batch = std::make_unique<TrieBatchMock>();
-          EXPECT_CALL(*batch, getMock(child_storage_key.view()))
-              .WillOnce(testing::Return(common::Buffer("2020"_hash256)));
-          return batch;
-        }));
-    EXPECT_CALL(*storage_, getEphemeralBatchAt("2020"_hash256))
+    auto snapshot = std::make_shared<TrieSnapshotMock>();
+    EXPECT_CALL(*storage_, getSnapshotAt("6789"_hash256))
+        .WillOnce(Return(snapshot));
+    EXPECT_CALL(*snapshot, batch()).WillOnce(testing::Invoke([&]() {
+      auto batch = std::make_unique<TrieBatchMock>();
+      EXPECT_CALL(*batch, getMock(child_storage_key.view()))
+          .WillOnce(testing::Return(common::Buffer("2020"_hash256)));
+      return batch;
+    }));
+    EXPECT_CALL(*snapshot, batchAt("2020"_hash256))
         .WillOnce(testing::Invoke([&](auto &root) {
           auto batch = std::make_unique<TrieBatchMock>();
           EXPECT_CALL(*batch, trieCursor())
@@ -195,14 +203,16 @@ namespace kagome::api {
         .WillOnce(Return(BlockInfo{10, block_hash}));
     EXPECT_CALL(*block_header_repo_, getBlockHeader(block_hash))
         .WillOnce(Return(BlockHeader{.state_root = "6789"_hash256}));
-    EXPECT_CALL(*storage_, getEphemeralBatchAt("6789"_hash256))
-        .WillOnce(testing::Invoke([&](auto &root) {
-          auto batch = std::make_unique<TrieBatchMock>();
-          EXPECT_CALL(*batch, getMock(child_storage_key.view()))
-              .WillOnce(testing::Return(common::Buffer("2020"_hash256)));
-          return batch;
-        }));
-    EXPECT_CALL(*storage_, getEphemeralBatchAt("2020"_hash256))
+    auto snapshot = std::make_shared<TrieSnapshotMock>();
+    EXPECT_CALL(*storage_, getSnapshotAt("6789"_hash256))
+        .WillOnce(Return(snapshot));
+    EXPECT_CALL(*snapshot, batch()).WillOnce(testing::Invoke([&]() {
+      auto batch = std::make_unique<TrieBatchMock>();
+      EXPECT_CALL(*batch, getMock(child_storage_key.view()))
+          .WillOnce(testing::Return(common::Buffer("2020"_hash256)));
+      return batch;
+    }));
+    EXPECT_CALL(*snapshot, batchAt("2020"_hash256))
         .WillOnce(testing::Invoke([&](auto &root) {
           auto batch = std::make_unique<TrieBatchMock>();
           EXPECT_CALL(*batch, trieCursor())
@@ -247,15 +257,17 @@ namespace kagome::api {
     EXPECT_CALL(*block_header_repo_, getBlockHeader(block_hash))
         .WillOnce(Return(BlockHeader{.state_root = "6789"_hash256}));
     auto batch = std::make_unique<TrieBatchMock>();
-    EXPECT_CALL(*storage_, getEphemeralBatchAt("6789"_hash256))
-        .WillOnce(testing::Invoke([&](auto &root) {
-          auto batch = std::make_unique<TrieBatchMock>();
-          static auto v = common::Buffer("2020"_hash256);
-          EXPECT_CALL(*batch, getMock(child_storage_key.view()))
-              .WillOnce(testing::Return(v));
-          return batch;
-        }));
-    EXPECT_CALL(*storage_, getEphemeralBatchAt("2020"_hash256))
+    auto snapshot = std::make_shared<TrieSnapshotMock>();
+    EXPECT_CALL(*storage_, getSnapshotAt("6789"_hash256))
+        .WillOnce(Return(snapshot));
+    EXPECT_CALL(*snapshot, batch()).WillOnce(testing::Invoke([&]() {
+      auto batch = std::make_unique<TrieBatchMock>();
+      static auto v = common::Buffer("2020"_hash256);
+      EXPECT_CALL(*batch, getMock(child_storage_key.view()))
+          .WillOnce(testing::Return(v));
+      return batch;
+    }));
+    EXPECT_CALL(*snapshot, batchAt("2020"_hash256))
         .WillOnce(testing::Invoke([&](auto &root) {
           auto batch = std::make_unique<TrieBatchMock>();
           EXPECT_CALL(*batch, getMock(key.view()))
@@ -17,6 +17,7 @@
 #include "mock/core/runtime/metadata_mock.hpp"
 #include "mock/core/runtime/raw_executor_mock.hpp"
 #include "mock/core/storage/trie/trie_batches_mock.hpp"
+#include "mock/core/storage/trie/trie_snapshot_mock.hpp"
 #include "mock/core/storage/trie/trie_storage_mock.hpp"
 #include "primitives/block_header.hpp"
 #include "testutil/lazy.hpp"
@@ -35,6 +36,7 @@ using kagome::runtime::CoreMock;
 using kagome::runtime::MetadataMock;
 using kagome::runtime::RawExecutorMock;
 using kagome::storage::trie::TrieBatchMock;
+using kagome::storage::trie::TrieSnapshotMock;
 using kagome::storage::trie::TrieStorageMock;
 using testing::_;
 using testing::ElementsAre;
@@ -84,12 +86,17 @@ namespace kagome::api {
         .WillOnce(testing::Return(BlockHeader{.state_root = "CDE"_hash256}));
     auto in_buf = "a"_buf;
     auto out_buf = "1"_buf;
-    EXPECT_CALL(*storage_, getEphemeralBatchAt(_))
+    EXPECT_CALL(*storage_, getSnapshotAt(_))
         .WillRepeatedly(testing::Invoke([&in_buf, &out_buf](auto &root) {
-          auto batch = std::make_unique<TrieBatchMock>();
-          EXPECT_CALL(*batch, tryGetMock(in_buf.view()))
-              .WillRepeatedly(testing::Return(std::cref(out_buf)));
-          return batch;
+          auto snapshot = std::make_shared<TrieSnapshotMock>();
+          EXPECT_CALL(*snapshot, batch())
+              .WillOnce(testing::Invoke([&in_buf, &out_buf] {
+                auto batch = std::make_unique<TrieBatchMock>();
+                EXPECT_CALL(*batch, tryGetMock(in_buf.view()))
+                    .WillRepeatedly(testing::Return(std::cref(out_buf)));
+                return batch;
+              }));
+          return snapshot;
         }));
 
     auto key = "a"_buf;
@@ -130,15 +137,20 @@ namespace kagome::api {
       EXPECT_CALL(*block_header_repo_, getBlockHeader("D"_hash256))
           .WillOnce(testing::Return(BlockHeader{.state_root = "CDE"_hash256}));
 
-      EXPECT_CALL(*storage, getEphemeralBatchAt(_))
+      EXPECT_CALL(*storage, getSnapshotAt(_))
           .WillRepeatedly(testing::Invoke([this](auto &root) {
-            auto batch = std::make_unique<TrieBatchMock>();
-            EXPECT_CALL(*batch, trieCursor())
-                .WillRepeatedly(testing::Invoke([this]() {
-                  return std::make_unique<
-                      storage::trie::PolkadotTrieCursorDummy>(lex_sorted_vals);
-                }));
-            return batch;
+            auto snapshot = std::make_shared<TrieSnapshotMock>();
+            EXPECT_CALL(*snapshot, batch()).WillOnce(testing::Invoke([this] {
+              auto batch = std::make_unique<TrieBatchMock>();
+              EXPECT_CALL(*batch, trieCursor())
+                  .WillRepeatedly(testing::Invoke([this]() {
+                    return std::make_unique<
+                        storage::trie::PolkadotTrieCursorDummy>(
+                        lex_sorted_vals);
+                  }));
+              return batch;
+            }));
+            return snapshot;
           }));
     }
 
@@ -384,14 +396,19 @@ namespace kagome::api {
       EXPECT_CALL(*block_header_repo_, getBlockHeader(block_hash))
           .WillOnce(testing::Return(
               primitives::BlockHeader{.state_root = state_root}));
-      EXPECT_CALL(*storage_, getEphemeralBatchAt(state_root))
+      EXPECT_CALL(*storage_, getSnapshotAt(state_root))
           .WillOnce(testing::Invoke([&keys](auto &root) {
-            auto batch = std::make_unique<storage::trie::TrieBatchMock>();
-            for (auto &key : keys) {
-              EXPECT_CALL(*batch, tryGetMock(key.view()))
-                  .WillOnce(testing::Return(common::Buffer(root)));
-            }
-            return batch;
+            auto snapshot = std::make_shared<TrieSnapshotMock>();
+            EXPECT_CALL(*snapshot, batch())
+                .WillOnce(testing::Invoke([&keys, root] {
+                  auto batch = std::make_unique<TrieBatchMock>();
+                  for (auto &key : keys) {
+                    EXPECT_CALL(*batch, tryGetMock(key.view()))
+                        .WillOnce(testing::Return(common::Buffer(root)));
+                  }
+                  return batch;
+                }));
+            return snapshot;
           }));
     }
     // WHEN
@@ -455,14 +472,19 @@ namespace kagome::api {
     EXPECT_CALL(*block_header_repo_, getBlockHeader(at))
         .WillOnce(
             testing::Return(primitives::BlockHeader{.state_root = state_root}));
-    EXPECT_CALL(*storage_, getEphemeralBatchAt(state_root))
+    EXPECT_CALL(*storage_, getSnapshotAt(state_root))
         .WillOnce(testing::Invoke([&keys](auto &root) {
-          auto batch = std::make_unique<storage::trie::TrieBatchMock>();
-          for (auto &key : keys) {
-            EXPECT_CALL(*batch, tryGetMock(key.view()))
-                .WillOnce(testing::Return(common::Buffer(root)));
-          }
-          return batch;
+          auto snapshot = std::make_shared<TrieSnapshotMock>();
+          EXPECT_CALL(*snapshot, batch())
+              .WillOnce(testing::Invoke([&keys, root] {
+                auto batch = std::make_unique<TrieBatchMock>();
+                for (auto &key : keys) {
+                  EXPECT_CALL(*batch, tryGetMock(key.view()))
+                      .WillOnce(testing::Return(common::Buffer(root)));
+                }
+                return batch;
+              }));
+          return snapshot;
         }));
 
     // WHEN
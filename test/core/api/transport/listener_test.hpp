@@ -97,6 +97,7 @@ struct ListenerTest : public ::testing::Test {
     service = std::make_shared<ApiServiceImpl>(
         *app_state_manager,
         thread_pool,
+        scheduler,
         std::vector<std::shared_ptr<Listener>>({listener}),
         server,
         std::vector<std::shared_ptr<JRpcProcessor>>(processors),
@@ -129,6 +130,14 @@ struct ListenerTest : public ::testing::Test {
   sptr<kagome::api::RpcThreadPool> thread_pool =
       std::make_shared<kagome::api::RpcThreadPool>(rpc_context, config);
 
+  sptr<kagome::api::RpcRequestScheduler> scheduler =
+      std::make_shared<kagome::api::RpcRequestScheduler>(
+          kagome::api::RpcRequestScheduler::Configuration{
+              .cheap_threads = 1,
+              .runtime_threads = 1,
+              .subscription_threads = 1,
+          });
+
   sptr<ApiStub> api = std::make_shared<ApiStub>();
 
   sptr<JRpcServer> server = std::make_shared<JRpcServerImpl>();
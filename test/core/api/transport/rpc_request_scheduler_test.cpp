@@ -0,0 +1,174 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <future>
+#include <thread>
+
+#include "api/transport/rpc_request_scheduler.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::api::RpcLane;
+using kagome::api::RpcRequestScheduler;
+
+#define REQUEST(method, id) \
+  R"({"jsonrpc":"2.0","method":")" method R"(","id":)" id R"(,"params":[]})"
+
+struct RpcRequestSchedulerTest : ::testing::Test {
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+};
+
+/**
+ * @given requests of different methods
+ * @when classify requests
+ * @then methods are routed to their lanes and ids are preserved
+ */
+TEST_F(RpcRequestSchedulerTest, Classify) {
+  auto cheap = RpcRequestScheduler::classify(REQUEST("chain_getHeader", "1"));
+  EXPECT_EQ(cheap.lane, RpcLane::kCheap);
+  EXPECT_EQ(cheap.id, "1");
+
+  auto runtime = RpcRequestScheduler::classify(REQUEST("state_call", "\"a\""));
+  EXPECT_EQ(runtime.lane, RpcLane::kRuntime);
+  EXPECT_EQ(runtime.id, "\"a\"");
+
+  auto subscription = RpcRequestScheduler::classify(
+      REQUEST("chain_subscribeNewHeads", "2"));
+  EXPECT_EQ(subscription.lane, RpcLane::kSubscription);
+  EXPECT_EQ(subscription.id, "2");
+}
+
+/**
+ * @given batch request
+ * @when classify request
+ * @then batch is routed to the heaviest lane of its requests
+ */
+TEST_F(RpcRequestSchedulerTest, ClassifyBatch) {
+  auto batch = RpcRequestScheduler::classify(
+      "[" REQUEST("chain_getHeader", "1") "," REQUEST("state_call", "2") "]");
+  EXPECT_EQ(batch.lane, RpcLane::kRuntime);
+  EXPECT_TRUE(batch.id.empty());
+}
+
+/**
+ * @given scheduler with limit of one request per session
+ * @when session sends second request while first one is running
+ * @then second request is rejected with error response of its id
+ */
+TEST_F(RpcRequestSchedulerTest, SessionLimit) {
+  RpcRequestScheduler scheduler{RpcRequestScheduler::Configuration{
+      .cheap_threads = 1,
+      .runtime_threads = 1,
+      .subscription_threads = 1,
+      .max_session_requests = 1,
+  }};
+  scheduler.start();
+
+  std::promise<void> running, release, done;
+  scheduler.schedule(
+      1,
+      REQUEST("chain_getHeader", "1"),
+      [&] {
+        running.set_value();
+        release.get_future().wait();
+        done.set_value();
+      },
+      [](std::string_view) { FAIL(); });
+  running.get_future().wait();
+  EXPECT_EQ(scheduler.sessionRequests(1), 1);
+
+  std::string rejected;
+  scheduler.schedule(
+      1,
+      REQUEST("chain_getHeader", "2"),
+      [] { FAIL(); },
+      [&](std::string_view response) { rejected = response; });
+  EXPECT_EQ(rejected,
+            R"({"jsonrpc":"2.0","id":2,"error":)"
+            R"({"code":-32000,"message":"Too many concurrent requests"}})");
+
+  // other sessions are not limited
+  std::promise<void> other;
+  scheduler.schedule(
+      2,
+      REQUEST("state_call", "3"),
+      [&] { other.set_value(); },
+      [](std::string_view) { FAIL(); });
+  other.get_future().wait();
+
+  release.set_value();
+  done.get_future().wait();
+  scheduler.stop();
+  EXPECT_EQ(scheduler.sessionRequests(1), 0);
+}
+
+/**
+ * @given scheduler with zero queue deadline
+ * @when request is dequeued
+ * @then request is rejected instead of execution
+ */
+TEST_F(RpcRequestSchedulerTest, Deadline) {
+  RpcRequestScheduler scheduler{RpcRequestScheduler::Configuration{
+      .cheap_threads = 1,
+      .runtime_threads = 1,
+      .subscription_threads = 1,
+      .runtime_deadline = std::chrono::milliseconds{-1},
+  }};
+  scheduler.start();
+
+  std::promise<std::string> rejected;
+  scheduler.schedule(
+      1,
+      REQUEST("state_call", "1"),
+      [] { FAIL(); },
+      [&](std::string_view response) {
+        rejected.set_value(std::string{response});
+      });
+  EXPECT_EQ(rejected.get_future().get(),
+            R"({"jsonrpc":"2.0","id":1,"error":)"
+            R"({"code":-32000,"message":"Request deadline exceeded"}})");
+  scheduler.stop();
+}
+
+/**
+ * @given request queued behind running request of the same session
+ * @when scheduler is stopped
+ * @then queued request is dropped and released from session limit
+ */
+TEST_F(RpcRequestSchedulerTest, StopReleasesQueued) {
+  RpcRequestScheduler scheduler{RpcRequestScheduler::Configuration{
+      .cheap_threads = 1,
+      .runtime_threads = 1,
+      .subscription_threads = 1,
+  }};
+  scheduler.start();
+
+  std::promise<void> running;
+  scheduler.schedule(
+      1,
+      REQUEST("chain_getHeader", "1"),
+      [&] {
+        running.set_value();
+        // finish only after stop marked scheduler stopped, so the queued
+        // request is dropped instead of executed
+        while (scheduler.isStarted()) {
+          std::this_thread::yield();
+        }
+      },
+      [](std::string_view) { FAIL(); });
+  running.get_future().wait();
+  scheduler.schedule(
+      1,
+      REQUEST("chain_getHeader", "2"),
+      [] { FAIL(); },
+      [](std::string_view) { FAIL(); });
+  EXPECT_EQ(scheduler.sessionRequests(1), 2);
+
+  scheduler.stop();
+  EXPECT_EQ(scheduler.sessionRequests(1), 0);
+}
@@ -0,0 +1,44 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/lru_set.hpp"
+
+#include <gtest/gtest.h>
+
+using kagome::common::LruSet;
+
+/**
+ * @given set of capacity 2
+ * @when values are added above the capacity
+ * @then the least recently added value is evicted
+ */
+TEST(LruSet, EvictsLeastRecent) {
+  LruSet<int> set{2};
+  EXPECT_TRUE(set.add(1));
+  EXPECT_TRUE(set.add(2));
+  EXPECT_TRUE(set.add(3));
+
+  EXPECT_EQ(set.size(), 2);
+  EXPECT_FALSE(set.contains(1));
+  EXPECT_TRUE(set.contains(2));
+  EXPECT_TRUE(set.contains(3));
+}
+
+/**
+ * @given full set
+ * @when present value is added again
+ * @then it is not added, but becomes the most recent one
+ */
+TEST(LruSet, AddRefreshes) {
+  LruSet<int> set{2};
+  set.add(1);
+  set.add(2);
+  EXPECT_FALSE(set.add(1));
+  set.add(3);
+
+  EXPECT_TRUE(set.contains(1));
+  EXPECT_FALSE(set.contains(2));
+  EXPECT_TRUE(set.contains(3));
+}
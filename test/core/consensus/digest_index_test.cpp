@@ -0,0 +1,115 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/digest_index.hpp"
+
+#include <gtest/gtest.h>
+
+#include "testutil/literals.hpp"
+#include "testutil/outcome.hpp"
+#include "testutil/prepare_loggers.hpp"
+#include "testutil/storage/base_rocksdb_test.hpp"
+
+using kagome::common::Buffer;
+using kagome::consensus::DigestIndex;
+using kagome::primitives::BlockHash;
+using kagome::primitives::BlockInfo;
+
+struct DigestIndexTest : public test::BaseRocksDB_Test {
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  DigestIndexTest() : test::BaseRocksDB_Test("/tmp/kagome_digest_index_test") {}
+
+  std::unique_ptr<DigestIndex> makeIndex() {
+    return std::make_unique<DigestIndex>(prefix_, db_);
+  }
+
+  Buffer prefix_ = Buffer::fromString(":test:digests:");
+};
+
+/**
+ * @given new index
+ * @when it is initialized at some best block
+ * @then blocks are indexed since the next block, even after reopening
+ */
+TEST_F(DigestIndexTest, IndexedSinceNextToBest) {
+  auto index = makeIndex();
+  EXPECT_FALSE(index->indexedSince());
+  EXPECT_OUTCOME_TRUE_1(index->init(10));
+  EXPECT_EQ(index->indexedSince(), 11);
+  index->stop();
+
+  auto reopened = makeIndex();
+  EXPECT_OUTCOME_TRUE_1(reopened->init(20));
+  EXPECT_EQ(reopened->indexedSince(), 11);
+}
+
+/**
+ * @given index, which was not stopped, as on crash
+ * @when it is reopened
+ * @then index is started anew, because background writes may be lost
+ */
+TEST_F(DigestIndexTest, RestartAfterCrash) {
+  auto index = makeIndex();
+  EXPECT_OUTCOME_TRUE_1(index->init(10));
+  index->add({15, "b15"_hash256});
+  index.reset();
+
+  auto reopened = makeIndex();
+  EXPECT_OUTCOME_TRUE_1(reopened->init(20));
+  EXPECT_EQ(reopened->indexedSince(), 21);
+}
+
+/**
+ * @given index with blocks of different numbers, including forks
+ * @when blocks of range are requested
+ * @then only blocks of range are returned in order of numbers
+ */
+TEST_F(DigestIndexTest, GetRange) {
+  auto index = makeIndex();
+  EXPECT_OUTCOME_TRUE_1(index->init(0));
+  BlockInfo b5{5, "b5"_hash256};
+  BlockInfo b7{7, "b7"_hash256};
+  BlockInfo b7_fork{7, "b7_fork"_hash256};
+  BlockInfo b300{300, "b300"_hash256};
+  for (auto &block : {b300, b7, b5, b7_fork}) {
+    index->add(block);
+  }
+  // entries are written in background
+  index->stop();
+  // other entries under the same storage must not be affected
+  EXPECT_OUTCOME_TRUE_1(db_->put(Buffer::fromString(":test:digests;"), Buffer{}));
+
+  EXPECT_OUTCOME_TRUE(all, index->get(0, 1000));
+  ASSERT_EQ(all.size(), 4);
+  EXPECT_EQ(all[0], b5);
+  EXPECT_EQ(all[1].number, 7);
+  EXPECT_EQ(all[2].number, 7);
+  EXPECT_EQ(all[3], b300);
+
+  EXPECT_OUTCOME_TRUE(middle, index->get(6, 299));
+  ASSERT_EQ(middle.size(), 2);
+  EXPECT_EQ(middle[0].number, 7);
+  EXPECT_EQ(middle[1].number, 7);
+
+  EXPECT_OUTCOME_TRUE(none, index->get(8, 299));
+  EXPECT_TRUE(none.empty());
+}
+
+/**
+ * @given index, which is not initialized
+ * @when blocks are added
+ * @then nothing is indexed
+ */
+TEST_F(DigestIndexTest, NotInitialized) {
+  auto index = makeIndex();
+  index->add({5, "b5"_hash256});
+  EXPECT_OUTCOME_TRUE_1(index->init(0));
+  index->stop();
+  EXPECT_OUTCOME_TRUE(blocks, index->get(0, 10));
+  EXPECT_TRUE(blocks.empty());
+}
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include <stdio.h>
 
+#include <vector>
+
 #include "crypto/blake2/blake2b.h"
 #include "crypto/blake2/blake2s.h"
 #include "testutil/literals.hpp"
@@ -118,3 +120,39 @@ TEST(Blake2s, UnkeyedInit) {
 
   EXPECT_EQ(memcmp(out1, out2, 32), 0) << "hashes are different";
 }
+
+/**
+ * @given messages of different lengths, including empty and multiple of
+ * block size
+ * @when hash them together
+ * @then digests are the same as ones of messages hashed one by one
+ */
+TEST(Blake2b, Multi) {
+  for (size_t count : {1, 2, 3, 4, 5, 8, 9, 17}) {
+    std::vector<std::vector<uint8_t>> messages(count);
+    std::vector<const void *> in;
+    std::vector<size_t> inlen;
+    for (size_t i = 0; i < count; ++i) {
+      auto size = (i * 61) % 400;
+      if (i % 3 == 0) {
+        size = 128 * (i % 4);
+      }
+      messages[i].resize(size);
+      selftest_seq(messages[i].data(), size, i);
+      in.emplace_back(messages[i].data());
+      inlen.emplace_back(size);
+    }
+
+    std::vector<uint8_t> digests(count * 32);
+    ASSERT_EQ(kagome::crypto::blake2b_multi(
+                  digests.data(), 32, in.data(), inlen.data(), count),
+              0);
+
+    for (size_t i = 0; i < count; ++i) {
+      uint8_t md[32];
+      kagome::crypto::blake2b(md, 32, nullptr, 0, in[i], inlen[i]);
+      EXPECT_EQ(memcmp(md, digests.data() + i * 32, 32), 0)
+          << "message " << i << " of " << count;
+    }
+  }
+}
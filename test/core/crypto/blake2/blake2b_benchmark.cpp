@@ -0,0 +1,58 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "crypto/blake2/blake2b.h"
+
+/**
+ * BLAKE2b-256 of messages shaped like trie nodes (tens to hundreds of
+ * bytes) and runtime code, one by one and several at once.
+ * Usage: blake2b_benchmark [--benchmark_filter=<regex>]
+ */
+
+namespace {
+  std::vector<uint8_t> message(size_t size) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i) {
+      data[i] = static_cast<uint8_t>(i * 31);
+    }
+    return data;
+  }
+
+  void single(benchmark::State &state) {
+    auto data = message(state.range(0));
+    uint8_t out[32];
+    for (auto _ : state) {
+      kagome::crypto::blake2b(out, 32, nullptr, 0, data.data(), data.size());
+      benchmark::DoNotOptimize(out);
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  /// range(0) - message size, range(1) - number of messages
+  void multi(benchmark::State &state) {
+    auto data = message(state.range(0));
+    const auto count = static_cast<size_t>(state.range(1));
+    std::vector<const void *> in(count, data.data());
+    std::vector<size_t> inlen(count, data.size());
+    std::vector<uint8_t> out(count * 32);
+    for (auto _ : state) {
+      kagome::crypto::blake2b_multi(
+          out.data(), 32, in.data(), inlen.data(), count);
+      benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(state.iterations() * count * data.size());
+    state.SetItemsProcessed(state.iterations() * count);
+  }
+}  // namespace
+
+BENCHMARK(single)->Arg(32)->Arg(100)->Arg(500)->Arg(4096)->Arg(1 << 20);
+BENCHMARK(multi)->ArgsProduct({{32, 100, 500, 4096}, {2, 4, 8, 16}});
+
+BENCHMARK_MAIN();
@@ -0,0 +1,69 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <xxhash/xxhash.h>
+
+#include "crypto/twox/twox.hpp"
+
+/**
+ * Compares single-pass twox hashes with separate XXH64 call per seed.
+ * Usage: twox_benchmark [--benchmark_filter=<regex>]
+ */
+
+namespace {
+  std::vector<uint8_t> input(benchmark::State &state) {
+    std::vector<uint8_t> input(state.range(0));
+    for (size_t i = 0; i < input.size(); ++i) {
+      input[i] = static_cast<uint8_t>(i * 131 + 7);
+    }
+    return input;
+  }
+
+  template <size_t Seeds>
+  void xxh64PerSeed(benchmark::State &state) {
+    auto data = input(state);
+    uint64_t out[Seeds];
+    for (auto _ : state) {
+      for (size_t seed = 0; seed < Seeds; ++seed) {
+        out[seed] = XXH64(data.data(), data.size(), seed);
+      }
+      benchmark::DoNotOptimize(out);
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+  }
+
+  void twox128(benchmark::State &state) {
+    auto data = input(state);
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(kagome::crypto::make_twox128(data));
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+  }
+
+  void twox256(benchmark::State &state) {
+    auto data = input(state);
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(kagome::crypto::make_twox256(data));
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+  }
+
+  // storage key prefixes, short keys, trie nodes and runtime sized blobs
+  void lengths(benchmark::internal::Benchmark *benchmark) {
+    for (auto len : {5, 16, 32, 48, 64, 1024, 64 * 1024}) {
+      benchmark->Arg(len);
+    }
+  }
+}  // namespace
+
+BENCHMARK(xxh64PerSeed<2>)->Apply(lengths);
+BENCHMARK(twox128)->Apply(lengths);
+BENCHMARK(xxh64PerSeed<4>)->Apply(lengths);
+BENCHMARK(twox256)->Apply(lengths);
+
+BENCHMARK_MAIN();
@@ -5,8 +5,12 @@
 
 #include "crypto/twox/twox.hpp"
 
+#include <cstring>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <xxhash/xxhash.h>
 #include "testutil/literals.hpp"
 
 using kagome::common::Buffer;
@@ -55,3 +59,27 @@ TEST(Twox256, Correctness) {
     ASSERT_THAT(hash, ::testing::ElementsAreArray(reference));
   }
 }
+
+/**
+ * @given inputs of lengths covering every tail and stripe combination
+ * @when calling make_twox128 and make_twox256
+ * @then results are XXH64 of the input with seeds 0..1 and 0..3
+ */
+TEST(Twox, MatchesXxh64) {
+  std::vector<uint8_t> input;
+  for (size_t len = 0; len < 300; ++len) {
+    auto hash128 = make_twox128(input);
+    auto hash256 = make_twox256(input);
+    for (uint64_t seed = 0; seed < 4; ++seed) {
+      auto expected = XXH64(input.data(), input.size(), seed);
+      uint64_t actual = 0;
+      if (seed < 2) {
+        memcpy(&actual, hash128.data() + seed * 8, 8);
+        EXPECT_EQ(actual, expected) << "twox128, length " << len;
+      }
+      memcpy(&actual, hash256.data() + seed * 8, 8);
+      EXPECT_EQ(actual, expected) << "twox256, length " << len;
+    }
+    input.push_back(static_cast<uint8_t>(len * 131 + 7));
+  }
+}
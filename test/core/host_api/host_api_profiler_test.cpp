@@ -0,0 +1,125 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+
+#include "host_api/host_api_profiler.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::host_api::HostApiProfiler;
+using kagome::primitives::BlockInfo;
+
+namespace fs = kagome::filesystem;
+
+/**
+ * @given enabled profiler with dump directory
+ * @when host api calls are made during block execution
+ * @then calls, bytes and time of the block are dumped as json and folded stacks
+ */
+TEST(HostApiProfilerTest, DumpBlock) {
+  testutil::prepareLoggers();
+  auto dir = fs::temp_directory_path() / fs::unique_path();
+  HostApiProfiler::enable(dir);
+
+  auto id = HostApiProfiler::registerFunction("ext_test_version_1");
+  EXPECT_EQ(HostApiProfiler::registerFunction("ext_test_version_1"), id);
+  EXPECT_EQ(HostApiProfiler::spanSize((5ull << 32) | 100), 5);
+
+  BlockInfo block{1, "block"_hash256};
+  {
+    HostApiProfiler::BlockScope scope{block};
+    {
+      HostApiProfiler::Call call{id, 5};
+      call.addBytes(2);
+    }
+    HostApiProfiler::Call call{id, 5};
+  }
+  // calls outside of block are not dumped
+  HostApiProfiler::Call call{id, 5};
+
+  auto name = "1_" + block.hash.toHex();
+  std::ifstream json_file{dir / (name + ".json")};
+  ASSERT_TRUE(json_file);
+  std::stringstream json;
+  json << json_file.rdbuf();
+  EXPECT_NE(json.str().find(
+                R"({"function":"ext_test_version_1","calls":2,"time_ns":)"),
+            std::string::npos);
+  EXPECT_NE(json.str().find(R"("bytes":12})"), std::string::npos);
+
+  std::ifstream folded_file{dir / (name + ".folded")};
+  std::string line;
+  ASSERT_TRUE(std::getline(folded_file, line));
+  EXPECT_EQ(line.rfind("block_1;host_api;ext_test_version_1 ", 0), 0);
+
+  fs::remove_all(dir);
+}
+
+/**
+ * @given enabled profiler
+ * @when host api calls are made in scope of block, which is not dumped
+ * @then calls of the block are available in memory and no files are written
+ */
+TEST(HostApiProfilerTest, CollectWithoutDump) {
+  testutil::prepareLoggers();
+  auto dir = fs::temp_directory_path() / fs::unique_path();
+  HostApiProfiler::enable(dir);
+
+  auto first = HostApiProfiler::registerFunction("ext_first_version_1");
+  auto second = HostApiProfiler::registerFunction("ext_second_version_1");
+
+  BlockInfo block{2, "block"_hash256};
+  {
+    HostApiProfiler::BlockScope scope{block, false};
+    { HostApiProfiler::Call call{first, 1}; }
+    { HostApiProfiler::Call call{second, 2}; }
+    { HostApiProfiler::Call call{second, 3}; }
+
+    auto stats = scope.stats();
+    ASSERT_EQ(stats.size(), 2);
+    for (auto &function : stats) {
+      if (function.function == "ext_first_version_1") {
+        EXPECT_EQ(function.calls, 1);
+        EXPECT_EQ(function.bytes, 1);
+      } else {
+        EXPECT_EQ(function.function, "ext_second_version_1");
+        EXPECT_EQ(function.calls, 2);
+        EXPECT_EQ(function.bytes, 5);
+      }
+    }
+    EXPECT_GE(stats.front().nanoseconds, stats.back().nanoseconds);
+  }
+
+  EXPECT_FALSE(fs::exists(dir / ("2_" + block.hash.toHex() + ".json")));
+  fs::remove_all(dir);
+}
+
+/**
+ * @given host api functions passing plain numbers as i64 values
+ * @when bytes of their arguments and results are counted
+ * @then numbers are not treated as spans, while spans of other functions are
+ */
+TEST(HostApiProfilerTest, NonSpanValues) {
+  constexpr uint64_t value = (5ull << 32) | 100;
+
+  auto print_num = HostApiProfiler::spanLayout("ext_misc_print_num_version_1");
+  EXPECT_EQ(print_num.argBytes(0, value), 0);
+
+  auto sleep_until =
+      HostApiProfiler::spanLayout("ext_offchain_sleep_until_version_1");
+  EXPECT_EQ(sleep_until.argBytes(0, value), 0);
+
+  auto timestamp =
+      HostApiProfiler::spanLayout("ext_offchain_timestamp_version_1");
+  EXPECT_EQ(timestamp.resultBytes(value), 0);
+
+  auto storage_get = HostApiProfiler::spanLayout("ext_storage_get_version_1");
+  EXPECT_EQ(storage_get.argBytes(0, value), 5);
+  EXPECT_EQ(storage_get.resultBytes(value), 5);
+}
@@ -0,0 +1,179 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <random>
+
+#include <benchmark/benchmark.h>
+#include <gmock/gmock.h>
+#include <scale/scale.hpp>
+
+#include "host_api/impl/storage_extension.hpp"
+#include "mock/core/runtime/memory_mock.hpp"
+#include "mock/core/runtime/memory_provider_mock.hpp"
+#include "runtime/common/trie_storage_provider_impl.hpp"
+#include "runtime/ptr_size.hpp"
+#include "storage/in_memory/in_memory_storage.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/impl/trie_storage_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+/**
+ * Compares iteration of the storage through ext_storage_next_key_version_1
+ * with seeking a new cursor for every key, as the runtime iterating a
+ * storage map does.
+ * Usage: storage_extension_benchmark [--benchmark_filter=<regex>]
+ */
+
+using kagome::common::Buffer;
+using kagome::host_api::StorageExtension;
+using kagome::runtime::Memory;
+using kagome::runtime::MemoryMock;
+using kagome::runtime::MemoryProviderMock;
+using kagome::runtime::PtrSize;
+using kagome::runtime::TrieStorageProviderImpl;
+using kagome::runtime::WasmSpan;
+using kagome::storage::InMemoryStorage;
+using kagome::storage::trie::PolkadotCodec;
+using kagome::storage::trie::PolkadotTrieFactoryImpl;
+using kagome::storage::trie::StateVersion;
+using kagome::storage::trie::TrieSerializerImpl;
+using kagome::storage::trie::TrieStorageBackendImpl;
+using kagome::storage::trie::TrieStorageImpl;
+using testing::_;
+using testing::Invoke;
+using testing::InvokeWithoutArgs;
+using testing::NiceMock;
+using testing::Return;
+
+namespace {
+  constexpr size_t kEntries = 100'000;
+
+  Buffer randomBuffer(std::mt19937_64 &rng, size_t size) {
+    Buffer buffer(size, 0);
+    for (auto &byte : buffer) {
+      byte = static_cast<uint8_t>(rng());
+    }
+    return buffer;
+  }
+
+  struct Fixture {
+    std::shared_ptr<TrieStorageProviderImpl> storage_provider;
+    std::shared_ptr<NiceMock<MemoryMock>> memory;
+    std::shared_ptr<NiceMock<MemoryProviderMock>> memory_provider;
+    std::shared_ptr<StorageExtension> extension;
+    /// key passed to and returned from host api
+    Buffer key;
+    std::optional<Buffer> next_key;
+  };
+
+  /// state is filled once and shared by benchmarks
+  Fixture &fixture() {
+    static Fixture instance;
+    if (instance.extension != nullptr) {
+      return instance;
+    }
+
+    auto factory = std::make_shared<PolkadotTrieFactoryImpl>();
+    auto codec = std::make_shared<PolkadotCodec>();
+    auto serializer = std::make_shared<TrieSerializerImpl>(
+        factory,
+        codec,
+        std::make_shared<TrieStorageBackendImpl>(
+            std::make_shared<InMemoryStorage>()));
+    std::shared_ptr storage =
+        TrieStorageImpl::createEmpty(factory, codec, serializer).value();
+
+    std::mt19937_64 rng{0};
+    auto batch =
+        storage
+            ->getPersistentBatchAt(serializer->getEmptyRootHash(), std::nullopt)
+            .value();
+    for (size_t i = 0; i < kEntries; ++i) {
+      batch->put(randomBuffer(rng, 48), randomBuffer(rng, 32)).value();
+    }
+    auto root = batch->commit(StateVersion::V0).value();
+
+    instance.storage_provider =
+        std::make_shared<TrieStorageProviderImpl>(storage, serializer);
+    instance.storage_provider->setToEphemeralAt(root).value();
+
+    instance.memory = std::make_shared<NiceMock<MemoryMock>>();
+    ON_CALL(*instance.memory, loadN(_, _))
+        .WillByDefault(
+            InvokeWithoutArgs([] { return instance.key.view(); }));
+    ON_CALL(*instance.memory, storeBuffer(_))
+        .WillByDefault(Invoke([](auto &&buffer) -> WasmSpan {
+          instance.next_key =
+              scale::decode<std::optional<Buffer>>(buffer).value();
+          return 0;
+        }));
+    instance.memory_provider = std::make_shared<NiceMock<MemoryProviderMock>>();
+    ON_CALL(*instance.memory_provider, getCurrentMemory())
+        .WillByDefault(Return(
+            std::optional<std::reference_wrapper<Memory>>(*instance.memory)));
+
+    instance.extension = std::make_shared<StorageExtension>(
+        instance.storage_provider, instance.memory_provider);
+    return instance;
+  }
+
+  /// iterates whole state through host api
+  void hostApiNextKey(benchmark::State &state) {
+    auto &f = fixture();
+    int64_t count = 0;
+    for (auto _ : state) {
+      f.key.clear();
+      while (true) {
+        f.extension->ext_storage_next_key_version_1(
+            PtrSize{0, static_cast<uint32_t>(f.key.size())}.combine());
+        if (not f.next_key) {
+          break;
+        }
+        f.key = std::move(*f.next_key);
+        ++count;
+      }
+    }
+    state.SetItemsProcessed(count);
+  }
+
+  /// iterates whole state seeking a new cursor for every key
+  void seekNextKey(benchmark::State &state) {
+    auto &f = fixture();
+    auto batch = f.storage_provider->getCurrentBatch();
+    int64_t count = 0;
+    for (auto _ : state) {
+      Buffer key;
+      while (true) {
+        auto cursor = batch->trieCursor();
+        cursor->seekUpperBound(key).value();
+        auto next_key = cursor->key();
+        if (not next_key) {
+          break;
+        }
+        key = std::move(*next_key);
+        ++count;
+      }
+    }
+    state.SetItemsProcessed(count);
+  }
+}  // namespace
+
+int main(int argc, char **argv) {
+  testutil::prepareLoggers(soralog::Level::WARN);
+  fixture();
+
+  benchmark::RegisterBenchmark("host_api_next_key", hostApiNextKey)
+      ->Unit(benchmark::kMillisecond);
+  benchmark::RegisterBenchmark("seek_next_key", seekNextKey)
+      ->Unit(benchmark::kMillisecond);
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
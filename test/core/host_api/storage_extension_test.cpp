@@ -260,6 +260,55 @@ TEST_F(StorageExtensionTest, NextKeyEmptyTrie) {
       PtrSize{key_pointer, key_size}.combine());
 }
 
+/**
+ * @given runtime iterating storage with ext_storage_next_key_version_1
+ * @when next key is requested for the previous result @and then after a write
+ * @then the cursor is advanced in place @and is sought again after the write
+ */
+TEST_F(StorageExtensionTest, NextKeyContinuesCursor) {
+  Buffer key(8, 'a');
+  Buffer next_key(8, 'b');
+  Buffer last_key(8, 'c');
+  PtrSize key_span{43, 8};
+  PtrSize next_key_span{44, 8};
+  PtrSize value_span{45, 1};
+
+  EXPECT_CALL(*memory_, loadN(key_span.ptr, key_span.size))
+      .WillRepeatedly(Return(key));
+  EXPECT_CALL(*memory_, loadN(next_key_span.ptr, next_key_span.size))
+      .WillRepeatedly(Return(next_key));
+  EXPECT_CALL(*memory_, loadN(value_span.ptr, value_span.size))
+      .WillRepeatedly(Return(Buffer{1}));
+  EXPECT_CALL(*memory_, storeBuffer(_)).WillRepeatedly(Return(0));
+
+  EXPECT_CALL(*trie_batch_, trieCursor())
+      .WillOnce(Invoke([&]() {
+        auto cursor = std::make_unique<PolkadotTrieCursorMock>();
+        EXPECT_CALL(*cursor, seekUpperBound(key.view()))
+            .WillOnce(Return(outcome::success()));
+        EXPECT_CALL(*cursor, next()).WillOnce(Return(outcome::success()));
+        EXPECT_CALL(*cursor, key())
+            .WillOnce(Return(next_key))
+            .WillOnce(Return(last_key));
+        return cursor;
+      }))
+      .WillOnce(Invoke([&]() {
+        auto cursor = std::make_unique<PolkadotTrieCursorMock>();
+        EXPECT_CALL(*cursor, seekUpperBound(next_key.view()))
+            .WillOnce(Return(outcome::success()));
+        EXPECT_CALL(*cursor, key()).WillOnce(Return(last_key));
+        return cursor;
+      }));
+  EXPECT_CALL(*trie_batch_, put(key.view(), _))
+      .WillOnce(Return(outcome::success()));
+
+  storage_extension_->ext_storage_next_key_version_1(key_span.combine());
+  storage_extension_->ext_storage_next_key_version_1(next_key_span.combine());
+  storage_extension_->ext_storage_set_version_1(key_span.combine(),
+                                                value_span.combine());
+  storage_extension_->ext_storage_next_key_version_1(next_key_span.combine());
+}
+
 /**
  * @given key_pointer, key_size, value_ptr, value_size
  * @when ext_set_storage is invoked on given key and value
@@ -82,6 +82,27 @@ TEST_F(CounterTest, IncNegativeValue) {
   EXPECT_DOUBLE_EQ(getMetric(counter).counter.value, 5.0);
 }
 
+/**
+ * @given prev registry
+ * @when incrementing a counter from several threads
+ * @then all increments are collected
+ */
+TEST_F(CounterTest, IncConcurrent) {
+  auto counter = createCounter("counter6");
+  std::vector<std::thread> threads;
+  for (auto i = 0; i < 4; ++i) {
+    threads.emplace_back([counter] {
+      for (auto j = 0; j < 1000; ++j) {
+        counter->inc();
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_DOUBLE_EQ(getMetric(counter).counter.value, 4000.0);
+}
+
 class GaugeTest : public ::testing::Test {
   kagome::metrics::RegistryPtr registry_;
 
@@ -339,6 +360,32 @@ TEST_F(HistogramTest, SumCanGoDown) {
   EXPECT_LT(histogram2.sample_sum, histogram1.sample_sum);
 }
 
+/**
+ * @given prev registry
+ * @when observing values from several threads
+ * @then all observations are collected in their buckets
+ */
+TEST_F(HistogramTest, ObserveConcurrent) {
+  auto histogram = createHistogram("histogram9", {1, 2});
+  std::vector<std::thread> threads;
+  for (auto i = 0; i < 4; ++i) {
+    threads.emplace_back([histogram] {
+      for (auto j = 0; j < 1000; ++j) {
+        histogram->observe(j % 2 == 0 ? 0.5 : 1.5);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  auto h = getMetric(histogram).histogram;
+  EXPECT_EQ(h.sample_count, 4000U);
+  EXPECT_DOUBLE_EQ(h.sample_sum, 4000.0);
+  ASSERT_EQ(h.bucket.size(), 3U);
+  EXPECT_EQ(h.bucket.at(0).cumulative_count, 2000U);
+  EXPECT_EQ(h.bucket.at(1).cumulative_count, 4000U);
+}
+
 class SummaryTest : public ::testing::Test {
   kagome::metrics::RegistryPtr registry_;
 
@@ -0,0 +1,163 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/protocols/propagate_transactions_protocol.hpp"
+
+#include <gtest/gtest.h>
+#include <mock/libp2p/basic/scheduler_mock.hpp>
+
+#include "blockchain/genesis_block_hash.hpp"
+#include "mock/core/application/app_configuration_mock.hpp"
+#include "mock/core/application/chain_spec_mock.hpp"
+#include "mock/core/blockchain/block_tree_mock.hpp"
+#include "mock/core/crypto/hasher_mock.hpp"
+#include "mock/core/network/extrinsic_observer_mock.hpp"
+#include "mock/core/network/protocols/sync_protocol_mock.hpp"
+#include "mock/core/network/reputation_repository_mock.hpp"
+#include "mock/libp2p/connection/stream_mock.hpp"
+#include "mock/libp2p/host/host_mock.hpp"
+#include "network/impl/stream_engine.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/outcome.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::application::AppConfigurationMock;
+using kagome::application::ChainSpecMock;
+using kagome::blockchain::BlockTreeMock;
+using kagome::blockchain::GenesisBlockHash;
+using kagome::crypto::HasherMock;
+using kagome::network::ExtrinsicObserverMock;
+using kagome::network::PropagateTransactionsProtocol;
+using kagome::network::ProtocolBase;
+using kagome::network::ReputationRepositoryMock;
+using kagome::network::StreamEngine;
+using kagome::network::SyncProtocolMock;
+using kagome::primitives::Transaction;
+using kagome::primitives::events::BroadcastEventParams;
+using kagome::primitives::events::ExtrinsicEventSubscriber;
+using kagome::primitives::events::ExtrinsicLifecycleEvent;
+using kagome::primitives::events::ExtrinsicSubscriptionEngine;
+using kagome::primitives::events::SubscribedExtrinsicId;
+using kagome::subscription::ExtrinsicEventKeyRepository;
+using kagome::subscription::SubscriptionSetId;
+using libp2p::HostMock;
+using libp2p::basic::Scheduler;
+using libp2p::basic::SchedulerMock;
+using libp2p::connection::StreamMock;
+using libp2p::peer::PeerId;
+using testing::_;
+using testing::Return;
+using testing::ReturnRef;
+using testing::SaveArg;
+
+class PropagateTransactionsProtocolTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    EXPECT_CALL(chain_spec_, protocolId())
+        .WillRepeatedly(ReturnRef(protocol_id_));
+    EXPECT_CALL(*block_tree_, getGenesisBlockHash())
+        .WillRepeatedly(ReturnRef(genesis_hash_));
+    EXPECT_CALL(*scheduler_, scheduleImplMockCall(_, _, _))
+        .WillRepeatedly(SaveArg<0>(&send_batch_));
+    EXPECT_CALL(*other_protocol_, protocolName())
+        .WillRepeatedly(ReturnRef(other_protocol_name_));
+
+    stream_engine_ = std::make_shared<StreamEngine>(
+        std::make_shared<ReputationRepositoryMock>());
+    protocol_ = std::make_shared<PropagateTransactionsProtocol>(
+        host_,
+        app_config_,
+        chain_spec_,
+        GenesisBlockHash{block_tree_},
+        nullptr,
+        std::make_shared<ExtrinsicObserverMock>(),
+        stream_engine_,
+        ext_events_engine_,
+        ext_event_key_repo_,
+        std::make_shared<HasherMock>(),
+        scheduler_);
+
+    tx_.ext.data = kagome::common::Buffer::fromString("extrinsic");
+    tx_.hash = "tx_hash"_hash256;
+    subscriber_ = std::make_shared<ExtrinsicEventSubscriber>(ext_events_engine_,
+                                                             nullptr);
+    subscriber_->subscribe(subscriber_->generateSubscriptionSetId(),
+                           ext_event_key_repo_->add(tx_.hash));
+    subscriber_->setCallback([this](SubscriptionSetId,
+                                    auto &&,
+                                    const SubscribedExtrinsicId &,
+                                    const ExtrinsicLifecycleEvent &event) {
+      auto &peers = boost::get<BroadcastEventParams>(event.params).peers;
+      broadcasts_.emplace_back(peers.begin(), peers.end());
+    });
+  }
+
+  /// Adds outgoing stream of \param protocol with \param peer_id
+  void addStream(const PeerId &peer_id,
+                 const std::shared_ptr<ProtocolBase> &protocol) {
+    auto stream = std::make_shared<StreamMock>();
+    EXPECT_CALL(*stream, remotePeerId()).WillRepeatedly(Return(peer_id));
+    EXPECT_CALL(*stream, isClosed()).WillRepeatedly(Return(false));
+    EXPECT_CALL(*stream, write(_, _, _)).WillRepeatedly(Return());
+    EXPECT_OUTCOME_TRUE_1(stream_engine_->addOutgoing(stream, protocol));
+  }
+
+  /// Propagates the transaction and sends the batch at once
+  void propagate() {
+    protocol_->propagateTransactions(gsl::make_span(&tx_, 1));
+    ASSERT_TRUE(send_batch_);
+    std::exchange(send_batch_, nullptr)();
+  }
+
+ protected:
+  HostMock host_;
+  AppConfigurationMock app_config_;
+  ChainSpecMock chain_spec_;
+  std::string protocol_id_ = "dot";
+  std::shared_ptr<BlockTreeMock> block_tree_ =
+      std::make_shared<BlockTreeMock>();
+  kagome::primitives::BlockHash genesis_hash_ = "genesis"_hash256;
+  std::shared_ptr<SchedulerMock> scheduler_ = std::make_shared<SchedulerMock>();
+  Scheduler::Callback send_batch_;
+  std::shared_ptr<SyncProtocolMock> other_protocol_ =
+      std::make_shared<SyncProtocolMock>();
+  std::string other_protocol_name_ = "other_protocol";
+  std::shared_ptr<ExtrinsicSubscriptionEngine> ext_events_engine_ =
+      std::make_shared<ExtrinsicSubscriptionEngine>();
+  std::shared_ptr<ExtrinsicEventKeyRepository> ext_event_key_repo_ =
+      std::make_shared<ExtrinsicEventKeyRepository>();
+  std::shared_ptr<StreamEngine> stream_engine_;
+  std::shared_ptr<PropagateTransactionsProtocol> protocol_;
+  Transaction tx_;
+  std::shared_ptr<ExtrinsicEventSubscriber> subscriber_;
+  std::vector<std::vector<PeerId>> broadcasts_;
+};
+
+/**
+ * @given peer with stream of transactions protocol and peer with streams of
+ * other protocols only
+ * @when a transaction is propagated
+ * @then it is sent and reported as broadcast only to the former peer, the
+ * latter gets the transaction when it opens a stream of transactions protocol
+ */
+TEST_F(PropagateTransactionsProtocolTest, PeerWithoutProtocolIsNotMarked) {
+  auto peer1 = "peer1"_peerid;
+  auto peer2 = "peer2"_peerid;
+  addStream(peer1, protocol_);
+  addStream(peer2, other_protocol_);
+
+  propagate();
+  ASSERT_EQ(broadcasts_.size(), 1);
+  EXPECT_EQ(broadcasts_[0], std::vector<PeerId>{peer1});
+
+  addStream(peer2, protocol_);
+  propagate();
+  ASSERT_EQ(broadcasts_.size(), 2);
+  EXPECT_EQ(broadcasts_[1], std::vector<PeerId>{peer2});
+}
@@ -12,6 +12,7 @@
 
 #include "application/app_configuration.hpp"
 #include "mock/core/blockchain/block_header_repository_mock.hpp"
+#include "mock/core/blockchain/block_storage_mock.hpp"
 #include "mock/core/blockchain/block_tree_mock.hpp"
 #include "mock/core/network/peer_manager_mock.hpp"
 #include "mock/libp2p/host/host_mock.hpp"
@@ -45,7 +46,7 @@ class SynchronizerTest : public testing::Test {
   void SetUp() override {
     peer_manager_mock_ = std::make_shared<PeerManagerMock>();
     sync_protocol_observer_ = std::make_shared<SyncProtocolObserverImpl>(
-        tree_, headers_, peer_manager_mock_);
+        tree_, headers_, storage_, peer_manager_mock_);
   }
 
   std::shared_ptr<HostMock> host_ = std::make_shared<HostMock>();
@@ -54,6 +55,8 @@ class SynchronizerTest : public testing::Test {
   std::shared_ptr<BlockTreeMock> tree_ = std::make_shared<BlockTreeMock>();
   std::shared_ptr<BlockHeaderRepositoryMock> headers_ =
       std::make_shared<BlockHeaderRepositoryMock>();
+  std::shared_ptr<BlockStorageMock> storage_ =
+      std::make_shared<BlockStorageMock>();
 
   std::shared_ptr<SyncProtocolObserver> sync_protocol_observer_;
   std::shared_ptr<PeerManagerMock> peer_manager_mock_;
@@ -82,20 +85,23 @@ TEST_F(SynchronizerTest, ProcessRequest) {
                   block3_hash_, AppConfiguration::kAbsolutMaxBlocksInResponse))
       .WillOnce(Return(std::vector<BlockHash>{block3_hash_, block4_hash_}));
 
-  EXPECT_CALL(*headers_, getBlockHeader(block3_hash_))
-      .WillOnce(Return(block3_.header));
-  EXPECT_CALL(*headers_, getBlockHeader(block4_hash_))
-      .WillOnce(Return(block4_.header));
-
-  EXPECT_CALL(*tree_, getBlockBody(block3_hash_))
-      .WillOnce(Return(block3_.body));
-  EXPECT_CALL(*tree_, getBlockBody(block4_hash_))
-      .WillOnce(Return(block4_.body));
-
-  EXPECT_CALL(*tree_, getBlockJustification(block3_hash_))
-      .WillOnce(Return(::outcome::failure(boost::system::error_code{})));
-  EXPECT_CALL(*tree_, getBlockJustification(block4_hash_))
-      .WillOnce(Return(::outcome::failure(boost::system::error_code{})));
+  std::vector<EncodedBlockData> blocks{
+      {block3_hash_,
+       Buffer{scale::encode(block3_.header).value()},
+       Buffer{scale::encode(block3_.body).value()},
+       std::nullopt},
+      {block4_hash_,
+       Buffer{scale::encode(block4_.header).value()},
+       Buffer{scale::encode(block4_.body).value()},
+       std::nullopt},
+  };
+  EXPECT_CALL(*storage_,
+              getEncodedBlocks(std::vector{block3_hash_, block4_hash_},
+                               true,
+                               true,
+                               true,
+                               kMaxBlocksBytesInResponse))
+      .WillOnce(Return(blocks));
   EXPECT_CALL(*peer_manager_mock_, reserveStatusStreams(peer_info_.id));
 
   // WHEN
@@ -104,16 +110,12 @@ TEST_F(SynchronizerTest, ProcessRequest) {
                                                                peer_info_.id));
 
   // THEN
-  const auto &received_blocks = response.blocks;
+  const auto &received_blocks = response.encoded_blocks;
   ASSERT_EQ(received_blocks.size(), 2);
-
-  ASSERT_EQ(received_blocks[0].hash, block3_hash_);
-  ASSERT_EQ(received_blocks[0].header, block3_.header);
-  ASSERT_EQ(received_blocks[0].body, block3_.body);
-  ASSERT_FALSE(received_blocks[0].justification);
-
-  ASSERT_EQ(received_blocks[1].hash, block4_hash_);
-  ASSERT_EQ(received_blocks[1].header, block4_.header);
-  ASSERT_EQ(received_blocks[1].body, block4_.body);
-  ASSERT_FALSE(received_blocks[1].justification);
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    ASSERT_EQ(received_blocks[i].hash, blocks[i].hash);
+    ASSERT_EQ(received_blocks[i].header, blocks[i].header);
+    ASSERT_EQ(received_blocks[i].body, blocks[i].body);
+    ASSERT_FALSE(received_blocks[i].justification);
+  }
 }
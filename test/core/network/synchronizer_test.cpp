@@ -24,6 +24,7 @@
 #include "mock/core/storage/persistent_map_mock.hpp"
 #include "mock/core/storage/trie/serialization/trie_serializer_mock.hpp"
 #include "mock/core/storage/trie/trie_storage_mock.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
 #include "network/impl/synchronizer_impl.hpp"
 #include "primitives/common.hpp"
 #include "testutil/literals.hpp"
@@ -86,6 +87,7 @@ class SynchronizerTest
                                                     block_executor,
                                                     serializer,
                                                     storage,
+                                                    spaced_storage,
                                                     router,
                                                     scheduler,
                                                     hasher,
@@ -108,6 +110,8 @@ class SynchronizerTest
       std::make_shared<BlockExecutorMock>();
   std::shared_ptr<trie::TrieStorageMock> storage =
       std::make_shared<trie::TrieStorageMock>();
+  std::shared_ptr<kagome::storage::InMemorySpacedStorage> spaced_storage =
+      std::make_shared<kagome::storage::InMemorySpacedStorage>();
   std::shared_ptr<trie::TrieSerializerMock> serializer =
       std::make_shared<trie::TrieSerializerMock>();
   std::shared_ptr<network::SyncProtocolMock> sync_protocol =
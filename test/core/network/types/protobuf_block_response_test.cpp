@@ -14,7 +14,9 @@ using kagome::network::ProtobufMessageAdapter;
 using kagome::primitives::BlockData;
 using kagome::primitives::BlockHash;
 using kagome::primitives::BlockHeader;
+using kagome::primitives::EncodedBlockData;
 using kagome::primitives::Extrinsic;
+using kagome::primitives::Justification;
 
 using kagome::common::Buffer;
 
@@ -83,3 +85,89 @@ TEST_F(ProtobufBlockResponseAdapterTest, Serialization) {
     ASSERT_EQ(response.blocks[ix].message_queue, r2.blocks[ix].message_queue);
   }
 }
+
+/**
+ * @given `BlocksResponse` with extrinsics of sizes crossing every mode of
+ * compact length prefix
+ * @when protobuf serialized into buffer and deserialized back
+ * @then extrinsics are the same
+ */
+TEST_F(ProtobufBlockResponseAdapterTest, BodyOfManyExtrinsics) {
+  std::vector<Extrinsic> body;
+  for (size_t size : {0, 1, 63, 64, 16383, 16384, 100000}) {
+    body.emplace_back(Extrinsic{Buffer(size, static_cast<uint8_t>(size))});
+  }
+  response.blocks[0].body = body;
+
+  std::vector<uint8_t> data;
+  AdapterType::write(response, data, data.end());
+  BlocksResponse r2;
+  EXPECT_OUTCOME_TRUE(it_read, AdapterType::read(r2, data, data.begin()));
+
+  ASSERT_EQ(it_read, data.end());
+  ASSERT_EQ(r2.blocks.size(), 1);
+  ASSERT_EQ(r2.blocks[0].body, body);
+}
+
+/**
+ * @given `BlocksResponse` with block as it is stored, SCALE encoded
+ * @when protobuf serialized into buffer and deserialized back
+ * @then deserialized block is the same as encoded one
+ */
+TEST_F(ProtobufBlockResponseAdapterTest, EncodedBlocks) {
+  auto &block = response.blocks[0];
+  std::vector<Extrinsic> body;
+  for (size_t size : {0, 1, 64, 16384}) {
+    body.emplace_back(Extrinsic{Buffer(size, static_cast<uint8_t>(size))});
+  }
+  Justification justification{Buffer{0x01, 0x02, 0x03}};
+  BlocksResponse encoded;
+  encoded.encoded_blocks.emplace_back(EncodedBlockData{
+      block.hash,
+      Buffer{scale::encode(*block.header).value()},
+      Buffer{scale::encode(body).value()},
+      Buffer{scale::encode(justification).value()},
+  });
+
+  std::vector<uint8_t> data;
+  AdapterType::write(encoded, data, data.end());
+  BlocksResponse r2;
+  EXPECT_OUTCOME_TRUE(it_read, AdapterType::read(r2, data, data.begin()));
+
+  ASSERT_EQ(it_read, data.end());
+  ASSERT_EQ(r2.blocks.size(), 1);
+  ASSERT_EQ(r2.blocks[0].hash, block.hash);
+  ASSERT_EQ(r2.blocks[0].header, block.header);
+  ASSERT_EQ(r2.blocks[0].body, body);
+  ASSERT_EQ(r2.blocks[0].justification, justification);
+}
+
+/**
+ * @given `BlocksResponse` serialized into shared buffer
+ * @when deserialized without copying extrinsics
+ * @then extrinsics are views into the buffer, which is kept alive by body,
+ * and owning body made of them is the same as original
+ */
+TEST_F(ProtobufBlockResponseAdapterTest, SharedBody) {
+  auto body = *response.blocks[0].body;
+  auto data = std::make_shared<std::vector<uint8_t>>();
+  AdapterType::write(response, *data, data->end());
+
+  BlocksResponse r2;
+  EXPECT_OUTCOME_TRUE_1(AdapterType::readShared(r2, data));
+  data.reset();
+
+  ASSERT_EQ(r2.blocks.size(), 1);
+  ASSERT_FALSE(r2.blocks[0].body);
+  ASSERT_EQ(r2.blocks[0].header, response.blocks[0].header);
+  ASSERT_EQ(r2.shared_bodies.size(), 1);
+  auto &shared_body = r2.shared_bodies[0];
+  ASSERT_TRUE(shared_body);
+  ASSERT_TRUE(shared_body->buffer);
+  for (auto &extrinsic : shared_body->extrinsics) {
+    EXPECT_GE(extrinsic.data(), shared_body->buffer->data());
+    EXPECT_LE(extrinsic.data() + extrinsic.size(),
+              shared_body->buffer->data() + shared_body->buffer->size());
+  }
+  ASSERT_EQ(shared_body->toBlockBody(), body);
+}
@@ -0,0 +1,65 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "crypto/hasher/hasher_impl.hpp"
+#include "primitives/block_header.hpp"
+#include "testutil/literals.hpp"
+
+using kagome::crypto::HasherImpl;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::calculateBlockHash;
+using kagome::primitives::reusedBlockHeaderHashes;
+
+struct BlockHeaderTest : public testing::Test {
+  BlockHeaderTest() {
+    header.parent_hash = "parent"_hash256;
+    header.number = 42;
+    header.state_root = "state"_hash256;
+    header.extrinsics_root = "extrinsics"_hash256;
+  }
+
+  HasherImpl hasher;
+  BlockHeader header;
+};
+
+/**
+ * @given header without memoized hash
+ * @when hash is updated
+ * @then memoized hash is the hash of encoded header and it is reused
+ */
+TEST_F(BlockHeaderTest, UpdateHash) {
+  auto expected = calculateBlockHash(header, hasher).value();
+  EXPECT_FALSE(header.hash_opt);
+  auto reused = reusedBlockHeaderHashes();
+  EXPECT_EQ(header.hash(hasher), expected);
+  EXPECT_EQ(reusedBlockHeaderHashes(), reused);
+
+  EXPECT_EQ(header.updateHash(hasher), expected);
+  EXPECT_EQ(header.hash_opt, expected);
+
+  auto copy = header;
+  EXPECT_EQ(copy.hash(hasher), expected);
+  EXPECT_EQ(reusedBlockHeaderHashes(), reused + 1);
+}
+
+/**
+ * @given header with memoized hash
+ * @when it is encoded and decoded
+ * @then hash is not encoded, decoded header has no memoized hash and equals
+ * to original one
+ */
+TEST_F(BlockHeaderTest, Codec) {
+  auto encoded = scale::encode(header).value();
+  header.updateHash(hasher);
+  EXPECT_EQ(scale::encode(header).value(), encoded);
+
+  auto decoded = header;
+  scale::ScaleDecoderStream s{encoded};
+  s >> decoded;
+  EXPECT_FALSE(decoded.hash_opt);
+  EXPECT_EQ(decoded, header);
+}
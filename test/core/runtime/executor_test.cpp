@@ -19,6 +19,7 @@
 #include "mock/core/runtime/trie_storage_provider_mock.hpp"
 #include "mock/core/storage/trie/trie_batches_mock.hpp"
 #include "mock/core/storage/trie/trie_storage_mock.hpp"
+#include "runtime/runtime_api/impl/runtime_properties_cache_impl.hpp"
 #include "testutil/literals.hpp"
 #include "testutil/outcome.hpp"
 #include "testutil/prepare_loggers.hpp"
@@ -38,6 +39,7 @@ using kagome::runtime::ModuleRepositoryMock;
 using kagome::runtime::PtrSize;
 using kagome::runtime::RuntimeEnvironment;
 using kagome::runtime::RuntimeEnvironmentTemplateMock;
+using kagome::runtime::RuntimePropertiesCacheImpl;
 using kagome::runtime::RuntimePropertiesCacheMock;
 using kagome::runtime::TrieStorageProviderMock;
 using kagome::storage::trie::TrieBatch;
@@ -233,3 +235,110 @@ TEST_F(ExecutorTest, LatestStateSwitchesCorrectly) {
                           block_info2, "state_hash5"_hash256, "addTwo", 7, 10));
   ASSERT_EQ(res6, 17);
 }
+
+/**
+ * @given executor with cached result of pure runtime call
+ * @when the call is made at block with the same state
+ * @then the cached result is returned without making runtime environment
+ */
+TEST_F(ExecutorTest, PureCallIsServedFromCache) {
+  Executor executor{env_factory_, cache_};
+  kagome::primitives::BlockInfo block_info{42, "block_hash"_hash256};
+  auto state = "state_hash"_hash256;
+
+  EXPECT_CALL(*env_factory_, start(block_info.hash))
+      .WillOnce(Invoke(
+          [weak_env_factory =
+               std::weak_ptr<kagome::runtime::RuntimeEnvironmentFactoryMock>{
+                   env_factory_},
+           block_info,
+           state](auto &) {
+            auto env_template =
+                std::make_unique<RuntimeEnvironmentTemplateMock>(
+                    weak_env_factory, block_info, state);
+            EXPECT_CALL(*env_template, make()).Times(0);
+            return env_template;
+          }));
+  Buffer enc_args{scale::encode(7).value()};
+  EXPECT_CALL(*cache_,
+              getCallResult(state,
+                            std::string_view{"AccountNonceApi_account_nonce"},
+                            enc_args.view(),
+                            _))
+      .WillOnce(Return(Buffer{scale::encode(uint32_t{5}).value()}));
+
+  EXPECT_OUTCOME_TRUE(
+      nonce,
+      executor.callAt<uint32_t>(
+          block_info.hash, "AccountNonceApi_account_nonce", 7));
+  EXPECT_EQ(nonce, 5);
+}
+
+/**
+ * @given executor with runtime properties cache
+ * @when runtime version is requested at two blocks with different states and
+ * the same code
+ * @then runtime is executed only once, version is cached by code hash
+ */
+TEST_F(ExecutorTest, VersionIsCachedByCodeHash) {
+  Executor executor{env_factory_,
+                    std::make_shared<RuntimePropertiesCacheImpl>()};
+  kagome::primitives::BlockInfo block_info1{42, "block_hash1"_hash256};
+  kagome::primitives::BlockInfo block_info2{43, "block_hash2"_hash256};
+  static const auto code_hash = "code_hash"_hash256;
+  kagome::primitives::Version version{.spec_name = "test",
+                                      .spec_version = 42};
+  const PtrSize RESULT_LOCATION{3, 4};
+
+  auto module_instance = std::make_shared<ModuleInstanceMock>();
+  EXPECT_CALL(*module_instance, getCodeHash())
+      .WillRepeatedly(ReturnRef(code_hash));
+  EXPECT_CALL(*module_instance,
+              callExportFunction(std::string_view{"Core_version"}, _))
+      .WillOnce(Return(RESULT_LOCATION));
+  EXPECT_CALL(*module_instance, resetEnvironment())
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*memory_, loadN(RESULT_LOCATION.ptr, RESULT_LOCATION.size))
+      .WillOnce(Return(Buffer{scale::encode(version).value()}));
+  auto memory_provider = std::make_shared<MemoryProviderMock>();
+  EXPECT_CALL(*memory_provider, getCurrentMemory())
+      .WillOnce(Return(
+          std::optional<std::reference_wrapper<kagome::runtime::Memory>>(
+              *memory_)));
+
+  for (auto &[block_info, state] :
+       {std::pair{block_info1, "state_hash1"_hash256},
+        std::pair{block_info2, "state_hash2"_hash256}}) {
+    EXPECT_CALL(*env_factory_, start(block_info.hash))
+        .WillOnce(Invoke(
+            [weak_env_factory =
+                 std::weak_ptr<kagome::runtime::RuntimeEnvironmentFactoryMock>{
+                     env_factory_},
+             block_info = block_info,
+             state = state,
+             module_instance,
+             memory_provider](auto &) {
+              auto env_template =
+                  std::make_unique<RuntimeEnvironmentTemplateMock>(
+                      weak_env_factory, block_info, state);
+              EXPECT_CALL(*env_template, make())
+                  .WillOnce(Invoke([=] {
+                    return std::make_unique<RuntimeEnvironment>(
+                        module_instance,
+                        memory_provider,
+                        std::make_shared<TrieStorageProviderMock>(),
+                        block_info);
+                  }));
+              return env_template;
+            }));
+  }
+
+  EXPECT_OUTCOME_TRUE(version1,
+                      executor.callAt<kagome::primitives::Version>(
+                          block_info1.hash, "Core_version"));
+  EXPECT_OUTCOME_TRUE(version2,
+                      executor.callAt<kagome::primitives::Version>(
+                          block_info2.hash, "Core_version"));
+  EXPECT_EQ(version1, version);
+  EXPECT_EQ(version2, version);
+}
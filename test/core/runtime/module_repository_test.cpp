@@ -0,0 +1,183 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/common/module_repository_impl.hpp"
+
+#include <future>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "crypto/hasher/hasher_impl.hpp"
+#include "mock/core/runtime/module_factory_mock.hpp"
+#include "mock/core/runtime/module_instance_mock.hpp"
+#include "mock/core/runtime/module_mock.hpp"
+#include "mock/core/runtime/runtime_upgrade_tracker_mock.hpp"
+#include "runtime/common/constant_code_provider.hpp"
+#include "runtime/common/runtime_instances_pool.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/outcome.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::common::Buffer;
+using kagome::crypto::HasherImpl;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::BlockInfo;
+using kagome::runtime::ConstantCodeProvider;
+using kagome::runtime::Module;
+using kagome::runtime::ModuleFactoryMock;
+using kagome::runtime::ModuleInstance;
+using kagome::runtime::ModuleInstanceMock;
+using kagome::runtime::ModuleMock;
+using kagome::runtime::ModuleRepositoryImpl;
+using kagome::runtime::RuntimeInstancesPool;
+using kagome::runtime::RuntimeUpgradeTrackerMock;
+using kagome::runtime::SingleModuleCache;
+using kagome::storage::trie::RootHash;
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+
+class ModuleRepositoryTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    pool_ = std::make_shared<RuntimeInstancesPool>();
+    upgrade_tracker_ = std::make_shared<RuntimeUpgradeTrackerMock>();
+    module_factory_ = std::make_shared<ModuleFactoryMock>();
+    module_repo_ = std::make_shared<ModuleRepositoryImpl>(
+        pool_,
+        upgrade_tracker_,
+        module_factory_,
+        std::make_shared<SingleModuleCache>(),
+        std::make_shared<HasherImpl>());
+    code_provider_ =
+        std::make_shared<ConstantCodeProvider>(Buffer::fromString("code"));
+  }
+
+  static std::unique_ptr<Module> makeModule() {
+    auto module = std::make_unique<ModuleMock>();
+    EXPECT_CALL(*module, instantiate()).WillRepeatedly(Invoke([] {
+      return std::shared_ptr<ModuleInstance>{
+          std::make_shared<ModuleInstanceMock>()};
+    }));
+    return module;
+  }
+
+  /// Makes block \param info, runtime of which is at state \param state
+  BlockHeader prepareBlock(const BlockInfo &info, const RootHash &state) {
+    EXPECT_CALL(*upgrade_tracker_, getLastCodeUpdateState(info))
+        .WillOnce(Return(state));
+    BlockHeader header{};
+    header.number = info.number;
+    header.state_root = state;
+    return header;
+  }
+
+ protected:
+  std::shared_ptr<RuntimeInstancesPool> pool_;
+  std::shared_ptr<RuntimeUpgradeTrackerMock> upgrade_tracker_;
+  std::shared_ptr<ModuleFactoryMock> module_factory_;
+  std::shared_ptr<ModuleRepositoryImpl> module_repo_;
+  std::shared_ptr<ConstantCodeProvider> code_provider_;
+};
+
+/**
+ * @given code being compiled by the precompiler
+ * @when the next block with the same code is executed meanwhile
+ * @then block execution waits for that compilation instead of compiling the
+ * code once more
+ */
+TEST_F(ModuleRepositoryTest, RunningCompilationIsAwaited) {
+  std::promise<void> compilation_started;
+  std::promise<void> compilation_allowed;
+  EXPECT_CALL(*module_factory_, make(_))
+      .WillOnce(Invoke([&](auto) {
+        compilation_started.set_value();
+        compilation_allowed.get_future().wait();
+        return makeModule();
+      }));
+
+  std::shared_ptr<Module> precompiled;
+  std::thread precompiler{[&] {
+    auto code = code_provider_->getCodeAt({}).value();
+    EXPECT_OUTCOME_TRUE(module, module_repo_->getModuleByCode(code));
+    precompiled = std::move(module);
+  }};
+  compilation_started.get_future().wait();
+
+  BlockInfo block{43, "block_hash"_hash256};
+  BlockHeader header{};
+  header.number = block.number;
+  header.state_root = "state_root"_hash256;
+  std::promise<void> execution_started;
+  EXPECT_CALL(*upgrade_tracker_, getLastCodeUpdateState(block))
+      .WillOnce(Invoke([&](auto &) {
+        execution_started.set_value();
+        return header.state_root;
+      }));
+  auto instance = std::async(std::launch::async, [&] {
+    return module_repo_->getInstanceAt(code_provider_, block, header);
+  });
+  execution_started.get_future().wait();
+  compilation_allowed.set_value();
+  precompiler.join();
+
+  EXPECT_OUTCOME_TRUE_1(instance.get());
+  EXPECT_NE(precompiled, nullptr);
+}
+
+/**
+ * @given runtime code of the same value in two different states
+ * @when instances are requested at blocks of these states
+ * @then the code is compiled once and its module is reused for both states
+ */
+TEST_F(ModuleRepositoryTest, SameCodeIsCompiledOnce) {
+  BlockInfo block1{1, "block_hash1"_hash256};
+  BlockInfo block2{2, "block_hash2"_hash256};
+  auto header1 = prepareBlock(block1, "state_root1"_hash256);
+  auto header2 = prepareBlock(block2, "state_root2"_hash256);
+  EXPECT_CALL(*module_factory_, make(_)).WillOnce(Invoke([](auto) {
+    return makeModule();
+  }));
+
+  EXPECT_OUTCOME_TRUE_1(
+      module_repo_->getInstanceAt(code_provider_, block1, header1));
+  EXPECT_OUTCOME_TRUE_1(
+      module_repo_->getInstanceAt(code_provider_, block2, header2));
+  EXPECT_EQ(pool_->getModule(header1.state_root),
+            pool_->getModule(header2.state_root));
+}
+
+/**
+ * @given module of some code, evicted from the pool and no longer used
+ * @when an instance is requested at a block of another state with that code
+ * @then the code is compiled again
+ */
+TEST_F(ModuleRepositoryTest, ExpiredModuleIsCompiledAgain) {
+  BlockInfo block1{1, "block_hash1"_hash256};
+  BlockInfo block2{2, "block_hash2"_hash256};
+  auto header1 = prepareBlock(block1, "state_root1"_hash256);
+  auto header2 = prepareBlock(block2, "state_root2"_hash256);
+  EXPECT_CALL(*module_factory_, make(_))
+      .Times(2)
+      .WillRepeatedly(Invoke([](auto) { return makeModule(); }));
+
+  EXPECT_OUTCOME_TRUE_1(
+      module_repo_->getInstanceAt(code_provider_, block1, header1));
+  // more modules than the pool holds
+  for (uint8_t i = 0; i < 10; ++i) {
+    RootHash state{};
+    state[0] = i;
+    pool_->putModule(state, std::make_shared<ModuleMock>());
+  }
+  ASSERT_FALSE(pool_->getModule(header1.state_root).has_value());
+
+  EXPECT_OUTCOME_TRUE_1(
+      module_repo_->getInstanceAt(code_provider_, block2, header2));
+}
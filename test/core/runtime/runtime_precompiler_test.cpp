@@ -0,0 +1,179 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/common/runtime_precompiler.hpp"
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "crypto/hasher/hasher_impl.hpp"
+#include "mock/core/application/app_state_manager_mock.hpp"
+#include "mock/core/blockchain/block_header_repository_mock.hpp"
+#include "mock/core/runtime/module_factory_mock.hpp"
+#include "mock/core/runtime/module_mock.hpp"
+#include "mock/core/runtime/runtime_upgrade_tracker_mock.hpp"
+#include "mock/core/storage/trie/trie_batches_mock.hpp"
+#include "mock/core/storage/trie/trie_storage_mock.hpp"
+#include "runtime/common/module_repository_impl.hpp"
+#include "runtime/common/runtime_instances_pool.hpp"
+#include "storage/predefined_keys.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::application::AppStateManagerMock;
+using kagome::blockchain::BlockHeaderRepositoryMock;
+using kagome::common::Buffer;
+using kagome::common::BufferView;
+using kagome::crypto::HasherImpl;
+using kagome::primitives::BlockHash;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::events::ChainEventType;
+using kagome::primitives::events::ChainSubscriptionEngine;
+using kagome::primitives::events::NewRuntimeEventParams;
+using kagome::runtime::Module;
+using kagome::runtime::ModuleFactoryMock;
+using kagome::runtime::ModuleMock;
+using kagome::runtime::ModuleRepositoryImpl;
+using kagome::runtime::RuntimeInstancesPool;
+using kagome::runtime::RuntimePrecompiler;
+using kagome::runtime::RuntimeUpgradeTrackerMock;
+using kagome::runtime::SingleModuleCache;
+using kagome::storage::kRuntimeCodeKey;
+using kagome::storage::trie::RootHash;
+using kagome::storage::trie::TrieBatch;
+using kagome::storage::trie::TrieBatchMock;
+using kagome::storage::trie::TrieStorageMock;
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+
+class RuntimePrecompilerTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    auto app_state_manager = std::make_shared<AppStateManagerMock>();
+    EXPECT_CALL(*app_state_manager, atPrepare(_));
+    EXPECT_CALL(*app_state_manager, atShutdown(_));
+    chain_events_engine_ = std::make_shared<ChainSubscriptionEngine>();
+    header_repo_ = std::make_shared<BlockHeaderRepositoryMock>();
+    trie_storage_ = std::make_shared<TrieStorageMock>();
+    module_factory_ = std::make_shared<ModuleFactoryMock>();
+    pool_ = std::make_shared<RuntimeInstancesPool>();
+    auto module_repo = std::make_shared<ModuleRepositoryImpl>(
+        pool_,
+        std::make_shared<RuntimeUpgradeTrackerMock>(),
+        module_factory_,
+        std::make_shared<SingleModuleCache>(),
+        std::make_shared<HasherImpl>());
+    precompiler_ = std::make_shared<RuntimePrecompiler>(app_state_manager,
+                                                        chain_events_engine_,
+                                                        header_repo_,
+                                                        trie_storage_,
+                                                        module_repo,
+                                                        pool_);
+    ASSERT_TRUE(precompiler_->prepare());
+  }
+
+  void TearDown() override {
+    precompiler_->stop();
+  }
+
+  /**
+   * Makes block \param hash with state \param state containing \param code
+   */
+  void prepareBlock(const BlockHash &hash,
+                    const RootHash &state,
+                    const Buffer &code) {
+    BlockHeader header{};
+    header.state_root = state;
+    EXPECT_CALL(*header_repo_, getBlockHeader(hash)).WillOnce(Return(header));
+    ON_CALL(*trie_storage_, getEphemeralBatchAt(state))
+        .WillByDefault(Invoke([code](auto &) -> std::unique_ptr<TrieBatch> {
+          auto batch = std::make_unique<TrieBatchMock>();
+          EXPECT_CALL(*batch, getMock(BufferView{kRuntimeCodeKey}))
+              .WillOnce(Return(code));
+          return batch;
+        }));
+  }
+
+  void notifyNewRuntime(const BlockHash &hash) {
+    chain_events_engine_->notify(ChainEventType::kNewRuntime,
+                                 NewRuntimeEventParams{hash});
+  }
+
+  /// waits until compile thread puts a module for \param state into the pool
+  std::optional<std::shared_ptr<Module>> waitForModule(const RootHash &state) {
+    for (auto i = 0; i < 500; ++i) {
+      if (auto module = pool_->getModule(state)) {
+        return module;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+    return std::nullopt;
+  }
+
+ protected:
+  std::shared_ptr<ChainSubscriptionEngine> chain_events_engine_;
+  std::shared_ptr<BlockHeaderRepositoryMock> header_repo_;
+  std::shared_ptr<TrieStorageMock> trie_storage_;
+  std::shared_ptr<ModuleFactoryMock> module_factory_;
+  std::shared_ptr<RuntimeInstancesPool> pool_;
+  std::shared_ptr<RuntimePrecompiler> precompiler_;
+};
+
+/**
+ * @given precompiler subscribed to chain events
+ * @when runtime of a block is upgraded
+ * @then code from the state of that block is compiled and the module is put
+ * into the pool under that state
+ */
+TEST_F(RuntimePrecompilerTest, NewRuntimeIsPutIntoPool) {
+  auto hash = "block_hash"_hash256;
+  auto state = "state_root"_hash256;
+  prepareBlock(hash, state, Buffer::fromString("code"));
+  EXPECT_CALL(*trie_storage_, getEphemeralBatchAt(state));
+  EXPECT_CALL(*module_factory_, make(_))
+      .WillOnce(Invoke([](auto) -> std::unique_ptr<Module> {
+        return std::make_unique<ModuleMock>();
+      }));
+
+  notifyNewRuntime(hash);
+
+  ASSERT_TRUE(waitForModule(state).has_value());
+}
+
+/**
+ * @given pool which already holds a module for the state of a block
+ * @when runtime of that block and then of another block is upgraded
+ * @then only code of the other block is compiled, module of the first block
+ * is kept in the pool
+ */
+TEST_F(RuntimePrecompilerTest, LoadedModuleIsNotCompiled) {
+  auto hash1 = "block_hash1"_hash256;
+  auto state1 = "state_root1"_hash256;
+  auto hash2 = "block_hash2"_hash256;
+  auto state2 = "state_root2"_hash256;
+  std::shared_ptr<Module> module1 = std::make_shared<ModuleMock>();
+  pool_->putModule(state1, module1);
+  prepareBlock(hash1, state1, Buffer::fromString("code1"));
+  prepareBlock(hash2, state2, Buffer::fromString("code2"));
+  EXPECT_CALL(*trie_storage_, getEphemeralBatchAt(state1)).Times(0);
+  EXPECT_CALL(*trie_storage_, getEphemeralBatchAt(state2));
+  EXPECT_CALL(*module_factory_, make(_))
+      .WillOnce(Invoke([](auto) -> std::unique_ptr<Module> {
+        return std::make_unique<ModuleMock>();
+      }));
+
+  notifyNewRuntime(hash1);
+  notifyNewRuntime(hash2);
+
+  // compilations are done in order of events on a single thread
+  ASSERT_TRUE(waitForModule(state2).has_value());
+  EXPECT_EQ(pool_->getModule(state1), module1);
+}
@@ -0,0 +1,108 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/runtime_api/impl/runtime_properties_cache_impl.hpp"
+
+#include <gtest/gtest.h>
+
+#include "testutil/literals.hpp"
+#include "testutil/outcome.hpp"
+
+using kagome::common::Buffer;
+using kagome::runtime::RuntimePropertiesCacheImpl;
+
+class RuntimePropertiesCacheTest : public testing::Test {
+ public:
+  /// obtainer of call result, which counts calls
+  auto obtainer(Buffer result) {
+    return [this, result = std::move(result)]() -> outcome::result<Buffer> {
+      ++calls_;
+      return result;
+    };
+  }
+
+ protected:
+  RuntimePropertiesCacheImpl cache_;
+  size_t calls_ = 0;
+};
+
+/**
+ * @given cached result of runtime call
+ * @when the same call is made at the same state
+ * @then cached result is returned without calling runtime
+ */
+TEST_F(RuntimePropertiesCacheTest, CallResultIsCached) {
+  auto state = "state"_hash256;
+  Buffer args{1, 2, 3};
+  EXPECT_OUTCOME_TRUE(
+      first, cache_.getCallResult(state, "method", args, obtainer({4})));
+  EXPECT_OUTCOME_TRUE(
+      second, cache_.getCallResult(state, "method", args, obtainer({5})));
+  EXPECT_EQ(first, Buffer{4});
+  EXPECT_EQ(second, Buffer{4});
+  EXPECT_EQ(calls_, 1);
+}
+
+/**
+ * @given cached result of runtime call
+ * @when call differs by state, method or arguments
+ * @then runtime is called for each of them
+ */
+TEST_F(RuntimePropertiesCacheTest, KeyIncludesStateMethodAndArgs) {
+  auto state = "state"_hash256;
+  Buffer args{1, 2, 3};
+  EXPECT_OUTCOME_TRUE_1(
+      cache_.getCallResult(state, "method", args, obtainer({1})));
+  EXPECT_OUTCOME_TRUE_1(cache_.getCallResult(
+      "another_state"_hash256, "method", args, obtainer({2})));
+  EXPECT_OUTCOME_TRUE_1(
+      cache_.getCallResult(state, "another_method", args, obtainer({3})));
+  EXPECT_OUTCOME_TRUE_1(
+      cache_.getCallResult(state, "method", Buffer{1, 2}, obtainer({4})));
+  EXPECT_EQ(calls_, 4);
+}
+
+/**
+ * @given runtime call which fails
+ * @when the call is repeated
+ * @then runtime is called again
+ */
+TEST_F(RuntimePropertiesCacheTest, FailureIsNotCached) {
+  auto failing = [&]() -> outcome::result<Buffer> {
+    ++calls_;
+    return outcome::failure(std::errc::invalid_argument);
+  };
+  auto state = "state"_hash256;
+  EXPECT_OUTCOME_FALSE_1(cache_.getCallResult(state, "method", {}, failing));
+  EXPECT_OUTCOME_FALSE_1(cache_.getCallResult(state, "method", {}, failing));
+  EXPECT_EQ(calls_, 2);
+}
+
+/**
+ * @given cache filled with results up to its size limit
+ * @when another result is cached
+ * @then the least recently used result is evicted
+ */
+TEST_F(RuntimePropertiesCacheTest, LeastRecentlyUsedIsEvicted) {
+  constexpr auto kSize = RuntimePropertiesCacheImpl::kMaxCallResultsBytes / 3;
+  Buffer result(kSize, 0);
+  for (auto state : {"state1"_hash256, "state2"_hash256, "state3"_hash256}) {
+    EXPECT_OUTCOME_TRUE_1(
+        cache_.getCallResult(state, "method", {}, obtainer(result)));
+  }
+  // state1 becomes the most recently used one
+  EXPECT_OUTCOME_TRUE_1(
+      cache_.getCallResult("state1"_hash256, "method", {}, obtainer(result)));
+  EXPECT_EQ(calls_, 3);
+
+  EXPECT_OUTCOME_TRUE_1(
+      cache_.getCallResult("state4"_hash256, "method", {}, obtainer(result)));
+  EXPECT_OUTCOME_TRUE_1(
+      cache_.getCallResult("state1"_hash256, "method", {}, obtainer(result)));
+  EXPECT_EQ(calls_, 4);
+  EXPECT_OUTCOME_TRUE_1(
+      cache_.getCallResult("state2"_hash256, "method", {}, obtainer(result)));
+  EXPECT_EQ(calls_, 5);
+}
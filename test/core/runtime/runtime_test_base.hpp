@@ -34,6 +34,7 @@
 #include "mock/core/storage/trie/polkadot_trie_cursor_mock.h"
 #include "mock/core/storage/trie/serialization/trie_serializer_mock.hpp"
 #include "mock/core/storage/trie/trie_batches_mock.hpp"
+#include "mock/core/storage/trie/trie_snapshot_mock.hpp"
 #include "mock/core/storage/trie/trie_storage_mock.hpp"
 #include "primitives/block.hpp"
 #include "primitives/block_header.hpp"
@@ -158,7 +159,8 @@ class RuntimeTestBase : public ::testing::Test {
         std::make_shared<runtime::RuntimeInstancesPool>(),
         upgrade_tracker,
         module_factory,
-        std::make_shared<runtime::SingleModuleCache>());
+        std::make_shared<runtime::SingleModuleCache>(),
+        hasher_);
 
     runtime_env_factory_ = std::make_shared<runtime::RuntimeEnvironmentFactory>(
         std::move(wasm_provider_), std::move(module_repo), header_repo_);
@@ -177,11 +179,15 @@ class RuntimeTestBase : public ::testing::Test {
   }
 
   void prepareEphemeralStorageExpects() {
-    EXPECT_CALL(*trie_storage_, getEphemeralBatchAt(_))
+    EXPECT_CALL(*trie_storage_, getSnapshotAt(_))
         .WillOnce(testing::Invoke([this](auto &root) {
-          auto batch = std::make_unique<TrieBatchMock>();
-          prepareStorageBatchExpectations(*batch);
-          return batch;
+          auto snapshot = std::make_shared<storage::trie::TrieSnapshotMock>();
+          EXPECT_CALL(*snapshot, batch()).WillOnce(testing::Invoke([this] {
+            auto batch = std::make_unique<TrieBatchMock>();
+            prepareStorageBatchExpectations(*batch);
+            return batch;
+          }));
+          return snapshot;
         }));
   }
 
@@ -45,3 +45,14 @@ TEST(SmallLruCacheTest, OldestUsedModulePreempted) {
   ASSERT_TRUE(cache.get(4));
   ASSERT_TRUE(cache.get(5));
 }
+
+TEST(SmallLruCacheTest, PutReplacesExistingKey) {
+  auto cache = kagome::runtime::SmallLruCache<int, int>{2};
+
+  (void)cache.put(1, 42);
+  (void)cache.put(2, 42);
+  (void)cache.put(1, 43);
+
+  ASSERT_EQ(cache.get(1)->get(), 43);
+  ASSERT_TRUE(cache.get(2));
+}
@@ -0,0 +1,67 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/wavm/module_cache.hpp"
+
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "crypto/hasher/hasher_impl.hpp"
+#include "testutil/storage/base_fs_test.hpp"
+
+using kagome::crypto::HasherImpl;
+using kagome::runtime::wavm::ModuleCache;
+
+struct ModuleCacheTest : public test::BaseFS_Test {
+  ModuleCacheTest() : test::BaseFS_Test("/tmp/kagome_wavm_module_cache") {}
+
+  std::vector<WAVM::U8> get(ModuleCache &cache) {
+    return cache.getCachedObject(code_.data(), code_.size(), [this] {
+      ++compilations_;
+      return object_;
+    });
+  }
+
+  fs::path objectPath() const {
+    return base_path / hasher_->twox_64(code_).toHex();
+  }
+
+  std::shared_ptr<HasherImpl> hasher_ = std::make_shared<HasherImpl>();
+  std::vector<WAVM::U8> code_{0x00, 0x61, 0x73, 0x6d, 0x01};
+  std::vector<WAVM::U8> object_{1, 2, 3, 4, 5, 6, 7};
+  size_t compilations_ = 0;
+};
+
+/**
+ * @given empty cache
+ * @when object is requested twice, by another cache instance second time
+ * @then object is compiled once @and same object is returned both times
+ */
+TEST_F(ModuleCacheTest, CompiledOnce) {
+  ModuleCache cache{hasher_, base_path};
+  EXPECT_EQ(get(cache), object_);
+
+  ModuleCache restarted{hasher_, base_path};
+  EXPECT_EQ(get(restarted), object_);
+  EXPECT_EQ(compilations_, 1);
+}
+
+/**
+ * @given cached object without valid header, e.g. written by older version
+ * @when object is requested
+ * @then object is compiled again @and cached one is replaced
+ */
+TEST_F(ModuleCacheTest, OutdatedObjectRecompiled) {
+  {
+    std::ofstream file{objectPath().c_str(), std::ios::binary};
+    file.write(reinterpret_cast<const char *>(object_.data()), object_.size());
+  }
+
+  ModuleCache cache{hasher_, base_path};
+  EXPECT_EQ(get(cache), object_);
+  EXPECT_EQ(get(cache), object_);
+  EXPECT_EQ(compilations_, 1);
+}
@@ -190,7 +190,8 @@ class WasmExecutorTest : public ::testing::Test {
         std::make_shared<RuntimeInstancesPool>(),
         runtime_upgrade_tracker_,
         module_factory,
-        bogus_smc);
+        bogus_smc,
+        hasher);
 
     auto core_provider =
         std::make_shared<kagome::runtime::wavm::CoreApiFactoryImpl>(
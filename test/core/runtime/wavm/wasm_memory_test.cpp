@@ -11,6 +11,7 @@
 #include "runtime/wavm/intrinsics/intrinsic_module.hpp"
 #include "runtime/wavm/intrinsics/intrinsic_module_instance.hpp"
 #include "runtime/wavm/memory_impl.hpp"
+#include "runtime/wavm/memory_snapshot.hpp"
 #include "runtime/wavm/module_params.hpp"
 #include "testutil/prepare_loggers.hpp"
 
@@ -214,3 +215,33 @@ TEST_F(WavmMemoryHeapTest, LoadNTest) {
   auto res_b = memory_->loadN(ptr, N);
   ASSERT_EQ(b, res_b);
 }
+
+#ifdef __linux__
+/**
+ * @given snapshot of memory image
+ * @when image and heap are modified @and snapshot is restored
+ * @then image has content from the moment of snapshot @and heap is zeroed
+ */
+TEST_F(WavmMemoryHeapTest, RestoreSnapshot) {
+  using kagome::runtime::kMemoryPageSize;
+  using kagome::runtime::wavm::MemorySnapshot;
+
+  const kagome::common::Buffer image(16, 'i');
+  const kagome::common::Buffer dirty(16, 'd');
+  const auto image_ptr = kMemoryPageSize / 2;
+  const auto heap_ptr = kMemoryPageSize + 16;
+
+  memory_->storeBuffer(image_ptr, image);
+  auto snapshot =
+      MemorySnapshot::take(instance_->getExportedMemory(), kMemoryPageSize);
+  ASSERT_TRUE(snapshot);
+
+  memory_->storeBuffer(image_ptr, dirty);
+  memory_->storeBuffer(heap_ptr, dirty);
+  ASSERT_TRUE(snapshot->restore());
+
+  EXPECT_EQ(memory_->loadN(image_ptr, image.size()), image);
+  EXPECT_EQ(memory_->loadN(heap_ptr, dirty.size()),
+            kagome::common::Buffer(dirty.size(), 0));
+}
+#endif
@@ -130,3 +130,87 @@ TEST_F(RocksDb_Integration_Test, Iterator) {
     EXPECT_EQ(counter[i], 1);
   }
 }
+
+/**
+ * @given database with some of requested keys
+ * @when read all the keys at once
+ * @then values of present keys are returned in order of keys, absent keys
+ * have no value
+ */
+TEST_F(RocksDb_Integration_Test, MultiGet) {
+  Buffer absent{4, 2};
+  Buffer other_key{7, 7};
+  Buffer other_value{9};
+  ASSERT_OUTCOME_SUCCESS_TRY(db_->put(key_, BufferView{value_}));
+  ASSERT_OUTCOME_SUCCESS_TRY(db_->put(other_key, BufferView{other_value}));
+
+  std::vector<BufferView> keys{other_key, absent, key_};
+  ASSERT_OUTCOME_SUCCESS(values, db_->multiGet(keys));
+  ASSERT_EQ(values.size(), keys.size());
+  ASSERT_TRUE(values[0]);
+  EXPECT_EQ(*values[0], other_value);
+  EXPECT_FALSE(values[1]);
+  ASSERT_TRUE(values[2]);
+  EXPECT_EQ(*values[2], value_);
+}
+
+/**
+ * @given database in bulk import mode
+ * @when values are written with and without a batch, then flushed
+ * @then values are readable and are persisted after database is reopened
+ */
+TEST_F(RocksDb_Integration_Test, BulkImport) {
+  Buffer batch_key{4, 2};
+  ASSERT_OUTCOME_SUCCESS_TRY(rocks_->setBulkImport(true));
+  ASSERT_OUTCOME_SUCCESS_TRY(db_->put(key_, BufferView{value_}));
+  auto batch = db_->batch();
+  ASSERT_OUTCOME_SUCCESS_TRY(batch->put(batch_key, BufferView{value_}));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch->commit());
+  EXPECT_OUTCOME_TRUE_2(val, db_->get(key_));
+  EXPECT_EQ(val, value_);
+  ASSERT_OUTCOME_SUCCESS_TRY(rocks_->flushBulkImport());
+  ASSERT_OUTCOME_SUCCESS_TRY(rocks_->setBulkImport(false));
+
+  db_.reset();
+  rocks_.reset();
+  open();
+  for (auto &key : {key_, batch_key}) {
+    EXPECT_OUTCOME_TRUE_2(val, db_->get(key));
+    EXPECT_EQ(val, value_);
+  }
+}
+
+/**
+ * @given snapshot of the database
+ * @when values are written and removed after the snapshot
+ * @then snapshot reads and iterates only values present at its creation and
+ * rejects writes
+ */
+TEST_F(RocksDb_Integration_Test, Snapshot) {
+  Buffer new_key{4, 2};
+  ASSERT_OUTCOME_SUCCESS_TRY(db_->put(key_, BufferView{value_}));
+  auto snapshot = db_->snapshot();
+  ASSERT_TRUE(snapshot);
+
+  ASSERT_OUTCOME_SUCCESS_TRY(db_->put(new_key, BufferView{value_}));
+  ASSERT_OUTCOME_SUCCESS_TRY(db_->remove(key_));
+
+  EXPECT_OUTCOME_TRUE_2(val, snapshot->get(key_));
+  EXPECT_EQ(val, value_);
+  EXPECT_OUTCOME_TRUE_2(absent, snapshot->tryGet(new_key));
+  EXPECT_FALSE(absent);
+
+  auto cursor = snapshot->cursor();
+  ASSERT_OUTCOME_SUCCESS_TRY(cursor->seekFirst());
+  ASSERT_TRUE(cursor->isValid());
+  EXPECT_EQ(cursor->key(), key_);
+  ASSERT_OUTCOME_SUCCESS_TRY(cursor->next());
+  EXPECT_FALSE(cursor->isValid());
+
+  EXPECT_FALSE(snapshot->put(new_key, BufferView{value_}));
+  auto batch = snapshot->batch();
+  ASSERT_OUTCOME_SUCCESS_TRY(batch->remove(new_key));
+  EXPECT_FALSE(batch->commit());
+  EXPECT_OUTCOME_TRUE_2(present, db_->tryGet(new_key));
+  EXPECT_TRUE(present);
+}
@@ -0,0 +1,231 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <map>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "filesystem/common.hpp"
+#include "storage/rocksdb/rocksdb.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+/**
+ * Compares RocksDB profiles on synthetic data shaped like data of storage
+ * spaces. Reports point reads of present and absent keys, full iteration and
+ * size of the database on disk.
+ * Usage: rocksdb_profile_benchmark [--benchmark_filter=<regex>]
+ */
+
+using kagome::common::Buffer;
+using kagome::storage::BufferStorage;
+using kagome::storage::RocksDb;
+using kagome::storage::RocksDbProfile;
+namespace fs = kagome::filesystem;
+
+namespace {
+  constexpr size_t kEntries = 100'000;
+  constexpr size_t kBatchSize = 1'000;
+
+  enum class Workload {
+    /// 32 byte random keys, small values (trie nodes)
+    kHashKeys,
+    /// big endian numbers, hashes as values (lookup keys)
+    kNumberKeys,
+    /// 32 byte random keys, large values of similar structure (block bodies)
+    kLargeValues,
+  };
+
+  const std::map<RocksDbProfile, std::string> kProfiles{
+      {RocksDbProfile::kLegacy, "legacy"},
+      {RocksDbProfile::kPointLookup, "point-lookup"},
+      {RocksDbProfile::kSequential, "sequential"},
+      {RocksDbProfile::kLargeValues, "large-values"},
+  };
+
+  const std::map<Workload, std::string> kWorkloads{
+      {Workload::kHashKeys, "hash_keys"},
+      {Workload::kNumberKeys, "number_keys"},
+      {Workload::kLargeValues, "large_values"},
+  };
+
+  Buffer randomBuffer(std::mt19937_64 &rng, size_t size) {
+    Buffer buffer(size, 0);
+    for (auto &byte : buffer) {
+      byte = static_cast<uint8_t>(rng());
+    }
+    return buffer;
+  }
+
+  Buffer numberKey(uint64_t number) {
+    Buffer key(sizeof(number), 0);
+    for (size_t i = 0; i < sizeof(number); ++i) {
+      key[sizeof(number) - 1 - i] = static_cast<uint8_t>(number >> (8 * i));
+    }
+    return key;
+  }
+
+  Buffer makeKey(std::mt19937_64 &rng, Workload workload, uint64_t i) {
+    if (workload == Workload::kNumberKeys) {
+      return numberKey(i);
+    }
+    return randomBuffer(rng, 32);
+  }
+
+  Buffer makeValue(std::mt19937_64 &rng, Workload workload) {
+    switch (workload) {
+      case Workload::kHashKeys:
+        return randomBuffer(rng, 128);
+      case Workload::kNumberKeys:
+        return randomBuffer(rng, 32);
+      case Workload::kLargeValues:
+        break;
+    }
+    // extrinsics share their structure, only signatures and some fields
+    // differ
+    Buffer value;
+    while (value.size() < 16 * 1024) {
+      value.put(std::string_view{"\x45\x02\x84\x00\xd4\x35\x93\xc7\x15\xfd"});
+      value.put(randomBuffer(rng, 64));
+      value.put(Buffer(32, 0x11));
+    }
+    return value;
+  }
+
+  struct Dataset {
+    std::shared_ptr<RocksDb> db;
+    std::shared_ptr<BufferStorage> space;
+    std::vector<Buffer> keys;
+    std::vector<Buffer> absent_keys;
+    uint64_t disk_bytes = 0;
+  };
+
+  uint64_t directorySize(const fs::path &path) {
+    uint64_t size = 0;
+    for (auto &entry : fs::recursive_directory_iterator(path)) {
+      if (entry.is_regular_file()) {
+        size += entry.file_size();
+      }
+    }
+    return size;
+  }
+
+  /// databases are filled once and shared by benchmarks
+  Dataset &dataset(RocksDbProfile profile, Workload workload) {
+    static std::map<std::pair<RocksDbProfile, Workload>, Dataset> datasets;
+    auto &dataset = datasets[{profile, workload}];
+    if (dataset.db != nullptr) {
+      return dataset;
+    }
+
+    auto path = fs::temp_directory_path()
+              / ("kagome_rocksdb_benchmark_" + kProfiles.at(profile) + "_"
+                 + kWorkloads.at(workload));
+    fs::remove_all(path);
+    rocksdb::Options options;
+    options.create_if_missing = true;
+    kagome::storage::RocksDbProfiles profiles;
+    profiles.fill(profile);
+    dataset.db = RocksDb::create(path,
+                                 options,
+                                 RocksDb::kDefaultStateCacheSizeMiB,
+                                 false,
+                                 profiles)
+                     .value();
+    dataset.space = dataset.db->getSpace(kagome::storage::Space::kTrieNode);
+
+    std::mt19937_64 rng{static_cast<uint64_t>(workload)};
+    auto batch = dataset.space->batch();
+    for (uint64_t i = 0; i < kEntries; ++i) {
+      auto &key = dataset.keys.emplace_back(makeKey(rng, workload, i));
+      batch->put(key, makeValue(rng, workload)).value();
+      if ((i + 1) % kBatchSize == 0) {
+        batch->commit().value();
+        batch = dataset.space->batch();
+      }
+    }
+    batch->commit().value();
+    for (uint64_t i = 0; i < kEntries; ++i) {
+      dataset.absent_keys.emplace_back(makeKey(rng, workload, kEntries + i));
+    }
+    std::shuffle(dataset.keys.begin(), dataset.keys.end(), rng);
+
+    // flush memtables and build final sst files
+    dynamic_cast<kagome::storage::RocksDbSpace &>(*dataset.space)
+        .compact(Buffer{}, Buffer{});
+    dataset.disk_bytes = directorySize(path);
+    return dataset;
+  }
+
+  void getPresent(benchmark::State &state,
+                  RocksDbProfile profile,
+                  Workload workload) {
+    auto &data = dataset(profile, workload);
+    size_t i = 0;
+    for (auto _ : state) {
+      auto value = data.space->get(data.keys[i++ % data.keys.size()]).value();
+      benchmark::DoNotOptimize(value.view().data());
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["disk_bytes"] = static_cast<double>(data.disk_bytes);
+  }
+
+  void getAbsent(benchmark::State &state,
+                 RocksDbProfile profile,
+                 Workload workload) {
+    auto &data = dataset(profile, workload);
+    size_t i = 0;
+    for (auto _ : state) {
+      auto key = data.absent_keys[i++ % data.absent_keys.size()];
+      auto value = data.space->tryGet(key).value();
+      benchmark::DoNotOptimize(value.has_value());
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void iterate(benchmark::State &state,
+               RocksDbProfile profile,
+               Workload workload) {
+    auto &data = dataset(profile, workload);
+    int64_t count = 0;
+    for (auto _ : state) {
+      auto cursor = data.space->cursor();
+      cursor->seekFirst().value();
+      for (; cursor->isValid(); cursor->next().value()) {
+        benchmark::DoNotOptimize(cursor->value());
+        ++count;
+      }
+    }
+    state.SetItemsProcessed(count);
+  }
+}  // namespace
+
+int main(int argc, char **argv) {
+  testutil::prepareLoggers(soralog::Level::WARN);
+
+  using Benchmark = void (*)(benchmark::State &, RocksDbProfile, Workload);
+  const std::map<std::string, Benchmark> benchmarks{
+      {"get_present", getPresent},
+      {"get_absent", getAbsent},
+      {"iterate", iterate},
+  };
+  for (auto &[benchmark_name, run] : benchmarks) {
+    for (auto &[workload, workload_name] : kWorkloads) {
+      for (auto &[profile, profile_name] : kProfiles) {
+        auto name = benchmark_name + "/" + workload_name + "/" + profile_name;
+        benchmark::RegisterBenchmark(
+            name.c_str(),
+            [run = run, profile = profile, workload = workload](
+                benchmark::State &state) { run(state, profile, workload); });
+      }
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -5,6 +5,7 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <scale/scale.hpp>
 
 #include "storage/changes_trie/impl/storage_changes_tracker_impl.hpp"
 #include "storage/in_memory/in_memory_storage.hpp"
@@ -255,3 +256,68 @@ TEST_F(TrieBatchTest, TopperBatchRemove) {
 }
 
 // TODO(Harrm): #595 test clearPrefix
+
+/**
+ * @given persistent batch
+ * @when items are appended to absent value, then to the stored vector
+ * @then value reads as vector of the items @and commit gives the same root as
+ * putting the whole vector
+ */
+TEST_F(TrieBatchTest, PersistentBatchAppend) {
+  auto items = std::vector<Buffer>{"01"_hex2buf, "0203"_hex2buf, "04"_hex2buf};
+  auto batch = trie->getPersistentBatchAt(empty_hash, std::nullopt).value();
+  for (auto &item : items) {
+    ASSERT_OUTCOME_SUCCESS_TRY(
+        batch->append("abc"_buf, Buffer{scale::encode(item).value()}));
+  }
+  auto expected = Buffer{scale::encode(items).value()};
+  ASSERT_OUTCOME_IS_TRUE(batch->contains("abc"_buf));
+  EXPECT_OUTCOME_TRUE(value, batch->get("abc"_buf));
+  EXPECT_EQ(value, expected);
+
+  // value which is not a vector is not changed
+  ASSERT_OUTCOME_SUCCESS_TRY(batch->put("def"_buf, "ff"_hex2buf));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch->append("def"_buf, "00"_hex2buf));
+  EXPECT_OUTCOME_TRUE(invalid, batch->get("def"_buf));
+  EXPECT_EQ(invalid, "ff"_hex2buf);
+
+  EXPECT_OUTCOME_TRUE(root, batch->commit(StateVersion::V0));
+  auto put_batch = trie->getPersistentBatchAt(empty_hash, std::nullopt).value();
+  ASSERT_OUTCOME_SUCCESS_TRY(put_batch->put("abc"_buf, expected));
+  ASSERT_OUTCOME_SUCCESS_TRY(put_batch->put("def"_buf, "ff"_hex2buf));
+  EXPECT_OUTCOME_TRUE(put_root, put_batch->commit(StateVersion::V0));
+  EXPECT_EQ(root, put_root);
+}
+
+/**
+ * @given topper batch over persistent batch with a stored vector
+ * @when items are appended in the topper batch
+ * @then parent is not changed until write back @and both batches read the
+ * whole vector after that, whether or not the topper read it before
+ */
+TEST_F(TrieBatchTest, TopperBatchAppend) {
+  auto items = std::vector<Buffer>{"01"_hex2buf, "0203"_hex2buf, "04"_hex2buf};
+  auto encoded = [](const std::vector<Buffer> &items) {
+    return Buffer{scale::encode(items).value()};
+  };
+  std::shared_ptr<TrieBatch> p_batch =
+      trie->getPersistentBatchAt(empty_hash, std::nullopt).value();
+  ASSERT_OUTCOME_SUCCESS_TRY(p_batch->put("abc"_buf, encoded({items[0]})));
+
+  auto t_batch = std::make_shared<TopperTrieBatchImpl>(p_batch);
+  ASSERT_OUTCOME_SUCCESS_TRY(
+      t_batch->append("abc"_buf, Buffer{scale::encode(items[1]).value()}));
+  EXPECT_OUTCOME_TRUE(parent_value, p_batch->get("abc"_buf));
+  EXPECT_EQ(parent_value, encoded({items[0]}));
+  EXPECT_OUTCOME_TRUE(value, t_batch->get("abc"_buf));
+  EXPECT_EQ(value, encoded({items[0], items[1]}));
+  ASSERT_OUTCOME_SUCCESS_TRY(t_batch->writeBack());
+
+  // appended without reading in the topper
+  auto t_batch2 = std::make_shared<TopperTrieBatchImpl>(p_batch);
+  ASSERT_OUTCOME_SUCCESS_TRY(
+      t_batch2->append("abc"_buf, Buffer{scale::encode(items[2]).value()}));
+  ASSERT_OUTCOME_SUCCESS_TRY(t_batch2->writeBack());
+  EXPECT_OUTCOME_TRUE(written, p_batch->get("abc"_buf));
+  EXPECT_EQ(written, encoded(items));
+}
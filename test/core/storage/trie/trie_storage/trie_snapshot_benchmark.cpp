@@ -0,0 +1,157 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "filesystem/common.hpp"
+#include "storage/rocksdb/rocksdb.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/impl/trie_storage_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+/**
+ * Reports throughput of iteration of the state from trie snapshots read by
+ * several threads, while another thread keeps importing state changes.
+ * Usage: trie_snapshot_benchmark [--benchmark_filter=<regex>]
+ */
+
+using kagome::common::Buffer;
+using kagome::storage::RocksDb;
+using kagome::storage::Space;
+using kagome::storage::trie::PolkadotCodec;
+using kagome::storage::trie::PolkadotTrieFactoryImpl;
+using kagome::storage::trie::RootHash;
+using kagome::storage::trie::StateVersion;
+using kagome::storage::trie::TrieSerializerImpl;
+using kagome::storage::trie::TrieSnapshot;
+using kagome::storage::trie::TrieStorage;
+using kagome::storage::trie::TrieStorageBackendImpl;
+using kagome::storage::trie::TrieStorageImpl;
+namespace fs = kagome::filesystem;
+
+namespace {
+  constexpr size_t kEntries = 100'000;
+  constexpr size_t kImportedEntries = 100;
+
+  Buffer randomBuffer(std::mt19937_64 &rng, size_t size) {
+    Buffer buffer(size, 0);
+    for (auto &byte : buffer) {
+      byte = static_cast<uint8_t>(rng());
+    }
+    return buffer;
+  }
+
+  struct Dataset {
+    std::shared_ptr<RocksDb> db;
+    std::shared_ptr<TrieStorage> storage;
+    RootHash root;
+    std::shared_ptr<TrieSnapshot> snapshot;
+  };
+
+  Dataset &dataset() {
+    static Dataset dataset;
+    if (dataset.db != nullptr) {
+      return dataset;
+    }
+
+    auto path = fs::temp_directory_path() / "kagome_trie_snapshot_benchmark";
+    fs::remove_all(path);
+    rocksdb::Options options;
+    options.create_if_missing = true;
+    dataset.db = RocksDb::create(path, options).value();
+    auto factory = std::make_shared<PolkadotTrieFactoryImpl>();
+    auto codec = std::make_shared<PolkadotCodec>();
+    auto serializer = std::make_shared<TrieSerializerImpl>(
+        factory,
+        codec,
+        std::make_shared<TrieStorageBackendImpl>(
+            dataset.db->getSpace(Space::kTrieNode)));
+    dataset.storage =
+        TrieStorageImpl::createEmpty(factory, codec, serializer).value();
+
+    std::mt19937_64 rng{0};
+    auto batch = dataset.storage
+                     ->getPersistentBatchAt(serializer->getEmptyRootHash(),
+                                            std::nullopt)
+                     .value();
+    for (size_t i = 0; i < kEntries; ++i) {
+      batch->put(randomBuffer(rng, 32), randomBuffer(rng, 64)).value();
+    }
+    dataset.root = batch->commit(StateVersion::V0).value();
+    dataset.snapshot = dataset.storage->getSnapshotAt(dataset.root).value();
+    return dataset;
+  }
+
+  /// each thread iterates whole state of the shared snapshot
+  void iterateSnapshot(benchmark::State &state) {
+    auto &data = dataset();
+    int64_t count = 0;
+    for (auto _ : state) {
+      auto batch = data.snapshot->batch().value();
+      auto cursor = batch->trieCursor();
+      cursor->seekFirst().value();
+      for (; cursor->isValid(); cursor->next().value()) {
+        benchmark::DoNotOptimize(cursor->value());
+        ++count;
+      }
+    }
+    state.SetItemsProcessed(count);
+  }
+
+  /// the same, while the first thread imports changes to the state
+  void iterateSnapshotWhileImporting(benchmark::State &state) {
+    auto &data = dataset();
+    std::mt19937_64 rng{static_cast<uint64_t>(state.thread_index())};
+    int64_t count = 0;
+    for (auto _ : state) {
+      if (state.thread_index() == 0) {
+        auto batch =
+            data.storage->getPersistentBatchAt(data.root, std::nullopt)
+                .value();
+        for (size_t i = 0; i < kImportedEntries; ++i) {
+          batch->put(randomBuffer(rng, 32), randomBuffer(rng, 64)).value();
+        }
+        benchmark::DoNotOptimize(batch->commit(StateVersion::V0).value());
+        continue;
+      }
+      auto batch = data.snapshot->batch().value();
+      auto cursor = batch->trieCursor();
+      cursor->seekFirst().value();
+      for (; cursor->isValid(); cursor->next().value()) {
+        benchmark::DoNotOptimize(cursor->value());
+        ++count;
+      }
+    }
+    state.SetItemsProcessed(count);
+  }
+}  // namespace
+
+int main(int argc, char **argv) {
+  testutil::prepareLoggers(soralog::Level::WARN);
+  // fill the database before threads are started
+  dataset();
+
+  benchmark::RegisterBenchmark("iterate_snapshot", iterateSnapshot)
+      ->ThreadRange(1, 8)
+      ->UseRealTime();
+  benchmark::RegisterBenchmark("iterate_snapshot_while_importing",
+                               iterateSnapshotWhileImporting)
+      // one importing thread and 1, 2, 4, 8 reading threads
+      ->Threads(2)
+      ->Threads(3)
+      ->Threads(5)
+      ->Threads(9)
+      ->UseRealTime();
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -80,3 +80,51 @@ TEST_F(TrieDbBackendTest, Batch) {
   EXPECT_OUTCOME_TRUE_1(batch->remove("abc"_buf));
   EXPECT_OUTCOME_TRUE_1(batch->commit());
 }
+
+/**
+ * @given trie backend with committed batch of nodes
+ * @when the same nodes are put again by next batches
+ * @then they are not written to the storage, until they are removed
+ */
+TEST_F(TrieDbBackendTest, SkipsWrittenNodes) {
+  Buffer node{"node"_hash256};
+  Buffer other{"other"_hash256};
+
+  auto first_batch = std::make_unique<WriteBatchMock<Buffer, Buffer>>();
+  EXPECT_CALL(*first_batch, put(node.view(), "123"_buf))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*first_batch, commit()).WillOnce(Return(outcome::success()));
+
+  auto second_batch = std::make_unique<WriteBatchMock<Buffer, Buffer>>();
+  EXPECT_CALL(*second_batch, put(other.view(), "456"_buf))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*second_batch, remove(node.view()))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*second_batch, commit()).WillOnce(Return(outcome::success()));
+
+  auto third_batch = std::make_unique<WriteBatchMock<Buffer, Buffer>>();
+  EXPECT_CALL(*third_batch, put(node.view(), "123"_buf))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*third_batch, commit()).WillOnce(Return(outcome::success()));
+
+  EXPECT_CALL(*storage, batch())
+      .WillOnce(Return(testing::ByMove(std::move(first_batch))))
+      .WillOnce(Return(testing::ByMove(std::move(second_batch))))
+      .WillOnce(Return(testing::ByMove(std::move(third_batch))));
+
+  auto batch = backend.batch();
+  EXPECT_OUTCOME_TRUE_1(batch->put(node, "123"_buf));
+  // duplicate in the same batch
+  EXPECT_OUTCOME_TRUE_1(batch->put(node, "123"_buf));
+  EXPECT_OUTCOME_TRUE_1(batch->commit());
+
+  batch = backend.batch();
+  EXPECT_OUTCOME_TRUE_1(batch->put(node, "123"_buf));
+  EXPECT_OUTCOME_TRUE_1(batch->put(other, "456"_buf));
+  EXPECT_OUTCOME_TRUE_1(batch->remove(node));
+  EXPECT_OUTCOME_TRUE_1(batch->commit());
+
+  batch = backend.batch();
+  EXPECT_OUTCOME_TRUE_1(batch->put(node, "123"_buf));
+  EXPECT_OUTCOME_TRUE_1(batch->commit());
+}
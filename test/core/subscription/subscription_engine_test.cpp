@@ -283,3 +283,125 @@ TEST_F(SubscriptionEngineTest, UnsubscribeStreamSub) {
 
   engine_->notify(key, data_1, data_2);
 }
+
+/**
+ * @given a subscription engine and subscriber with async callback
+ * @when we make notifications
+ * @then events are delivered by executor in order of notifications
+ */
+TEST_F(SubscriptionEngineTest, AsyncDelivery) {
+  SubscriptionTargetMock target;
+  std::vector<std::function<void()>> executor_queue;
+
+  auto subscriber = std::make_shared<Subscriber<std::string_view,
+                                                SubscriptionTargetMock,
+                                                std::string_view,
+                                                int32_t>>(engine_);
+  subscriber->setAsyncCallback(
+      [&](auto set_id,
+          auto &,
+          auto &key,
+          std::string_view data_1,
+          int32_t data_2) -> std::function<void()> {
+        return [&, data_1{std::string{data_1}}, data_2] {
+          target.test_call(data_1, data_2);
+        };
+      },
+      [&](std::function<void()> cb) {
+        executor_queue.emplace_back(std::move(cb));
+      },
+      10);
+
+  const auto id = subscriber->generateSubscriptionSetId();
+  subscriber->subscribe(id, key);
+
+  testing::InSequence s;
+  EXPECT_CALL(target, test_call("a", 1));
+  EXPECT_CALL(target, test_call("b", 2));
+
+  engine_->notify(key, "a", 1);
+  engine_->notify(key, "b", 2);
+
+  // single drain is scheduled for both events
+  ASSERT_EQ(executor_queue.size(), 1);
+  executor_queue.front()();
+}
+
+/**
+ * @given a subscriber with async callback and queue of one event
+ * @when we make notifications without draining queue
+ * @then extra events are dropped and counted
+ */
+TEST_F(SubscriptionEngineTest, AsyncDrop) {
+  SubscriptionTargetMock target;
+  std::vector<std::function<void()>> executor_queue;
+  size_t dropped = 0;
+
+  auto subscriber = std::make_shared<Subscriber<std::string_view,
+                                                SubscriptionTargetMock,
+                                                std::string_view,
+                                                int32_t>>(engine_);
+  subscriber->setAsyncCallback(
+      [&](auto set_id,
+          auto &,
+          auto &key,
+          std::string_view data_1,
+          int32_t data_2) -> std::function<void()> {
+        return [&, data_1{std::string{data_1}}, data_2] {
+          target.test_call(data_1, data_2);
+        };
+      },
+      [&](std::function<void()> cb) {
+        executor_queue.emplace_back(std::move(cb));
+      },
+      1,
+      [&] { ++dropped; });
+
+  const auto id = subscriber->generateSubscriptionSetId();
+  subscriber->subscribe(id, key);
+
+  EXPECT_CALL(target, test_call("a", 1));
+
+  engine_->notify(key, "a", 1);
+  engine_->notify(key, "b", 2);
+  engine_->notify(key, "c", 3);
+  ASSERT_EQ(subscriber->droppedEvents(), 2);
+  ASSERT_EQ(dropped, 2);
+
+  ASSERT_EQ(executor_queue.size(), 1);
+  executor_queue.front()();
+}
+
+/**
+ * @given a subscription engine
+ * @when subscriber unsubscribes during notification
+ * @then notification completes and subscriber is removed
+ */
+TEST_F(SubscriptionEngineTest, UnsubscribeOnNotify) {
+  std::string_view data_1(test_data);
+  int32_t data_2 = 105;
+
+  SubscriptionTargetMock target;
+  auto subscriber = std::make_shared<Subscriber<std::string_view,
+                                                SubscriptionTargetMock,
+                                                std::string_view,
+                                                int32_t>>(engine_);
+  subscriber->setCallback(
+      [&](auto set_id,
+          auto &,
+          auto &key,
+          std::string_view data_1,
+          int32_t data_2) {
+        target.test_call(data_1, data_2);
+        subscriber->unsubscribe(set_id);
+      });
+
+  EXPECT_CALL(target, test_call(data_1, data_2));
+
+  const auto id = subscriber->generateSubscriptionSetId();
+  subscriber->subscribe(id, key);
+  engine_->notify(key, data_1, data_2);
+
+  ASSERT_EQ(engine_->size(key), 0ull);
+  engine_->notify(key, data_1, data_2);
+}
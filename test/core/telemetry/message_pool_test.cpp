@@ -5,8 +5,10 @@
 
 #include "telemetry/impl/message_pool.hpp"
 
+#include <atomic>
 #include <cstring>
 #include <string>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -252,3 +254,66 @@ TEST(MessagePoolFreeTest, ZeroSizeEntries) {
   auto handle = pool.push("test", 1);
   ASSERT_FALSE(handle);
 }
+
+/**
+ * @given a message pool
+ * @when a message is serialized directly into the pool
+ * @then the record contains exactly the written data
+ */
+TEST_F(MessagePoolTest, Emplace) {
+  auto handle = pool_.emplace(1, [](MessagePool::RecordStream &stream) {
+    for (auto c : std::string_view{"test"}) {
+      stream.Put(c);
+    }
+  });
+  ASSERT_TRUE(handle);
+  auto buffer = pool_[*handle];
+  ASSERT_EQ(buffer.size(), 4);
+  ASSERT_FALSE(memcmp("test", buffer.data(), buffer.size()));
+}
+
+/**
+ * @given a pool of size for a single entry only
+ * @when serialized message exceeds max record size
+ * @then no handle is returned and the slot remains free
+ */
+TEST_F(MessagePoolTest, EmplaceOverflow) {
+  MessagePool pool(kMaxRecordSizeBytes, 1);
+  auto handle = pool.emplace(1, [](MessagePool::RecordStream &stream) {
+    for (auto i = 0; i <= kMaxRecordSizeBytes; ++i) {
+      stream.Put('a');
+    }
+  });
+  ASSERT_FALSE(handle);
+  ASSERT_TRUE(pool.push("test", 1));
+}
+
+/**
+ * @given a message pool
+ * @when messages are pushed and released concurrently
+ * @then every pushed message is served not corrupted
+ */
+TEST_F(MessagePoolTest, ConcurrentPushRelease) {
+  std::vector<std::thread> threads;
+  std::atomic_bool corrupted = false;
+  for (auto t = 0; t < kMaxPoolCapacity; ++t) {
+    threads.emplace_back([&, filler = static_cast<char>('a' + t)] {
+      auto message = testMessage(kMaxRecordSizeBytes, filler);
+      for (auto i = 0; i < 10000; ++i) {
+        auto handle = pool_.push(message, 1);
+        if (not handle) {
+          continue;
+        }
+        auto buffer = pool_[*handle];
+        if (memcmp(message.data(), buffer.data(), message.length()) != 0) {
+          corrupted = true;
+        }
+        pool_.release(*handle);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  ASSERT_FALSE(corrupted);
+}
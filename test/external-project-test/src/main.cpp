@@ -214,7 +214,11 @@ int main() {
   auto runtime_instances_pool =
       std::make_shared<kagome::runtime::RuntimeInstancesPool>();
   auto module_repo = std::make_shared<kagome::runtime::ModuleRepositoryImpl>(
-      runtime_instances_pool, runtime_upgrade_tracker, module_factory, smc);
+      runtime_instances_pool,
+      runtime_upgrade_tracker,
+      module_factory,
+      smc,
+      hasher);
   auto env_factory =
       std::make_shared<kagome::runtime::RuntimeEnvironmentFactory>(
           code_provider, module_repo, header_repo);
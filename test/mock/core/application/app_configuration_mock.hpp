@@ -120,6 +120,11 @@ namespace kagome::application {
 
     MOCK_METHOD(bool, purgeWavmCache, (), (const, override));
 
+    MOCK_METHOD(std::optional<filesystem::path>,
+                hostApiProfilePath,
+                (),
+                (const, override));
+
     MOCK_METHOD(AppConfiguration::OffchainWorkerMode,
                 offchainWorkerMode,
                 (),
@@ -148,6 +153,11 @@ namespace kagome::application {
 
     MOCK_METHOD(uint32_t, dbCacheSize, (), (const, override));
 
+    MOCK_METHOD(const storage::RocksDbProfiles &,
+                dbProfiles,
+                (),
+                (const, override));
+
     MOCK_METHOD(std::optional<std::string_view>,
                 devMnemonicPhrase,
                 (),
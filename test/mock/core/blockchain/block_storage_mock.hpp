@@ -103,6 +103,15 @@ namespace kagome::blockchain {
                 (const primitives::BlockHash &),
                 (const, override));
 
+    MOCK_METHOD(outcome::result<std::vector<primitives::EncodedBlockData>>,
+                getEncodedBlocks,
+                (const std::vector<primitives::BlockHash> &,
+                 bool,
+                 bool,
+                 bool,
+                 size_t),
+                (const, override));
+
     MOCK_METHOD(outcome::result<void>,
                 removeBlock,
                 (const primitives::BlockHash &),
@@ -0,0 +1,27 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_TEST_MOCK_CORE_NETWORK_EXTRINSIC_OBSERVER_MOCK_HPP
+#define KAGOME_TEST_MOCK_CORE_NETWORK_EXTRINSIC_OBSERVER_MOCK_HPP
+
+#include "network/extrinsic_observer.hpp"
+
+#include <gmock/gmock.h>
+
+#include "primitives/extrinsic.hpp"
+
+namespace kagome::network {
+
+  class ExtrinsicObserverMock : public ExtrinsicObserver {
+   public:
+    MOCK_METHOD(outcome::result<common::Hash256>,
+                onTxMessage,
+                (const primitives::Extrinsic &),
+                (override));
+  };
+
+}  // namespace kagome::network
+
+#endif  // KAGOME_TEST_MOCK_CORE_NETWORK_EXTRINSIC_OBSERVER_MOCK_HPP
@@ -0,0 +1,25 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_TEST_MOCK_CORE_RUNTIME_MODULE_MOCK_HPP
+#define KAGOME_TEST_MOCK_CORE_RUNTIME_MODULE_MOCK_HPP
+
+#include "runtime/module.hpp"
+
+#include <gmock/gmock.h>
+
+namespace kagome::runtime {
+
+  class ModuleMock final : public Module {
+   public:
+    MOCK_METHOD(outcome::result<std::shared_ptr<ModuleInstance>>,
+                instantiate,
+                (),
+                (const, override));
+  };
+
+}  // namespace kagome::runtime
+
+#endif  // KAGOME_TEST_MOCK_CORE_RUNTIME_MODULE_MOCK_HPP
@@ -25,6 +25,14 @@ namespace kagome::runtime {
                 (const common::Hash256 &,
                  std::function<outcome::result<primitives::OpaqueMetadata>()>),
                 (override));
+
+    MOCK_METHOD(outcome::result<common::Buffer>,
+                getCallResult,
+                (const common::Hash256 &,
+                 std::string_view,
+                 common::BufferView,
+                 std::function<outcome::result<common::Buffer>()>),
+                (override));
   };
 
 }  // namespace kagome::runtime
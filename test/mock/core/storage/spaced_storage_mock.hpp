@@ -15,6 +15,10 @@ namespace kagome::storage {
   class SpacedStorageMock : public SpacedStorage {
    public:
     MOCK_METHOD(std::shared_ptr<BufferStorage>, getSpace, (Space), (override));
+
+    MOCK_METHOD(outcome::result<void>, setBulkImport, (bool), (override));
+
+    MOCK_METHOD(outcome::result<void>, flushBulkImport, (), (override));
   };
 
 }  // namespace kagome::storage
@@ -25,6 +25,8 @@ namespace kagome::storage::trie {
                 retrieveTrie,
                 (const common::Buffer &, OnNodeLoaded),
                 (const, override));
+
+    MOCK_METHOD(std::shared_ptr<TrieSerializer>, snapshot, (), (const, override));
   };
 
 }  // namespace kagome::storage::trie
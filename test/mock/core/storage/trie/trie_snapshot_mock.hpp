@@ -0,0 +1,32 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_TEST_MOCK_CORE_STORAGE_TRIE_TRIE_SNAPSHOT_MOCK
+#define KAGOME_TEST_MOCK_CORE_STORAGE_TRIE_TRIE_SNAPSHOT_MOCK
+
+#include <gmock/gmock.h>
+
+#include "storage/trie/trie_snapshot.hpp"
+
+namespace kagome::storage::trie {
+
+  class TrieSnapshotMock : public TrieSnapshot {
+   public:
+    MOCK_METHOD(const RootHash &, root, (), (const, override));
+
+    MOCK_METHOD(outcome::result<std::unique_ptr<TrieBatch>>,
+                batch,
+                (),
+                (const, override));
+
+    MOCK_METHOD(outcome::result<std::unique_ptr<TrieBatch>>,
+                batchAt,
+                (const RootHash &root),
+                (const, override));
+  };
+
+}  // namespace kagome::storage::trie
+
+#endif  // KAGOME_TEST_MOCK_CORE_STORAGE_TRIE_TRIE_SNAPSHOT_MOCK
@@ -28,6 +28,11 @@ namespace kagome::storage::trie {
                 getProofReaderBatchAt,
                 (const RootHash &root, const OnNodeLoaded &on_node_loaded),
                 (const, override));
+
+    MOCK_METHOD(outcome::result<std::shared_ptr<TrieSnapshot>>,
+                getSnapshotAt,
+                (const RootHash &root),
+                (const, override));
   };
 
 }  // namespace kagome::storage::trie